@@ -403,6 +403,9 @@ namespace Kargono
 			Assets::AssetService::ClearAll();
 			Assets::AssetService::DeserializeAll();
 
+			// Rebuild intermediates whose source files changed since they were imported
+			Assets::AssetService::ReimportChangedAssets();
+
 			// Ensure all script assets are properly loaded in
 			Assets::AssetService::LoadAllScriptIntoCache();
 
@@ -43,6 +43,8 @@ namespace Kargono::Panels
 		ImGui::Separator();
 		auto stats = Rendering::RenderingService::GetStats();
 		ImGui::Text("Draw Calls: %d", stats.DrawCalls);
+		ImGui::Text("Shader Binds: %d", stats.ShaderBinds);
+		ImGui::Text("Texture Binds: %d", stats.TextureBinds);
 		ImGui::NewLine();
 
 		ImGui::Text("Time");
@@ -11,12 +11,22 @@
 	#include <WinSock2.h>
 #elif defined(KG_PLATFORM_LINUX) || defined(KG_PLATFORM_MAC)
 	#include <sys/socket.h>
+	#include <sys/uio.h>
 	#include <netinet/in.h>
 	#include <fcntl.h>
+	#include <unistd.h>
+	#include <errno.h>
 #else
 	#error "Platform is not supported for networking!"
 #endif
 
+// Define the readiness notification headers relevent for "this" platform
+#if defined(KG_PLATFORM_LINUX)
+	#include <sys/epoll.h>
+	#include <sys/timerfd.h>
+	#include <sys/eventfd.h>
+#endif
+
 // TODO: Link the winsock library in the actual engine plz TODO TODO TODO
 #if defined(KG_PLATFORM_WINDOWS)
 	#pragma comment( lib, "wsock32.lib" )
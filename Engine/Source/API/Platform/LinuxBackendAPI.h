@@ -1,4 +1,8 @@
 #pragma once
 #if defined(KG_PLATFORM_LINUX) 
 #include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
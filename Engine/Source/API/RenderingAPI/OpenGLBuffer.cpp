@@ -43,6 +43,141 @@ namespace API::RenderingAPI
 		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
 	}
+	//============================================================
+	// Streaming Vertex Buffer
+	//============================================================
+
+	OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(uint32_t regionSize)
+		: m_RegionSize{ regionSize }
+	{
+		constexpr GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		GLsizeiptr bufferSize = static_cast<GLsizeiptr>(regionSize) * k_StreamRegionCount;
+		glCreateBuffers(1, &m_RendererID);
+		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		glNamedBufferStorage(m_RendererID, bufferSize, nullptr, mapFlags);
+		m_MappedData = static_cast<uint8_t*>(glMapNamedBufferRange(m_RendererID, 0, bufferSize, mapFlags));
+		KG_ASSERT(m_MappedData, "Failed to persistently map streaming vertex buffer");
+	}
+
+	OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer()
+	{
+		for (void* fence : m_RegionFences)
+		{
+			if (fence)
+			{
+				glDeleteSync(static_cast<GLsync>(fence));
+			}
+		}
+		glUnmapNamedBuffer(m_RendererID);
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLStreamingVertexBuffer::Bind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+	}
+
+	void OpenGLStreamingVertexBuffer::Unbind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void OpenGLStreamingVertexBuffer::SetData(const void* data, uint32_t size)
+	{
+		UNREFERENCED_PARAMETER(data);
+		UNREFERENCED_PARAMETER(size);
+		KG_ERROR("Attempt to call SetData on a streaming vertex buffer. Use AllocateStreamRange instead.");
+	}
+
+	uint8_t* OpenGLStreamingVertexBuffer::AllocateStreamRange(uint32_t size, uint32_t alignment, uint32_t& offset)
+	{
+		if (size > m_RegionSize || alignment == 0)
+		{
+			KG_ERROR("Invalid streaming vertex buffer allocation of {} bytes", size);
+			return nullptr;
+		}
+
+		// Align the offset from the start of the buffer, so vertex indices can be derived from it
+		auto alignedStart = [&](uint32_t region, uint32_t cursor)
+		{
+			uint32_t regionStart = region * m_RegionSize;
+			return ((regionStart + cursor + alignment - 1) / alignment) * alignment - regionStart;
+		};
+
+		uint32_t start = alignedStart(m_CurrentRegion, m_RegionCursor);
+		if (start + size > m_RegionSize)
+		{
+			// Move to the next region. A region written since the last fence may still be waiting
+			//		for its draw calls, so it cannot be reused yet.
+			uint32_t nextRegion = (m_CurrentRegion + 1) % k_StreamRegionCount;
+			if (m_RegionWritten[nextRegion])
+			{
+				return nullptr;
+			}
+			WaitForRegion(nextRegion);
+			m_CurrentRegion = nextRegion;
+			start = alignedStart(m_CurrentRegion, 0);
+			if (start + size > m_RegionSize)
+			{
+				KG_ERROR("Streaming vertex buffer allocation of {} bytes does not fit inside a region", size);
+				return nullptr;
+			}
+		}
+
+		m_RegionWritten[m_CurrentRegion] = true;
+		m_RegionCursor = start + size;
+		offset = m_CurrentRegion * m_RegionSize + start;
+		return m_MappedData + offset;
+	}
+
+	void OpenGLStreamingVertexBuffer::FenceStreamRanges()
+	{
+		for (uint32_t region{ 0 }; region < k_StreamRegionCount; region++)
+		{
+			if (!m_RegionWritten[region])
+			{
+				continue;
+			}
+
+			// The new fence signals after the previous one, so it replaces it
+			if (m_RegionFences[region])
+			{
+				glDeleteSync(static_cast<GLsync>(m_RegionFences[region]));
+			}
+			m_RegionFences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			m_RegionWritten[region] = false;
+		}
+	}
+
+	void OpenGLStreamingVertexBuffer::WaitForRegion(uint32_t region)
+	{
+		GLsync fence = static_cast<GLsync>(m_RegionFences[region]);
+		if (!fence)
+		{
+			return;
+		}
+
+		// Flush on the first wait, so the fence is guaranteed to reach the GPU
+		GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		constexpr GLuint64 waitTimeout{ 1'000'000 }; // 1 millisecond in nanoseconds
+		while (true)
+		{
+			GLenum waitResult = glClientWaitSync(fence, waitFlags, waitTimeout);
+			if (waitResult == GL_ALREADY_SIGNALED || waitResult == GL_CONDITION_SATISFIED)
+			{
+				break;
+			}
+			if (waitResult == GL_WAIT_FAILED)
+			{
+				KG_WARN("Failed to wait on streaming vertex buffer fence");
+				break;
+			}
+			waitFlags = 0;
+		}
+		glDeleteSync(fence);
+		m_RegionFences[region] = nullptr;
+	}
+
 	//============================================================
 	// Index Buffer
 	//============================================================
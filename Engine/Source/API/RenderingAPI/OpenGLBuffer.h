@@ -2,6 +2,8 @@
 
 #include "Kargono/Rendering/InputBuffer.h"
 
+#include <array>
+
 #ifdef KG_RENDERER_OPENGL
 
 namespace API::RenderingAPI
@@ -57,6 +59,57 @@ namespace API::RenderingAPI
 		Kargono::Rendering::InputBufferLayout m_Layout;
 	};
 
+	//=============================
+	// OpenGL Streaming VertexBuffer Class
+	//=============================
+	// This class is a persistently mapped vertex buffer used by the batch renderer. The buffer
+	//		is split into regions that are written in turn. A fence is placed on each written region
+	//		once its draw calls are submitted, and a region is only reused after its fence signals,
+	//		so the CPU never overwrites vertices the GPU is still reading.
+	class OpenGLStreamingVertexBuffer : public Kargono::Rendering::VertexBuffer
+	{
+	public:
+		//=============================
+		// Constructors and Destructors
+		//=============================
+		OpenGLStreamingVertexBuffer(uint32_t regionSize);
+		virtual ~OpenGLStreamingVertexBuffer() override;
+	public:
+		//==============================
+		// Binding Functionality
+		//==============================
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+		//==============================
+		// Update OpenGL Context
+		//==============================
+		// Streaming buffers are written through AllocateStreamRange()
+		virtual void SetData(const void* data, uint32_t size) override;
+		virtual uint8_t* AllocateStreamRange(uint32_t size, uint32_t alignment, uint32_t& offset) override;
+		virtual void FenceStreamRanges() override;
+		//==============================
+		// Getters/Setters
+		//==============================
+		virtual const Kargono::Rendering::InputBufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const Kargono::Rendering::InputBufferLayout& layout) override { m_Layout = layout; }
+	private:
+		// Blocks until the GPU has finished reading the indicated region
+		void WaitForRegion(uint32_t region);
+	private:
+		uint32_t m_RendererID{ 0 };
+		Kargono::Rendering::InputBufferLayout m_Layout;
+		// Persistently mapped pointer to the start of the buffer
+		uint8_t* m_MappedData{ nullptr };
+		uint32_t m_RegionSize{ 0 };
+		uint32_t m_CurrentRegion{ 0 };
+		// Byte offset of the next free byte inside the current region
+		uint32_t m_RegionCursor{ 0 };
+		// Fence (GLsync) placed after the last draw calls that read each region
+		std::array<void*, Kargono::Rendering::VertexBuffer::k_StreamRegionCount> m_RegionFences{};
+		// Regions written since the last call to FenceStreamRanges()
+		std::array<bool, Kargono::Rendering::VertexBuffer::k_StreamRegionCount> m_RegionWritten{};
+	};
+
 	//=============================
 	// OpenGL IndexBuffer Class	
 	//=============================
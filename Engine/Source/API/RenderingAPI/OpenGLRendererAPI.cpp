@@ -180,28 +180,34 @@ namespace Kargono::Rendering
 		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
 	}
 
-	void RendererAPI::DrawIndexed(const Kargono::Ref<Kargono::Rendering::VertexArray>& vertexArray,uint32_t* indexPointer, uint32_t indexCount)
+	void RendererAPI::DrawIndexed(const Kargono::Ref<Kargono::Rendering::VertexArray>& vertexArray,uint32_t* indexPointer, uint32_t indexCount, uint32_t baseVertex)
 	{
 		vertexArray->Bind();
-		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, indexPointer);
+		glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, indexPointer, static_cast<GLint>(baseVertex));
 	}
 
-	void RendererAPI::DrawLines(const Kargono::Ref<Kargono::Rendering::VertexArray>& vertexArray, uint32_t vertexCount)
+	void RendererAPI::DrawIndexedInstanced(const Kargono::Ref<Kargono::Rendering::VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount)
 	{
 		vertexArray->Bind();
-		glDrawArrays(GL_LINES, 0, vertexCount);
+		glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
 	}
 
-	void RendererAPI::DrawPoints(const Ref<VertexArray>& vertexArray, uint32_t vertexCount)
+	void RendererAPI::DrawLines(const Kargono::Ref<Kargono::Rendering::VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex)
 	{
 		vertexArray->Bind();
-		glDrawArrays(GL_POINTS, 0, vertexCount);
+		glDrawArrays(GL_LINES, firstVertex, vertexCount);
 	}
 
-	void RendererAPI::DrawTriangles(const Kargono::Ref<Kargono::Rendering::VertexArray>& vertexArray, uint32_t vertexCount)
+	void RendererAPI::DrawPoints(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex)
 	{
 		vertexArray->Bind();
-		glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+		glDrawArrays(GL_POINTS, firstVertex, vertexCount);
+	}
+
+	void RendererAPI::DrawTriangles(const Kargono::Ref<Kargono::Rendering::VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex)
+	{
+		vertexArray->Bind();
+		glDrawArrays(GL_TRIANGLES, firstVertex, vertexCount);
 	}
 
 	void RendererAPI::SetLineWidth(float width)
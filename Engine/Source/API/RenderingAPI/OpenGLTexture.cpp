@@ -8,6 +8,11 @@
 
 #ifdef KG_RENDERER_OPENGL
 
+// BC1 is exposed through EXT_texture_compression_s3tc, which the loader does not define
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
 namespace API::Utility
 {
 	static GLenum KargonoFormatToGLDataFormat(Kargono::Rendering::ImageFormat format)
@@ -61,7 +66,15 @@ namespace API::RenderingAPI
 	OpenGLTexture2D::OpenGLTexture2D(uint32_t rendererID, uint32_t width, uint32_t height)
 		: m_RendererID(rendererID), m_Width(width), m_Height(height)
 	{
-		
+		// Query the storage of the wrapped texture, so it can be copied into texture arrays
+		GLint internalFormat{ 0 }, mipCount{ 0 }, compressed{ GL_FALSE };
+		glGetTextureLevelParameteriv(m_RendererID, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+		glGetTextureLevelParameteriv(m_RendererID, 0, GL_TEXTURE_COMPRESSED, &compressed);
+		glGetTextureParameteriv(m_RendererID, GL_TEXTURE_IMMUTABLE_LEVELS, &mipCount);
+		m_InternalFormat = (GLenum)internalFormat;
+		m_DataFormat = internalFormat == GL_RGB8 ? GL_RGB : GL_RGBA;
+		m_Compressed = compressed == GL_TRUE;
+		m_MipCount = mipCount > 0 ? (uint32_t)mipCount : 1;
 	}
 	OpenGLTexture2D::OpenGLTexture2D(const char* path)
 	{
@@ -111,12 +124,14 @@ namespace API::RenderingAPI
 			stbi_image_free(data);
 		}
 	}
-	OpenGLTexture2D::OpenGLTexture2D(Kargono::Buffer buffer, const Kargono::Assets::TextureMetaData& metadata)
+	OpenGLTexture2D::OpenGLTexture2D(const Kargono::Assets::TextureMetaData& metadata)
 	{
-		KG_ASSERT(buffer.Data, "Buffer does not have any valid data to input into Texture2D!");
+		KG_ASSERT(metadata.MipCount > 0, "Texture intermediate does not contain any mip levels!");
 
 		m_Width = metadata.Width;
 		m_Height = metadata.Height;
+		m_BaseMipLevel = metadata.MipCount - 1;
+		m_MipCount = metadata.MipCount;
 
 		GLenum internalFormat = 0, dataFormat = 0;
 		if (metadata.Channels == 4)
@@ -130,22 +145,37 @@ namespace API::RenderingAPI
 			dataFormat = GL_RGB;
 		}
 
+		switch (metadata.Compression)
+		{
+		case Kargono::Assets::TextureCompression::BC1:
+			internalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+			m_Compressed = true;
+			break;
+		case Kargono::Assets::TextureCompression::BC7:
+			internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM;
+			m_Compressed = true;
+			break;
+		case Kargono::Assets::TextureCompression::None:
+			break;
+		}
+
 		m_InternalFormat = internalFormat;
 		m_DataFormat = dataFormat;
 
 		KG_ASSERT(internalFormat & dataFormat, "Format not supported!");
 
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-		glTextureStorage2D(m_RendererID, 1, internalFormat, m_Width, m_Height);
+		glTextureStorage2D(m_RendererID, metadata.MipCount, internalFormat, m_Width, m_Height);
 
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, metadata.MipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE,
-			buffer.As<unsigned char>());
+		// Only sample levels that hold data
+		glTextureParameteri(m_RendererID, GL_TEXTURE_BASE_LEVEL, m_BaseMipLevel);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAX_LEVEL, metadata.MipCount - 1);
 	}
 
 	OpenGLTexture2D::~OpenGLTexture2D()
@@ -154,14 +184,93 @@ namespace API::RenderingAPI
 	}
 	void OpenGLTexture2D::SetData(void* data, uint32_t size)
 	{
+		KG_ASSERT(!m_Compressed, "SetData does not support compressed textures!");
 		const uint32_t bytesPerPixel = m_DataFormat == GL_RGBA ? 4 : 3;
 		KG_ASSERT(size == m_Width * m_Height * bytesPerPixel, "Data must be entire texture!");
 		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+		m_DataVersion++;
+	}
+	void OpenGLTexture2D::SetMipData(uint32_t level, const void* data, uint64_t size)
+	{
+		uint32_t levelWidth = std::max(m_Width >> level, 1u);
+		uint32_t levelHeight = std::max(m_Height >> level, 1u);
+		if (m_Compressed)
+		{
+			glCompressedTextureSubImage2D(m_RendererID, level, 0, 0, levelWidth, levelHeight, m_InternalFormat,
+				(GLsizei)size, data);
+		}
+		else
+		{
+			const uint32_t bytesPerPixel = m_DataFormat == GL_RGBA ? 4 : 3;
+			KG_ASSERT(size == (uint64_t)levelWidth * levelHeight * bytesPerPixel, "Data must be entire mip level!");
+			// Rows of small RGB levels are not four byte aligned
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTextureSubImage2D(m_RendererID, level, 0, 0, levelWidth, levelHeight, m_DataFormat, GL_UNSIGNED_BYTE, data);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		}
+
+		if (level < m_BaseMipLevel)
+		{
+			m_BaseMipLevel = level;
+			glTextureParameteri(m_RendererID, GL_TEXTURE_BASE_LEVEL, m_BaseMipLevel);
+		}
+		m_DataVersion++;
 	}
 	void OpenGLTexture2D::Bind(uint32_t slot) const
 	{
 		glBindTextureUnit(slot, m_RendererID);
 	}
+
+	OpenGLTexture2DArray::OpenGLTexture2DArray(const Kargono::Rendering::TextureArrayFormat& format, uint32_t layerCount)
+		: m_Format(format), m_LayerCount(layerCount)
+	{
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_RendererID);
+		glTextureStorage3D(m_RendererID, m_Format.m_MipCount, m_Format.m_StorageFormat, m_Format.m_Width, m_Format.m_Height, m_LayerCount);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, m_Format.m_MipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	}
+	OpenGLTexture2DArray::~OpenGLTexture2DArray()
+	{
+		glDeleteTextures(1, &m_RendererID);
+	}
+	void OpenGLTexture2DArray::CopyLayerFromTexture(const Kargono::Rendering::Texture2D& source, uint32_t layer, uint32_t firstLevel)
+	{
+		KG_ASSERT(source.GetArrayFormat() == m_Format, "Texture format does not match the texture array!");
+		KG_ASSERT(layer < m_LayerCount, "Invalid layer provided to texture array!");
+		for (uint32_t level{ firstLevel }; level < m_Format.m_MipCount; level++)
+		{
+			uint32_t levelWidth = std::max(m_Format.m_Width >> level, 1u);
+			uint32_t levelHeight = std::max(m_Format.m_Height >> level, 1u);
+			glCopyImageSubData(source.GetRendererID(), GL_TEXTURE_2D, level, 0, 0, 0,
+				m_RendererID, GL_TEXTURE_2D_ARRAY, level, 0, 0, layer,
+				levelWidth, levelHeight, 1);
+		}
+	}
+	void OpenGLTexture2DArray::CopyLayersFromArray(const Kargono::Rendering::Texture2DArray& source, uint32_t layerCount)
+	{
+		KG_ASSERT(source.GetFormat() == m_Format, "Texture array formats do not match!");
+		KG_ASSERT(layerCount <= m_LayerCount && layerCount <= source.GetLayerCount(), "Invalid layer count provided to texture array copy!");
+		if (layerCount == 0)
+		{
+			return;
+		}
+		for (uint32_t level{ 0 }; level < m_Format.m_MipCount; level++)
+		{
+			uint32_t levelWidth = std::max(m_Format.m_Width >> level, 1u);
+			uint32_t levelHeight = std::max(m_Format.m_Height >> level, 1u);
+			glCopyImageSubData(source.GetRendererID(), GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+				m_RendererID, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+				levelWidth, levelHeight, layerCount);
+		}
+	}
+	void OpenGLTexture2DArray::Bind(uint32_t slot) const
+	{
+		glBindTextureUnit(slot, m_RendererID);
+	}
 }
 
 
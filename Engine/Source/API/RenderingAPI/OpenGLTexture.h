@@ -35,10 +35,10 @@ namespace API::RenderingAPI
 		// This constructor instantiates a texture directly from a filepath. This functionality
 		//		is mainly used for the editor logos.
 		OpenGLTexture2D(const char* path);
-		// This constructor takes an intermediate byte buffer and it's associated metadata
-		//		to instantiate a texture. This is the main way to create a texture through the
-		//		asset system.
-		OpenGLTexture2D(Kargono::Buffer buffer, const Kargono::Assets::TextureMetaData& metadata);
+		// This constructor allocates storage for every mip level described by an intermediate's
+		//		metadata. No level holds data yet, so levels must be provided through SetMipData().
+		//		This is the main way to create a texture through the asset system.
+		OpenGLTexture2D(const Kargono::Assets::TextureMetaData& metadata);
 
 		// This destructor simply deletes the texture inside the OpenGL context.
 		virtual ~OpenGLTexture2D();
@@ -58,6 +58,10 @@ namespace API::RenderingAPI
 		// This function allows new data to be pushed into the OpenGL texture.
 		//		The size of the data buffer must match the size of the texture.
 		virtual void SetData(void* data, uint32_t size) override;
+		// This function uploads a single mip level in the texture's intermediate format. Levels
+		//		must be uploaded from the smallest to the largest, since the texture only samples
+		//		from the largest level uploaded so far down to the smallest level.
+		virtual void SetMipData(uint32_t level, const void* data, uint64_t size) override;
 
 		//==============================
 		// Getters/Setters
@@ -66,6 +70,12 @@ namespace API::RenderingAPI
 		virtual uint32_t GetWidth() const override { return m_Width; }
 		virtual uint32_t GetHeight() const override { return m_Height; }
 		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+		virtual Kargono::Rendering::TextureArrayFormat GetArrayFormat() const override
+		{
+			return { m_InternalFormat, m_Width, m_Height, m_MipCount };
+		}
+		virtual uint32_t GetBaseMipLevel() const override { return m_BaseMipLevel; }
+		virtual uint32_t GetDataVersion() const override { return m_DataVersion; }
 
 
 		//==============================
@@ -83,7 +93,54 @@ namespace API::RenderingAPI
 		//		will use this ID.
 		uint32_t m_RendererID;
 		// These internal formats are for debugging purposes. This will get refactored later.
-		GLenum m_InternalFormat, m_DataFormat;
+		GLenum m_InternalFormat{ 0 }, m_DataFormat{ 0 };
+		// m_BaseMipLevel is the largest mip level that currently holds data and m_Compressed
+		//		indicates whether the texture's levels are block compressed.
+		uint32_t m_BaseMipLevel{ 0 };
+		bool m_Compressed{ false };
+		// m_MipCount is the number of levels allocated for the texture and m_DataVersion counts
+		//		uploads, so copies of the texture inside texture arrays can be refreshed.
+		uint32_t m_MipCount{ 1 };
+		uint32_t m_DataVersion{ 0 };
+	};
+
+	//============================================================
+	// OpenGL Texture Array Class
+	//============================================================
+	// This class represents an OpenGL 2D array texture with immutable storage. Layers are filled by
+	//		copying the levels of other textures on the GPU, so no data is read back to the CPU.
+	class OpenGLTexture2DArray : public Kargono::Rendering::Texture2DArray
+	{
+	public:
+		//==============================
+		// Constructors and Destructors
+		//==============================
+		// This constructor allocates every mip level of every layer. The layers hold no data yet.
+		OpenGLTexture2DArray(const Kargono::Rendering::TextureArrayFormat& format, uint32_t layerCount);
+		// This destructor simply deletes the array texture inside the OpenGL context.
+		virtual ~OpenGLTexture2DArray();
+
+		//==============================
+		// Update OpenGL Context
+		//==============================
+		virtual void CopyLayerFromTexture(const Kargono::Rendering::Texture2D& source, uint32_t layer, uint32_t firstLevel) override;
+		virtual void CopyLayersFromArray(const Kargono::Rendering::Texture2DArray& source, uint32_t layerCount) override;
+
+		//==============================
+		// Binding Functionality
+		//==============================
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		//==============================
+		// Getters/Setters
+		//==============================
+		virtual const Kargono::Rendering::TextureArrayFormat& GetFormat() const override { return m_Format; }
+		virtual uint32_t GetLayerCount() const override { return m_LayerCount; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+	private:
+		Kargono::Rendering::TextureArrayFormat m_Format{};
+		uint32_t m_LayerCount{ 0 };
+		uint32_t m_RendererID{ 0 };
 	};
 }
 
@@ -49,6 +49,14 @@ namespace API::RenderingAPI
 		glBindVertexArray(0);
 	}
 	void OpenGLVertexArray::AddVertexBuffer(const Kargono::Ref<Kargono::Rendering::VertexBuffer>& vertexBuffer)
+	{
+		AddBufferElements(vertexBuffer, false);
+	}
+	void OpenGLVertexArray::AddInstanceBuffer(const Kargono::Ref<Kargono::Rendering::VertexBuffer>& instanceBuffer)
+	{
+		AddBufferElements(instanceBuffer, true);
+	}
+	void OpenGLVertexArray::AddBufferElements(const Kargono::Ref<Kargono::Rendering::VertexBuffer>& vertexBuffer, bool perInstance)
 	{
 		KG_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 
@@ -74,6 +82,10 @@ namespace API::RenderingAPI
 					element.Normalized ? GL_TRUE : GL_FALSE,
 					layout.GetStride(),
 					(const void*)element.Offset);
+				if (perInstance)
+				{
+					glVertexAttribDivisor(m_VertexBufferIndex, 1);
+				}
 				m_VertexBufferIndex++;
 				break;
 			}
@@ -89,6 +101,10 @@ namespace API::RenderingAPI
 					Utility::ShaderDataTypeToOpenGLBaseType(element.Type),
 					layout.GetStride(),
 					(const void*)element.Offset);
+				if (perInstance)
+				{
+					glVertexAttribDivisor(m_VertexBufferIndex, 1);
+				}
 				m_VertexBufferIndex++;
 				break;
 			}
@@ -45,6 +45,9 @@ namespace API::RenderingAPI
 		//		elements inside the vertexBuffer's layout individually to the vertex array, and adding the
 		//		new vertexBuffer to m_VertexBuffers.
 		virtual void AddVertexBuffer(const Kargono::Ref<Kargono::Rendering::VertexBuffer>& vertexBuffer) override;
+		// This function adds a vertex buffer whose elements advance once per instance (attribute divisor of 1)
+		//		rather than once per vertex. This allows one draw call to render many copies of the same shape.
+		virtual void AddInstanceBuffer(const Kargono::Ref<Kargono::Rendering::VertexBuffer>& instanceBuffer) override;
 		// This function adds the provided index buffer to both the m_IndexBuffer variable and associates
 		//		the indexBuffer with the underlying OpenGL vertex array
 		virtual void SetIndexBuffer(const Kargono::Ref<Kargono::Rendering::IndexBuffer>& indexBuffer) override;
@@ -54,6 +57,9 @@ namespace API::RenderingAPI
 		//==============================
 		virtual const std::vector<Kargono::Ref<Kargono::Rendering::VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
 		virtual const Kargono::Ref<Kargono::Rendering::IndexBuffer>& GetIndexBuffer() const  override { return m_IndexBuffer; }
+	private:
+		// Associates every element inside the buffer's layout with the vertex array
+		void AddBufferElements(const Kargono::Ref<Kargono::Rendering::VertexBuffer>& vertexBuffer, bool perInstance);
 	private:
 		// m_VertexBuffers holds the in-engine representations of the vertexBuffers associated with this vertex array
 		std::vector<Kargono::Ref<Kargono::Rendering::VertexBuffer>> m_VertexBuffers;
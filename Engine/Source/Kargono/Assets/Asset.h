@@ -63,6 +63,20 @@ namespace Kargono::Assets
 		AssetType::UserInterface
 	};
 
+	//==============================
+	// Import Source Struct
+	//==============================
+	// Records the external file an imported asset's intermediate was built from. The file size
+	//		and write time allow unchanged files to be skipped without reading them, while the
+	//		content hash catches files that were touched but not modified.
+	struct ImportSource
+	{
+		std::filesystem::path Location{};
+		uint64_t ContentHash{ 0 };
+		uint64_t FileSize{ 0 };
+		int64_t WriteTime{ 0 };
+	};
+
 	//==============================
 	// Metadata Struct
 	//==============================
@@ -78,13 +92,15 @@ namespace Kargono::Assets
 	//		asset type in a generic sense. The SpecificFileData holds a reference to data
 	//		that is only needed by this specific type of asset. Ex: A texture might need
 	//		to know its width and height, while an audio file might need to know its sample
-	//		rate.
+	//		rate. Imported assets also record the ImportSource their intermediate was
+	//		built from.
 	struct Metadata
 	{
 	public:
 		std::filesystem::path FileLocation;
 		std::filesystem::path IntermediateLocation;
 		std::string CheckSum;
+		ImportSource Source;
 		Assets::AssetType Type = Assets::AssetType::None;
 		Ref<void> SpecificFileData { nullptr };
 	public:
@@ -102,16 +118,30 @@ namespace Kargono::Assets
 	//		type. These metadata structs are meant to be held inside the
 	//		metadata struct in the SpecificFileData Ref<void> pointer.
 
+	//==============================
+	// Texture Compression Enum
+	//==============================
+	// Block compression formats a texture intermediate can be stored in
+	enum class TextureCompression : uint8_t
+	{
+		None = 0, // Raw RGB8/RGBA8 pixels
+		BC1, // Opaque RGB, 4 bits per pixel
+		BC7 // RGBA, 8 bits per pixel
+	};
+
 	//==============================
 	// Texture MetaData Struct
 	//==============================
 	// This metadata struct mostly holds loading information for the intermediate to load correctly.
 	//		When the file is loaded from binary (Intermediate), it needs to know the
 	//		image's width, height, and number of channels to interpret the binary
-	//		correctly. The InitialFileLocation field is for debugging.
+	//		correctly. The intermediate holds MipCount levels stored from the smallest
+	//		level to the largest, each in the Compression format.
 	struct TextureMetaData
 	{
 		int32_t Width, Height, Channels;
+		TextureCompression Compression{ TextureCompression::None };
+		uint32_t MipCount{ 1 };
 	};
 
 	//==============================
@@ -306,4 +336,29 @@ namespace Kargono::Utility
 		KG_ERROR("Unknown Type of AssetType String.");
 		return Assets::AssetType::None;
 	}
+
+	//==============================
+	// TextureCompression <-> String Conversions
+	//==============================
+	inline const char* TextureCompressionToString(Assets::TextureCompression compression)
+	{
+		switch (compression)
+		{
+		case Assets::TextureCompression::None: return "None";
+		case Assets::TextureCompression::BC1: return "BC1";
+		case Assets::TextureCompression::BC7: return "BC7";
+		}
+		KG_ERROR("Unknown Type of TextureCompression.");
+		return "";
+	}
+
+	inline Assets::TextureCompression StringToTextureCompression(std::string_view compression)
+	{
+		if (compression == "None") { return Assets::TextureCompression::None; }
+		if (compression == "BC1") { return Assets::TextureCompression::BC1; }
+		if (compression == "BC7") { return Assets::TextureCompression::BC7; }
+
+		KG_ERROR("Unknown Type of TextureCompression String.");
+		return Assets::TextureCompression::None;
+	}
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "Kargono/Core/Base.h"
 #include "Kargono/Core/Engine.h"
+#include "Kargono/Core/JobSystem.h"
+#include "Kargono/Core/Buffer.h"
 #include "Kargono/Assets/Asset.h"
 #include "Kargono/Projects/Project.h"
 #include "Kargono/Utility/FileSystem.h"
@@ -10,6 +12,7 @@
 
 #include <bitset>
 #include <tuple>
+#include <atomic>
 
 enum AssetManagerOptions : uint8_t
 {
@@ -19,13 +22,58 @@ enum AssetManagerOptions : uint8_t
 	HasFileLocation = 3, // Specify that this asset manager stores a file somewhere in the project's Assets directory
 	HasFileImporting = 4, // Specify that this asset manager is capable of importing the asset into the system from an external file
 	HasAssetSaving = 5, // Specify that this asset manager is capable of saving to the underlying file data for it's type of asset
-	HasAssetCreationFromName = 6 // Specify that this asset manager is capable of creating the underlying file data for it's type of asset
+	HasAssetCreationFromName = 6, // Specify that this asset manager is capable of creating the underlying file data for it's type of asset
+	HasAsyncLoading = 7 // Specify that this asset manager can read its files on a worker thread and create the asset from the file data afterwards
 };
 
 namespace Kargono::Assets
 {
 	using AssetRegistry = std::unordered_map<AssetHandle, Assets::AssetInfo>;
 
+	//==============================
+	// Asset Residency Struct
+	//==============================
+	// Describes how much memory an asset manager's cache currently holds
+	struct AssetResidency
+	{
+		size_t m_CachedAssetCount{ 0 };
+		uint64_t m_MemoryUsage{ 0 };
+		// A budget of zero disables eviction
+		uint64_t m_MemoryBudget{ 0 };
+	};
+
+	template <typename AssetValue>
+	class AssetManager;
+
+	//==============================
+	// Asset Load Request Class
+	//==============================
+	// Tracks an asset requested through GetAssetAsync(). The asset is set on the main thread once it is
+	//		created, so check IsReady() before retrieving it.
+	template <typename AssetValue>
+	class AssetLoadRequest
+	{
+	public:
+		//==============================
+		// Getters/Setters
+		//==============================
+		AssetHandle GetHandle() const { return m_Handle; }
+		bool IsReady() const { return m_Ready.load(std::memory_order_acquire); }
+		Ref<AssetValue> GetAsset() const { return IsReady() ? m_Asset : nullptr; }
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		AssetHandle m_Handle{ EmptyHandle };
+		Ref<AssetValue> m_Asset{ nullptr };
+		std::atomic<bool> m_Ready{ false };
+		// File data read by a worker thread
+		std::filesystem::path m_AssetPath{};
+		Buffer m_FileData{};
+	private:
+		friend class AssetManager<AssetValue>;
+	};
+
 	template <typename AssetValue>
 	class AssetManager
 	{
@@ -47,9 +95,10 @@ namespace Kargono::Assets
 
 			if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 			{
-				if (m_AssetCache.contains(handle))
+				if (auto cacheIt = m_AssetCache.find(handle); cacheIt != m_AssetCache.end())
 				{
-					return m_AssetCache[handle];
+					TouchCachedAsset(handle);
+					return cacheIt->second;
 				}
 			}
 
@@ -63,7 +112,7 @@ namespace Kargono::Assets
 				Ref<AssetValue> newAsset = DeserializeAsset(asset, assetPath);
 				if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 				{
-					m_AssetCache.insert({ asset.m_Handle, newAsset });
+					AddToAssetCache(asset.m_Handle, newAsset);
 				}
 				return newAsset;
 			}
@@ -73,6 +122,50 @@ namespace Kargono::Assets
 			return nullptr;
 		}
 
+		// Reads the asset's file on a worker thread and creates the asset on the main thread afterwards.
+		//		Must be called from the main thread. Assets that are already cached or whose manager does
+		//		not support async loading are returned in a request that is ready immediately.
+		Ref<AssetLoadRequest<AssetValue>> GetAssetAsync(AssetHandle handle)
+		{
+			KG_ASSERT(Projects::ProjectService::GetActive(), "There is no active project when retrieving asset!");
+
+			// Share the request of an asset that is already loading
+			if (auto pendingIt = m_PendingLoads.find(handle); pendingIt != m_PendingLoads.end())
+			{
+				return pendingIt->second;
+			}
+
+			Ref<AssetLoadRequest<AssetValue>> request = CreateRef<AssetLoadRequest<AssetValue>>();
+			request->m_Handle = handle;
+			if (!m_Flags.test(AssetManagerOptions::HasAsyncLoading) || !m_AssetRegistry.contains(handle) ||
+				m_AssetCache.contains(handle))
+			{
+				request->m_Asset = GetAsset(handle);
+				request->m_Ready.store(true, std::memory_order_release);
+				return request;
+			}
+			KG_ASSERT(m_Flags.test(AssetManagerOptions::HasAssetCache), "Async loading requires an asset cache");
+
+			AssetInfo& asset = m_AssetRegistry.at(handle);
+			request->m_AssetPath =
+				(m_Flags.test(AssetManagerOptions::HasIntermediateLocation) ?
+					Projects::ProjectService::GetActiveIntermediateDirectory() / asset.Data.IntermediateLocation :
+					Projects::ProjectService::GetActiveAssetDirectory() / asset.Data.FileLocation);
+			m_PendingLoads.insert({ handle, request });
+
+			// Creating the asset may require the rendering or audio context, so only the file read is
+			//		done on the worker
+			JobService::SubmitJob([this, request]()
+			{
+				request->m_FileData = Utility::FileSystem::ReadFileBinary(request->m_AssetPath);
+				EngineService::SubmitToMainThread([this, request]()
+				{
+					FinishAssetLoad(request);
+				});
+			});
+			return request;
+		}
+
 		std::tuple<AssetHandle, Ref<AssetValue>> GetAsset(const std::filesystem::path& fileLocation)
 		{
 			KG_ASSERT(Projects::ProjectService::GetActive(), "Attempt to use Project Field without active project!");
@@ -179,7 +272,8 @@ namespace Kargono::Assets
 			// Update in memory asset if applicable
 			if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 			{
-				m_AssetCache.at(assetHandle) = assetReference;
+				RemoveFromAssetCache(assetHandle);
+				AddToAssetCache(assetHandle, assetReference);
 			}
 
 			// Save asset data on-disk
@@ -244,7 +338,7 @@ namespace Kargono::Assets
 			// Delete in-memory copy of this asset
 			if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 			{
-				m_AssetCache.erase(assetHandle);
+				RemoveFromAssetCache(assetHandle);
 			}
 
 			// Save the modified registry to disk
@@ -267,8 +361,11 @@ namespace Kargono::Assets
 			if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 			{
 				m_AssetCache.clear();
+				m_CacheUsage.clear();
+				m_CacheMemoryUsage = 0;
 			}
 			m_AssetRegistry.clear();
+			m_PendingLoads.clear();
 		}
 
 		AssetHandle CreateAsset(const char* assetName, const std::filesystem::path& creationPath)
@@ -339,7 +436,7 @@ namespace Kargono::Assets
 			// Fill in-memory cache if appropriate
 			if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 			{
-				m_AssetCache.insert({ newHandle, DeserializeAsset(newAsset, Projects::ProjectService::GetActiveAssetDirectory() / newAsset.Data.FileLocation) });
+				AddToAssetCache(newHandle, DeserializeAsset(newAsset, Projects::ProjectService::GetActiveAssetDirectory() / newAsset.Data.FileLocation));
 			}
 
 			Ref<Events::ManageAsset> event = CreateRef<Events::ManageAsset>
@@ -476,6 +573,12 @@ namespace Kargono::Assets
 				newAsset.Data.IntermediateLocation = Utility::FileSystem::ConvertToUnixStylePath(m_RegistryLocation.parent_path() / ((std::string)newAsset.m_Handle + m_IntermediateExtension.CString()));
 				CreateAssetIntermediateFromFile(newAsset, sourcePath, Projects::ProjectService::GetActiveIntermediateDirectory() / newAsset.Data.IntermediateLocation);
 				newAsset.Data.CheckSum = currentCheckSum;
+
+				// Remember the source file, so the intermediate can be rebuilt when it changes
+				if (!ReadImportSource(sourcePath, newAsset.Data.Source))
+				{
+					KG_WARN("Failed to record the import source of {} asset at {}", m_AssetName, sourcePath.string());
+				}
 			}
 			else
 			{
@@ -495,7 +598,7 @@ namespace Kargono::Assets
 			// Fill in-memory cache if appropriate
 			if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 			{
-				m_AssetCache.insert({ newHandle, DeserializeAsset(newAsset, assetPath) });
+				AddToAssetCache(newHandle, DeserializeAsset(newAsset, assetPath));
 			}
 
 			Ref<Events::ManageAsset> event = CreateRef<Events::ManageAsset>
@@ -507,6 +610,113 @@ namespace Kargono::Assets
 			EngineService::SubmitToEventQueue(event);
 			return newHandle;
 		}
+		// Rebuilds the intermediates of imported assets whose source file changed since it was imported.
+		//		Files with an unchanged size and write time are skipped without being read. The remaining
+		//		files are hashed and rebuilt in parallel. Returns the number of rebuilt assets.
+		size_t ReimportChangedAssets()
+		{
+			KG_ASSERT(m_Flags.test(AssetManagerOptions::HasFileImporting), "Attempt to reimport assets for a file type that does not support importing");
+			KG_ASSERT(m_Flags.test(AssetManagerOptions::HasIntermediateLocation));
+
+			struct ReimportEntry
+			{
+				AssetInfo m_Asset{};
+				ImportSource m_Source{};
+				bool m_SourceModified{ false };
+				bool m_Rebuilt{ false };
+			};
+
+			// Gather every asset that was imported from a recorded source file
+			std::vector<ReimportEntry> entries;
+			for (const auto& [handle, asset] : m_AssetRegistry)
+			{
+				if (!asset.Data.Source.Location.empty())
+				{
+					entries.push_back({ asset, asset.Data.Source });
+				}
+			}
+
+			// Check and rebuild sources across the job system. Workers only touch their own entry.
+			const std::filesystem::path assetDirectory = Projects::ProjectService::GetActiveAssetDirectory();
+			const std::filesystem::path intermediateDirectory = Projects::ProjectService::GetActiveIntermediateDirectory();
+			JobService::ParallelFor(entries.size(), 1, [&](size_t begin, size_t end)
+			{
+				for (size_t index{ begin }; index < end; index++)
+				{
+					ReimportEntry& entry = entries[index];
+					const ImportSource& previousSource = entry.m_Asset.Data.Source;
+					const std::filesystem::path sourcePath = previousSource.Location.is_absolute() ?
+						previousSource.Location : assetDirectory / previousSource.Location;
+
+					// Sources outside of the project may not exist on every machine
+					if (!Utility::FileSystem::GetFileStamp(sourcePath, entry.m_Source.FileSize, entry.m_Source.WriteTime))
+					{
+						continue;
+					}
+					if (entry.m_Source.FileSize == previousSource.FileSize && entry.m_Source.WriteTime == previousSource.WriteTime)
+					{
+						continue;
+					}
+
+					// The file was touched, so only rebuild if its contents differ
+					entry.m_SourceModified = true;
+					entry.m_Source.ContentHash = Utility::FileSystem::FastHashFromFile(sourcePath);
+					if (entry.m_Source.ContentHash == previousSource.ContentHash)
+					{
+						continue;
+					}
+					CreateAssetIntermediateFromFile(entry.m_Asset, sourcePath, intermediateDirectory / entry.m_Asset.Data.IntermediateLocation);
+					entry.m_Asset.Data.CheckSum = Utility::FileSystem::ChecksumFromFile(sourcePath);
+					entry.m_Rebuilt = true;
+				}
+			});
+
+			// Apply the results to the registry
+			size_t rebuiltCount{ 0 };
+			bool registryModified{ false };
+			for (ReimportEntry& entry : entries)
+			{
+				if (!entry.m_SourceModified)
+				{
+					continue;
+				}
+				registryModified = true;
+				AssetInfo& asset = m_AssetRegistry.at(entry.m_Asset.m_Handle);
+				asset.Data.Source = entry.m_Source;
+				if (!entry.m_Rebuilt)
+				{
+					continue;
+				}
+				asset.Data.CheckSum = entry.m_Asset.Data.CheckSum;
+				asset.Data.SpecificFileData = entry.m_Asset.Data.SpecificFileData;
+
+				// Drop the stale in-memory copy
+				if (m_Flags.test(AssetManagerOptions::HasAssetCache))
+				{
+					RemoveFromAssetCache(asset.m_Handle);
+				}
+
+				Ref<Events::ManageAsset> event = CreateRef<Events::ManageAsset>
+				(
+					asset.m_Handle,
+					asset.Data.Type,
+					Events::ManageAssetAction::UpdateAsset
+				);
+				EngineService::SubmitToEventQueue(event);
+				rebuiltCount++;
+			}
+
+			if (registryModified)
+			{
+				SerializeAssetRegistry();
+			}
+			if (rebuiltCount > 0)
+			{
+				KG_INFO("Reimported {} changed {} assets", rebuiltCount, m_AssetName);
+			}
+			return rebuiltCount;
+		}
+
 		void SerializeAssetRegistry()
 		{
 			// Get registry path
@@ -541,6 +751,17 @@ namespace Kargono::Assets
 				}
 				serializer << YAML::Key << "AssetType" << YAML::Value << Utility::AssetTypeToString(asset.Data.Type);
 
+				if (!asset.Data.Source.Location.empty())
+				{
+					serializer << YAML::Key << "ImportSource" << YAML::Value;
+					serializer << YAML::BeginMap; // ImportSource Map
+					serializer << YAML::Key << "Location" << YAML::Value << asset.Data.Source.Location.string();
+					serializer << YAML::Key << "ContentHash" << YAML::Value << asset.Data.Source.ContentHash;
+					serializer << YAML::Key << "FileSize" << YAML::Value << asset.Data.Source.FileSize;
+					serializer << YAML::Key << "WriteTime" << YAML::Value << asset.Data.Source.WriteTime;
+					serializer << YAML::EndMap; // Close ImportSource map
+				}
+
 				SerializeAssetSpecificMetadata(serializer, asset);
 				
 				serializer << YAML::EndMap; // Close metadata map
@@ -614,6 +835,15 @@ namespace Kargono::Assets
 						newAsset.Data.IntermediateLocation = metadata["IntermediateLocation"].as<std::string>();
 					}
 
+					// Open import source (only present for imported assets)
+					if (YAML::Node importSource = metadata["ImportSource"])
+					{
+						newAsset.Data.Source.Location = importSource["Location"].as<std::string>();
+						newAsset.Data.Source.ContentHash = importSource["ContentHash"].as<uint64_t>();
+						newAsset.Data.Source.FileSize = importSource["FileSize"].as<uint64_t>();
+						newAsset.Data.Source.WriteTime = importSource["WriteTime"].as<int64_t>();
+					}
+
 					// Open registry specific metadata
 					DeserializeAssetSpecificMetadata(metadata, newAsset);
 
@@ -649,7 +879,7 @@ namespace Kargono::Assets
 				Ref<AssetValue> newAsset = DeserializeAsset(assetInfo, assetPath);
 
 				// Insert the asset into the cache
-				m_AssetCache.insert({ assetInfo.m_Handle, newAsset });
+				AddToAssetCache(assetInfo.m_Handle, newAsset);
 				
 			}
 		}
@@ -727,6 +957,24 @@ namespace Kargono::Assets
 			return m_AssetCache;
 		}
 
+		// Cached assets that exceed the budget are evicted, least recently used first. Assets that are
+		//		still referenced outside of the cache are never evicted.
+		void SetCacheMemoryBudget(uint64_t memoryBudget)
+		{
+			m_CacheMemoryBudget = memoryBudget;
+			EvictCachedAssets();
+		}
+
+		AssetResidency GetCacheResidency() const
+		{
+			return { m_AssetCache.size(), m_CacheMemoryUsage, m_CacheMemoryBudget };
+		}
+
+		bool IsAssetResident(AssetHandle handle) const
+		{
+			return m_AssetCache.contains(handle);
+		}
+
 		std::size_t GetAssetRegistrySize()
 		{
 			return m_AssetRegistry.size();
@@ -780,6 +1028,19 @@ namespace Kargono::Assets
 			UNREFERENCED_PARAMETER(assetHandle);
 		};
 		virtual Ref<AssetValue> DeserializeAsset(Assets::AssetInfo& asset, const std::filesystem::path& assetPath) = 0;
+		virtual Ref<AssetValue> CreateAssetFromFileData(Assets::AssetInfo& asset, Buffer fileData)
+		{
+			UNREFERENCED_PARAMETER(asset);
+			UNREFERENCED_PARAMETER(fileData);
+			KG_ERROR("Attempt to create an asset from file data that does not override the base class's implementation of CreateAssetFromFileData()");
+			return nullptr;
+		}
+		// Returns the number of bytes a loaded asset occupies, used to keep the cache within its budget
+		virtual uint64_t GetAssetMemoryCost(Assets::AssetInfo& asset)
+		{
+			UNREFERENCED_PARAMETER(asset);
+			return 0;
+		}
 		virtual void SerializeRegistrySpecificData(YAML::Emitter& serializer) 
 		{
 			UNREFERENCED_PARAMETER(serializer);
@@ -805,6 +1066,122 @@ namespace Kargono::Assets
 			UNREFERENCED_PARAMETER(fullIntermediateLocation);
 		};
 		
+	private:
+		// Records the location, size, write time, and content hash of an imported file. Files inside the
+		//		asset directory are stored relative to it, so the record survives moving the project.
+		static bool ReadImportSource(const std::filesystem::path& sourcePath, ImportSource& source)
+		{
+			const std::filesystem::path absoluteSourcePath = Utility::FileSystem::GetAbsolutePath(sourcePath);
+			if (!Utility::FileSystem::GetFileStamp(absoluteSourcePath, source.FileSize, source.WriteTime))
+			{
+				return false;
+			}
+			source.ContentHash = Utility::FileSystem::FastHashFromFile(absoluteSourcePath);
+
+			const std::filesystem::path assetDirectory = Projects::ProjectService::GetActiveAssetDirectory();
+			if (Utility::FileSystem::DoesPathContainSubPath(assetDirectory, absoluteSourcePath))
+			{
+				source.Location = Utility::FileSystem::ConvertToUnixStylePath(Utility::FileSystem::GetRelativePath(assetDirectory, absoluteSourcePath));
+			}
+			else
+			{
+				source.Location = Utility::FileSystem::ConvertToUnixStylePath(absoluteSourcePath);
+			}
+			return true;
+		}
+
+		void FinishAssetLoad(Ref<AssetLoadRequest<AssetValue>> request)
+		{
+			AssetHandle handle{ request->m_Handle };
+			if (m_AssetCache.contains(handle))
+			{
+				// The asset was loaded some other way while the file was being read
+				request->m_Asset = m_AssetCache.at(handle);
+				TouchCachedAsset(handle);
+			}
+			else if (m_AssetRegistry.contains(handle) && request->m_FileData)
+			{
+				request->m_Asset = CreateAssetFromFileData(m_AssetRegistry.at(handle), request->m_FileData);
+				AddToAssetCache(handle, request->m_Asset);
+			}
+			else
+			{
+				KG_WARN("Failed to asynchronously load {} asset with handle {}", m_AssetName, handle);
+			}
+			request->m_FileData.Release();
+
+			// The registry may have been cleared and the asset requested again since this request was made
+			if (auto pendingIt = m_PendingLoads.find(handle); pendingIt != m_PendingLoads.end() && pendingIt->second == request)
+			{
+				m_PendingLoads.erase(pendingIt);
+			}
+			request->m_Ready.store(true, std::memory_order_release);
+		}
+	protected:
+		//==============================
+		// Manage Asset Cache
+		//==============================
+		void AddToAssetCache(AssetHandle handle, Ref<AssetValue> asset)
+		{
+			RemoveFromAssetCache(handle);
+			m_AssetCache.insert({ handle, asset });
+
+			uint64_t memoryCost{ m_AssetRegistry.contains(handle) ? GetAssetMemoryCost(m_AssetRegistry.at(handle)) : 0 };
+			m_CacheUsage.insert({ handle, { memoryCost, ++m_CacheAccessCount } });
+			m_CacheMemoryUsage += memoryCost;
+			EvictCachedAssets();
+		}
+
+		void RemoveFromAssetCache(AssetHandle handle)
+		{
+			if (auto usageIt = m_CacheUsage.find(handle); usageIt != m_CacheUsage.end())
+			{
+				m_CacheMemoryUsage -= usageIt->second.m_MemoryCost;
+				m_CacheUsage.erase(usageIt);
+			}
+			m_AssetCache.erase(handle);
+		}
+
+		void TouchCachedAsset(AssetHandle handle)
+		{
+			if (auto usageIt = m_CacheUsage.find(handle); usageIt != m_CacheUsage.end())
+			{
+				usageIt->second.m_LastAccess = ++m_CacheAccessCount;
+			}
+		}
+
+		void EvictCachedAssets()
+		{
+			if (m_CacheMemoryBudget == 0 || m_CacheMemoryUsage <= m_CacheMemoryBudget)
+			{
+				return;
+			}
+
+			// Only the cache holds a reference to eviction candidates
+			std::vector<std::pair<uint64_t, AssetHandle>> candidates{};
+			for (auto& [handle, usage] : m_CacheUsage)
+			{
+				if (usage.m_MemoryCost > 0 && m_AssetCache.at(handle).use_count() <= 1)
+				{
+					candidates.push_back({ usage.m_LastAccess, handle });
+				}
+			}
+			std::sort(candidates.begin(), candidates.end());
+
+			for (auto& [lastAccess, handle] : candidates)
+			{
+				if (m_CacheMemoryUsage <= m_CacheMemoryBudget)
+				{
+					break;
+				}
+				RemoveFromAssetCache(handle);
+			}
+
+			if (m_CacheMemoryUsage > m_CacheMemoryBudget)
+			{
+				KG_WARN("{} cache uses {} bytes, which exceeds its budget of {} bytes", m_AssetName, m_CacheMemoryUsage, m_CacheMemoryBudget);
+			}
+		}
 	protected:
 		std::string m_AssetName{ "Uninitialized Asset Name" };
 		FixedString16 m_FileExtension { ".kgfile" };
@@ -814,6 +1191,18 @@ namespace Kargono::Assets
 		std::vector<std::string> m_ValidImportFileExtensions{};
 		std::unordered_map<AssetHandle, Assets::AssetInfo> m_AssetRegistry{};
 		std::unordered_map<AssetHandle, Ref<AssetValue>> m_AssetCache{};
+		// Memory accounting for the asset cache
+		struct CachedAssetUsage
+		{
+			uint64_t m_MemoryCost{ 0 };
+			uint64_t m_LastAccess{ 0 };
+		};
+		std::unordered_map<AssetHandle, CachedAssetUsage> m_CacheUsage{};
+		uint64_t m_CacheMemoryUsage{ 0 };
+		uint64_t m_CacheMemoryBudget{ 0 };
+		uint64_t m_CacheAccessCount{ 0 };
+		// Requests from GetAssetAsync() that have not finished yet
+		std::unordered_map<AssetHandle, Ref<AssetLoadRequest<AssetValue>>> m_PendingLoads{};
 		std::bitset<8> m_Flags {0b00000000};
 	};
 }
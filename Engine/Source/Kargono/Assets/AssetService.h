@@ -27,6 +27,10 @@
 		{\
 			return s_AssetsContext.m_##typeName##Manager.GetAsset(handle); \
 		}\
+		static Ref<AssetLoadRequest<typeNamespace::typeName>> Get##typeName##Async(AssetHandle handle) \
+		{\
+			return s_AssetsContext.m_##typeName##Manager.GetAssetAsync(handle); \
+		}\
 		static std::tuple<AssetHandle, Ref<typeNamespace::typeName>> Get##typeName(const std::filesystem::path& fileLocation) \
 		{\
 			return s_AssetsContext.m_##typeName##Manager.GetAsset(fileLocation); \
@@ -91,6 +95,18 @@
 		{\
 			return s_AssetsContext.m_##typeName##Manager.GetAssetCache(); \
 		}\
+		static void Set##typeName##MemoryBudget(uint64_t memoryBudget) \
+		{\
+			s_AssetsContext.m_##typeName##Manager.SetCacheMemoryBudget(memoryBudget); \
+		}\
+		static AssetResidency Get##typeName##Residency() \
+		{\
+			return s_AssetsContext.m_##typeName##Manager.GetCacheResidency(); \
+		}\
+		static bool Is##typeName##Resident(AssetHandle handle) \
+		{\
+			return s_AssetsContext.m_##typeName##Manager.IsAssetResident(handle); \
+		}\
 		static const std::vector<std::string>& Get##typeName##ValidImportExtensions()\
 		{\
 			return s_AssetsContext.m_##typeName##Manager.GetAssetValidImportExtensions(); \
@@ -110,6 +126,10 @@
 		static AssetHandle Import##typeName##FromFile(const std::filesystem::path& sourcePath, const char* newFileName, const std::filesystem::path& destinationPath) \
 		{\
 			return s_AssetsContext.m_##typeName##Manager.ImportAssetFromFile(sourcePath, newFileName, destinationPath); \
+		}\
+		static size_t Reimport##typeName##ChangedAssets() \
+		{\
+			return s_AssetsContext.m_##typeName##Manager.ReimportChangedAssets(); \
 		}
 
 
@@ -236,6 +256,23 @@ namespace Kargono::Assets
 			return s_AssetsContext.m_SceneManager.RemoveEmitterConfig(sceneRef, emitterConfigHandle);
 		}
 
+		static Ref<ScenePreload> CreateScenePreload(AssetHandle sceneHandle)
+		{
+			return s_AssetsContext.m_SceneManager.CreateScenePreload(sceneHandle);
+		}
+		static void LoadScenePreloadEntities(ScenePreload& preload)
+		{
+			s_AssetsContext.m_SceneManager.LoadScenePreloadEntities(preload);
+		}
+		static bool LoadScenePreloadAssets(ScenePreload& preload, size_t maxAssetCount)
+		{
+			return s_AssetsContext.m_SceneManager.LoadScenePreloadAssets(preload, maxAssetCount);
+		}
+		static Ref<Scenes::Scene> FinishScenePreload(ScenePreload& preload)
+		{
+			return s_AssetsContext.m_SceneManager.FinishScenePreload(preload);
+		}
+
 		
 
 		// Deserializes all registries into memory
@@ -256,6 +293,21 @@ namespace Kargono::Assets
 			DeserializeUserInterfaceRegistry();
 			DeserializeAIStateRegistry();
 			DeserializeSceneRegistry();
+
+			// Apply the project's cache budgets
+			SetTexture2DMemoryBudget(Projects::ProjectService::GetActiveTextureMemoryBudget());
+			SetAudioBufferMemoryBudget(Projects::ProjectService::GetActiveAudioMemoryBudget());
+			SetFontMemoryBudget(Projects::ProjectService::GetActiveFontMemoryBudget());
+		}
+
+		// Rebuilds the intermediates of every imported asset whose source file changed
+		static size_t ReimportChangedAssets()
+		{
+			size_t rebuiltCount{ 0 };
+			rebuiltCount += ReimportTexture2DChangedAssets();
+			rebuiltCount += ReimportAudioBufferChangedAssets();
+			rebuiltCount += ReimportFontChangedAssets();
+			return rebuiltCount;
 		}
 
 		// Serializes all registries into disk storage
@@ -11,15 +11,26 @@ namespace Kargono::Assets
 {
 	Ref<Audio::AudioBuffer> AudioBufferManager::DeserializeAsset(Assets::AssetInfo& asset, const std::filesystem::path& assetPath)
 	{
-		Assets::AudioMetaData metadata = *asset.Data.GetSpecificMetaData<Assets::AudioMetaData>();
 		Buffer currentResource{};
 		currentResource = Utility::FileSystem::ReadFileBinary(assetPath);
-		Ref<Audio::AudioBuffer> newAudio = CreateRef<Audio::AudioBuffer>();
-		CallAndCheckALError(alBufferData(newAudio->m_BufferID, metadata.Channels > 1 ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16, currentResource.Data, static_cast<ALsizei>(currentResource.Size), metadata.SampleRate));
+		Ref<Audio::AudioBuffer> newAudio = CreateAssetFromFileData(asset, currentResource);
 		currentResource.Release();
 		return newAudio;
 	}
 
+	Ref<Audio::AudioBuffer> AudioBufferManager::CreateAssetFromFileData(Assets::AssetInfo& asset, Buffer fileData)
+	{
+		Assets::AudioMetaData metadata = *asset.Data.GetSpecificMetaData<Assets::AudioMetaData>();
+		Ref<Audio::AudioBuffer> newAudio = CreateRef<Audio::AudioBuffer>();
+		CallAndCheckALError(alBufferData(newAudio->m_BufferID, metadata.Channels > 1 ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16, fileData.Data, static_cast<ALsizei>(fileData.Size), metadata.SampleRate));
+		return newAudio;
+	}
+
+	uint64_t AudioBufferManager::GetAssetMemoryCost(Assets::AssetInfo& asset)
+	{
+		return asset.Data.GetSpecificMetaData<Assets::AudioMetaData>()->TotalSize;
+	}
+
 	void AudioBufferManager::SerializeAssetSpecificMetadata(YAML::Emitter& serializer, Assets::AssetInfo& currentAsset)
 	{
 		Assets::AudioMetaData* metadata = currentAsset.Data.GetSpecificMetaData<AudioMetaData>();
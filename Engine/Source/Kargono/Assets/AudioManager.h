@@ -21,11 +21,14 @@ namespace Kargono::Assets
 			m_Flags.set(AssetManagerOptions::HasFileImporting, true);
 			m_Flags.set(AssetManagerOptions::HasAssetSaving, false);
 			m_Flags.set(AssetManagerOptions::HasAssetCreationFromName, false);
+			m_Flags.set(AssetManagerOptions::HasAsyncLoading, true);
 		}
 		virtual ~AudioBufferManager() = default;
 	public:
 		// Functions specific to this manager type
 		virtual Ref<Audio::AudioBuffer> DeserializeAsset(Assets::AssetInfo& asset, const std::filesystem::path& assetPath) override;
+		virtual Ref<Audio::AudioBuffer> CreateAssetFromFileData(Assets::AssetInfo& asset, Buffer fileData) override;
+		virtual uint64_t GetAssetMemoryCost(Assets::AssetInfo& asset) override;
 		virtual void SerializeAssetSpecificMetadata(YAML::Emitter& serializer, Assets::AssetInfo& currentAsset) override;
 		virtual void CreateAssetFileFromName(std::string_view name, AssetInfo& asset, const std::filesystem::path& assetPath) override;
 		virtual void CreateAssetIntermediateFromFile(AssetInfo& newAsset, const std::filesystem::path& fullFileLocation, const std::filesystem::path& fullIntermediateLocation) override;
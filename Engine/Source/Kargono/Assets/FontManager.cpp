@@ -68,10 +68,16 @@ namespace Kargono::Utility
 namespace Kargono::Assets
 {
 	Ref<RuntimeUI::Font> Assets::FontManager::DeserializeAsset(Assets::AssetInfo& asset, const std::filesystem::path& assetPath)
+	{
+		Buffer currentResource = Utility::FileSystem::ReadFileBinary(assetPath);
+		Ref<RuntimeUI::Font> newFont = CreateAssetFromFileData(asset, currentResource);
+		currentResource.Release();
+		return newFont;
+	}
+	Ref<RuntimeUI::Font> Assets::FontManager::CreateAssetFromFileData(Assets::AssetInfo& asset, Buffer fileData)
 	{
 		Ref<RuntimeUI::Font> newFont = CreateRef<RuntimeUI::Font>();
 		Assets::FontMetaData metadata = *asset.Data.GetSpecificMetaData<FontMetaData>();
-		Buffer currentResource = Utility::FileSystem::ReadFileBinary(assetPath);
 		auto& fontCharacters = newFont->GetCharacters();
 
 		// Create Texture
@@ -81,7 +87,7 @@ namespace Kargono::Assets
 		spec.Format = Rendering::ImageFormat::RGB8;
 		spec.GenerateMipMaps = false;
 		Ref<Rendering::Texture2D> texture = Rendering::Texture2D::Create(spec);
-		texture->SetData((void*)currentResource.Data, spec.Width * spec.Height * Utility::ImageFormatToBytes(spec.Format));
+		texture->SetData((void*)fileData.Data, spec.Width * spec.Height * Utility::ImageFormatToBytes(spec.Format));
 		newFont->m_AtlasTexture = texture;
 
 		newFont->m_LineHeight = metadata.LineHeight;
@@ -93,9 +99,15 @@ namespace Kargono::Assets
 			fontCharacters.insert(std::pair<unsigned char, RuntimeUI::Character>(character, characterStruct));
 		}
 
-		currentResource.Release();
 		return newFont;
 	}
+	uint64_t Assets::FontManager::GetAssetMemoryCost(Assets::AssetInfo& asset)
+	{
+		// The atlas is stored as an RGB8 texture
+		Assets::FontMetaData* metadata = asset.Data.GetSpecificMetaData<FontMetaData>();
+		return (uint64_t)metadata->AtlasWidth * (uint64_t)metadata->AtlasHeight * 
+			Utility::ImageFormatToBytes(Rendering::ImageFormat::RGB8);
+	}
 	void Assets::FontManager::SerializeAssetSpecificMetadata(YAML::Emitter& serializer, Assets::AssetInfo& currentAsset)
 	{
 		Assets::FontMetaData* metadata = currentAsset.Data.GetSpecificMetaData<FontMetaData>();
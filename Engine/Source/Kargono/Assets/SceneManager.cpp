@@ -6,6 +6,9 @@
 #include "Kargono/ECS/ProjectComponent.h"
 #include "Kargono/Scenes/Scene.h"
 #include "Kargono/ECS/Entity.h"
+#include "Kargono/Core/JobSystem.h"
+#include "Kargono/Core/MappedFile.h"
+#include "Kargono/Events/SceneEvent.h"
 
 namespace Kargono::Utility
 {
@@ -216,6 +219,568 @@ namespace Kargono::Utility
 		out << YAML::EndMap; // Entity
 		return true;
 	}
+
+	//==============================
+	// Binary Scene Intermediate
+	//==============================
+	// The binary intermediate mirrors a scene's YAML file so it can be loaded without parsing. Layout:
+	//		header, entity UUIDs, block table, then one block per component type. A block holds
+	//		fixed-size records followed by a pool of variable-length data (strings, buffers) that the
+	//		records reference by offset. Records refer to entities by their index in the UUID list.
+	constexpr uint32_t k_SceneBinaryMagic{ 0x4253474B }; // "KGSB"
+	constexpr uint32_t k_SceneBinaryVersion{ 1 };
+	constexpr uint64_t k_SceneBinaryAlignment{ 8 };
+	constexpr size_t k_SceneChecksumSize{ 64 };
+	// Project component records store the entity index in front of the component's data
+	constexpr uint64_t k_ProjectComponentRecordDataOffset{ 8 };
+
+	struct SceneBinaryHeader
+	{
+		uint32_t m_Magic;
+		uint32_t m_Version;
+		// Used to detect when the scene file changed after the intermediate was generated
+		uint64_t m_SourceFileSize;
+		char m_SourceChecksum[k_SceneChecksumSize];
+		Math::vec4 m_BackgroundColor;
+		Math::vec2 m_Gravity;
+		uint32_t m_EntityCount;
+		uint32_t m_BlockCount;
+	};
+
+	struct SceneBinaryBlock
+	{
+		// Offsets are relative to the start of the file
+		uint64_t m_RecordOffset;
+		uint64_t m_PoolOffset;
+		uint64_t m_PoolSize;
+		// Only used by project component blocks
+		uint64_t m_ProjectComponentHandle;
+		uint32_t m_LayoutHash;
+		uint32_t m_RecordCount;
+		uint32_t m_RecordStride;
+		ECS::ComponentType m_ComponentType;
+		uint16_t m_Padding;
+	};
+
+	struct SceneBinaryRange
+	{
+		uint32_t m_Offset;
+		uint32_t m_Size;
+	};
+
+	struct SceneTagRecord
+	{
+		uint32_t m_Entity;
+		SceneBinaryRange m_Tag;
+		SceneBinaryRange m_Group;
+	};
+
+	struct SceneTransformRecord
+	{
+		uint32_t m_Entity;
+		Math::vec3 m_Translation;
+		Math::vec3 m_Rotation;
+		Math::vec3 m_Scale;
+	};
+
+	// Shared by the script and particle emitter components, which only store a single handle
+	struct SceneHandleRecord
+	{
+		uint32_t m_Entity;
+		uint64_t m_Handle;
+	};
+
+	struct SceneAIStateRecord
+	{
+		uint32_t m_Entity;
+		uint64_t m_CurrentState;
+		uint64_t m_PreviousState;
+		uint64_t m_GlobalState;
+	};
+
+	struct SceneCameraRecord
+	{
+		uint32_t m_Entity;
+		int32_t m_ProjectionType;
+		float m_PerspectiveFOV;
+		float m_PerspectiveNear;
+		float m_PerspectiveFar;
+		float m_OrthographicSize;
+		float m_OrthographicNear;
+		float m_OrthographicFar;
+		bool m_Primary;
+	};
+
+	struct SceneShapeRecord
+	{
+		uint32_t m_Entity;
+		Rendering::ShapeTypes m_CurrentShape;
+		uint64_t m_TextureHandle;
+		uint64_t m_ShaderHandle;
+		Rendering::ShaderSpecification m_ShaderSpecification;
+		SceneBinaryRange m_VertexColors;
+		SceneBinaryRange m_ShaderData;
+		bool m_HasVertexColors;
+		bool m_HasTexture;
+		bool m_HasShader;
+	};
+
+	struct SceneRigidbody2DRecord
+	{
+		uint32_t m_Entity;
+		ECS::Rigidbody2DComponent::BodyType m_Type;
+		uint64_t m_OnCollisionStartHandle;
+		uint64_t m_OnCollisionEndHandle;
+		bool m_FixedRotation;
+	};
+
+	struct SceneBoxCollider2DRecord
+	{
+		uint32_t m_Entity;
+		Math::vec2 m_Offset;
+		Math::vec2 m_Size;
+		float m_Density;
+		float m_Friction;
+		float m_Restitution;
+		float m_RestitutionThreshold;
+		bool m_IsSensor;
+	};
+
+	struct SceneCircleCollider2DRecord
+	{
+		uint32_t m_Entity;
+		Math::vec2 m_Offset;
+		float m_Radius;
+		float m_Density;
+		float m_Friction;
+		float m_Restitution;
+		float m_RestitutionThreshold;
+		bool m_IsSensor;
+	};
+
+	static_assert(std::is_trivially_copyable_v<SceneShapeRecord>);
+	static_assert(sizeof(SceneBinaryRange) <= sizeof(std::string));
+
+	static uint64_t AlignSceneBinarySize(uint64_t size)
+	{
+		return (size + k_SceneBinaryAlignment - 1) & ~(k_SceneBinaryAlignment - 1);
+	}
+
+	static uint32_t GetSceneBinaryRecordStride(ECS::ComponentType type)
+	{
+		switch (type)
+		{
+		case ECS::ComponentType::Tag: return sizeof(SceneTagRecord);
+		case ECS::ComponentType::Transform: return sizeof(SceneTransformRecord);
+		case ECS::ComponentType::OnUpdate:
+		case ECS::ComponentType::OnCreate:
+		case ECS::ComponentType::ParticleEmitter: return sizeof(SceneHandleRecord);
+		case ECS::ComponentType::AIState: return sizeof(SceneAIStateRecord);
+		case ECS::ComponentType::Camera: return sizeof(SceneCameraRecord);
+		case ECS::ComponentType::Shape: return sizeof(SceneShapeRecord);
+		case ECS::ComponentType::Rigidbody2D: return sizeof(SceneRigidbody2DRecord);
+		case ECS::ComponentType::BoxCollider2D: return sizeof(SceneBoxCollider2DRecord);
+		case ECS::ComponentType::CircleCollider2D: return sizeof(SceneCircleCollider2DRecord);
+		default: return 0;
+		}
+	}
+
+	static uint32_t GetProjectComponentRecordStride(const ECS::ProjectComponent& component)
+	{
+		return (uint32_t)AlignSceneBinarySize(k_ProjectComponentRecordDataOffset + component.m_BufferSize);
+	}
+
+	// Identifies the field layout of a project component, so stale intermediates are rejected
+	//		after the component is edited
+	static uint32_t GetProjectComponentLayoutHash(const ECS::ProjectComponent& component)
+	{
+		uint32_t typesHash = FileSystem::CRCFromBuffer((void*)component.m_DataTypes.data(), 
+			component.m_DataTypes.size() * sizeof(WrappedVarType));
+		uint32_t locationsHash = FileSystem::CRCFromBuffer((void*)component.m_DataLocations.data(), 
+			component.m_DataLocations.size() * sizeof(uint64_t));
+		return typesHash ^ (locationsHash * 31) ^ (uint32_t)component.m_BufferSize;
+	}
+
+	static void LoadShapeGeometry(ECS::ShapeComponent& component)
+	{
+		if (component.CurrentShape == Rendering::ShapeTypes::None)
+		{
+			return;
+		}
+
+		const Rendering::Shape& shape = Utility::ShapeTypeToShape(component.CurrentShape);
+		if (component.ShaderSpecification.RenderType == Rendering::RenderingType::DrawIndex)
+		{
+			component.Vertices = CreateRef<std::vector<Math::vec3>>(shape.GetIndexVertices());
+			component.Indices = CreateRef<std::vector<uint32_t>>(shape.GetIndices());
+			component.TextureCoordinates = CreateRef<std::vector<Math::vec2>>(shape.GetIndexTextureCoordinates());
+		}
+
+		if (component.ShaderSpecification.RenderType == Rendering::RenderingType::DrawTriangle)
+		{
+			component.Vertices = CreateRef<std::vector<Math::vec3>>(shape.GetTriangleVertices());
+			component.TextureCoordinates = CreateRef<std::vector<Math::vec2>>(shape.GetTriangleTextureCoordinates());
+		}
+	}
+
+	//==============================
+	// Write Binary Scene Blocks
+	//==============================
+	class SceneBinaryBlockBuilder
+	{
+	public:
+		SceneBinaryBlockBuilder(ECS::ComponentType type, uint32_t recordStride)
+		{
+			m_Block.m_ComponentType = type;
+			m_Block.m_RecordStride = recordStride;
+		}
+	public:
+		template<typename Record>
+		void AddRecord(const Record& record)
+		{
+			KG_ASSERT(sizeof(Record) == m_Block.m_RecordStride);
+			AddRecordBytes((const uint8_t*)&record);
+		}
+		void AddRecordBytes(const uint8_t* record)
+		{
+			m_Records.insert(m_Records.end(), record, record + m_Block.m_RecordStride);
+			m_Block.m_RecordCount++;
+		}
+		SceneBinaryRange AddToPool(const void* data, size_t size)
+		{
+			SceneBinaryRange range{ (uint32_t)m_Pool.size(), (uint32_t)size };
+			m_Pool.insert(m_Pool.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+			return range;
+		}
+		SceneBinaryRange AddToPool(const std::string& string)
+		{
+			return AddToPool(string.data(), string.size());
+		}
+	public:
+		SceneBinaryBlock m_Block{};
+		std::vector<uint8_t> m_Records{};
+		std::vector<uint8_t> m_Pool{};
+	};
+
+	//==============================
+	// Read Binary Scene Blocks
+	//==============================
+	struct SceneBinaryPool
+	{
+		const uint8_t* m_Data;
+		uint64_t m_Size;
+
+		bool Contains(SceneBinaryRange range) const
+		{
+			return (uint64_t)range.m_Offset + range.m_Size <= m_Size;
+		}
+		std::string GetString(SceneBinaryRange range) const
+		{
+			if (!Contains(range))
+			{
+				return {};
+			}
+			return std::string((const char*)m_Data + range.m_Offset, range.m_Size);
+		}
+	};
+
+	template<typename Record, typename Func>
+	static void ForEachSceneBinaryRecord(const uint8_t* fileData, const SceneBinaryBlock& block, 
+		const std::vector<entt::entity>& entities, Func&& func)
+	{
+		const Record* records = (const Record*)(fileData + block.m_RecordOffset);
+		for (uint32_t iteration{ 0 }; iteration < block.m_RecordCount; iteration++)
+		{
+			const Record& record = records[iteration];
+			if (record.m_Entity >= entities.size())
+			{
+				continue;
+			}
+			func(entities[record.m_Entity], record);
+		}
+	}
+
+	// Fills a single component storage from its block. Blocks touch separate storages, so they can be
+	//		loaded concurrently as long as every storage already exists inside the registry.
+	static void LoadSceneBinaryBlock(ECS::EntityRegistry& entityRegistry, const std::vector<entt::entity>& entities,
+		const uint8_t* fileData, const SceneBinaryBlock& block, const ECS::ProjectComponent* projectComponent)
+	{
+		entt::registry& registry = entityRegistry.m_EnTTRegistry;
+		SceneBinaryPool pool{ fileData + block.m_PoolOffset, block.m_PoolSize };
+
+		switch (block.m_ComponentType)
+		{
+		case ECS::ComponentType::Tag:
+		{
+			auto& storage = registry.storage<ECS::TagComponent>();
+			ForEachSceneBinaryRecord<SceneTagRecord>(fileData, block, entities, [&](entt::entity entity, const SceneTagRecord& record)
+			{
+				ECS::TagComponent& component = storage.get(entity);
+				component.Tag = pool.GetString(record.m_Tag);
+				component.Group = pool.GetString(record.m_Group);
+			});
+			return;
+		}
+		case ECS::ComponentType::Transform:
+		{
+			auto& storage = registry.storage<ECS::TransformComponent>();
+			ForEachSceneBinaryRecord<SceneTransformRecord>(fileData, block, entities, [&](entt::entity entity, const SceneTransformRecord& record)
+			{
+				ECS::TransformComponent& component = storage.get(entity);
+				component.Translation = record.m_Translation;
+				component.Rotation = record.m_Rotation;
+				component.Scale = record.m_Scale;
+			});
+			return;
+		}
+		case ECS::ComponentType::OnUpdate:
+		{
+			auto& storage = registry.storage<ECS::OnUpdateComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneHandleRecord>(fileData, block, entities, [&](entt::entity entity, const SceneHandleRecord& record)
+			{
+				storage.emplace(entity).OnUpdateScriptHandle = record.m_Handle;
+			});
+			return;
+		}
+		case ECS::ComponentType::OnCreate:
+		{
+			auto& storage = registry.storage<ECS::OnCreateComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneHandleRecord>(fileData, block, entities, [&](entt::entity entity, const SceneHandleRecord& record)
+			{
+				storage.emplace(entity).OnCreateScriptHandle = record.m_Handle;
+			});
+			return;
+		}
+		case ECS::ComponentType::ParticleEmitter:
+		{
+			auto& storage = registry.storage<ECS::ParticleEmitterComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneHandleRecord>(fileData, block, entities, [&](entt::entity entity, const SceneHandleRecord& record)
+			{
+				storage.emplace(entity).m_EmitterConfigHandle = record.m_Handle;
+			});
+			return;
+		}
+		case ECS::ComponentType::AIState:
+		{
+			auto& storage = registry.storage<ECS::AIStateComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneAIStateRecord>(fileData, block, entities, [&](entt::entity entity, const SceneAIStateRecord& record)
+			{
+				ECS::AIStateComponent& component = storage.emplace(entity);
+				component.CurrentStateHandle = record.m_CurrentState;
+				component.PreviousStateHandle = record.m_PreviousState;
+				component.GlobalStateHandle = record.m_GlobalState;
+			});
+			return;
+		}
+		case ECS::ComponentType::Camera:
+		{
+			auto& storage = registry.storage<ECS::CameraComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneCameraRecord>(fileData, block, entities, [&](entt::entity entity, const SceneCameraRecord& record)
+			{
+				ECS::CameraComponent& component = storage.emplace(entity);
+				component.Camera.SetProjectionType((Scenes::SceneCamera::ProjectionType)record.m_ProjectionType);
+				component.Camera.SetPerspectiveVerticalFOV(record.m_PerspectiveFOV);
+				component.Camera.SetPerspectiveNearClip(record.m_PerspectiveNear);
+				component.Camera.SetPerspectiveFarClip(record.m_PerspectiveFar);
+				component.Camera.SetOrthographicSize(record.m_OrthographicSize);
+				component.Camera.SetOrthographicNearClip(record.m_OrthographicNear);
+				component.Camera.SetOrthographicFarClip(record.m_OrthographicFar);
+				component.Primary = record.m_Primary;
+			});
+			return;
+		}
+		case ECS::ComponentType::Shape:
+		{
+			auto& storage = registry.storage<ECS::ShapeComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneShapeRecord>(fileData, block, entities, [&](entt::entity entity, const SceneShapeRecord& record)
+			{
+				ECS::ShapeComponent& component = storage.emplace(entity);
+				component.CurrentShape = record.m_CurrentShape;
+				if (record.m_HasVertexColors && pool.Contains(record.m_VertexColors))
+				{
+					const Math::vec4* colors = (const Math::vec4*)(pool.m_Data + record.m_VertexColors.m_Offset);
+					component.VertexColors = CreateRef<std::vector<Math::vec4>>(colors, colors + record.m_VertexColors.m_Size / sizeof(Math::vec4));
+				}
+				if (record.m_HasTexture)
+				{
+					component.TextureHandle = record.m_TextureHandle;
+				}
+
+				// Shaders and geometry are resolved on the calling thread afterwards
+				if (record.m_HasShader && pool.Contains(record.m_ShaderData))
+				{
+					component.ShaderHandle = record.m_ShaderHandle;
+					component.ShaderSpecification = record.m_ShaderSpecification;
+					component.ShaderData.Allocate(record.m_ShaderData.m_Size);
+					memcpy(component.ShaderData.Data, pool.m_Data + record.m_ShaderData.m_Offset, record.m_ShaderData.m_Size);
+				}
+			});
+			return;
+		}
+		case ECS::ComponentType::Rigidbody2D:
+		{
+			auto& storage = registry.storage<ECS::Rigidbody2DComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneRigidbody2DRecord>(fileData, block, entities, [&](entt::entity entity, const SceneRigidbody2DRecord& record)
+			{
+				ECS::Rigidbody2DComponent& component = storage.emplace(entity);
+				component.Type = record.m_Type;
+				component.FixedRotation = record.m_FixedRotation;
+				component.OnCollisionStartScriptHandle = record.m_OnCollisionStartHandle;
+				component.OnCollisionEndScriptHandle = record.m_OnCollisionEndHandle;
+			});
+			return;
+		}
+		case ECS::ComponentType::BoxCollider2D:
+		{
+			auto& storage = registry.storage<ECS::BoxCollider2DComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneBoxCollider2DRecord>(fileData, block, entities, [&](entt::entity entity, const SceneBoxCollider2DRecord& record)
+			{
+				ECS::BoxCollider2DComponent& component = storage.emplace(entity);
+				component.Offset = record.m_Offset;
+				component.Size = record.m_Size;
+				component.Density = record.m_Density;
+				component.Friction = record.m_Friction;
+				component.Restitution = record.m_Restitution;
+				component.RestitutionThreshold = record.m_RestitutionThreshold;
+				component.IsSensor = record.m_IsSensor;
+			});
+			return;
+		}
+		case ECS::ComponentType::CircleCollider2D:
+		{
+			auto& storage = registry.storage<ECS::CircleCollider2DComponent>();
+			storage.reserve(block.m_RecordCount);
+			ForEachSceneBinaryRecord<SceneCircleCollider2DRecord>(fileData, block, entities, [&](entt::entity entity, const SceneCircleCollider2DRecord& record)
+			{
+				ECS::CircleCollider2DComponent& component = storage.emplace(entity);
+				component.Offset = record.m_Offset;
+				component.Radius = record.m_Radius;
+				component.Density = record.m_Density;
+				component.Friction = record.m_Friction;
+				component.Restitution = record.m_Restitution;
+				component.RestitutionThreshold = record.m_RestitutionThreshold;
+				component.IsSensor = record.m_IsSensor;
+			});
+			return;
+		}
+		case ECS::ComponentType::ProjectComponent:
+		{
+			KG_ASSERT(projectComponent);
+			ECS::ProjectComponentStorage& storage = entityRegistry.m_ProjectComponentStorage.at(projectComponent->m_BufferSlot);
+			for (uint32_t iteration{ 0 }; iteration < block.m_RecordCount; iteration++)
+			{
+				const uint8_t* record = fileData + block.m_RecordOffset + (uint64_t)iteration * block.m_RecordStride;
+				uint32_t entityIndex = *(const uint32_t*)record;
+				if (entityIndex >= entities.size())
+				{
+					continue;
+				}
+
+				// Create the component and copy in each field
+				storage.m_AddProjectComponent(storage.m_EnTTStorageReference, entities[entityIndex]);
+				uint8_t* componentData = (uint8_t*)storage.m_GetProjectComponent(storage.m_EnTTStorageReference, entities[entityIndex]);
+				const uint8_t* recordData = record + k_ProjectComponentRecordDataOffset;
+				for (size_t fieldIndex{ 0 }; fieldIndex < projectComponent->m_DataLocations.size(); fieldIndex++)
+				{
+					WrappedVarType fieldType = projectComponent->m_DataTypes.at(fieldIndex);
+					uint64_t fieldLocation = projectComponent->m_DataLocations.at(fieldIndex);
+					if (fieldType == WrappedVarType::String)
+					{
+						Utility::InitializeDataForWrappedVarBuffer(fieldType, componentData + fieldLocation);
+						*(std::string*)(componentData + fieldLocation) = pool.GetString(*(const SceneBinaryRange*)(recordData + fieldLocation));
+						continue;
+					}
+					memcpy(componentData + fieldLocation, recordData + fieldLocation, Utility::WrappedVarTypeToDataSizeBytes(fieldType));
+				}
+			}
+			return;
+		}
+		default:
+			KG_WARN("Unknown component type found in binary scene block");
+			return;
+		}
+	}
+
+	// Resolves references to other assets. Asset caches are not thread-safe, so this runs on the
+	//		calling thread after all blocks are loaded.
+	static void ResolveSceneBinaryBlock(entt::registry& registry, const std::vector<entt::entity>& entities,
+		const uint8_t* fileData, const SceneBinaryBlock& block)
+	{
+		switch (block.m_ComponentType)
+		{
+		case ECS::ComponentType::OnUpdate:
+			registry.view<ECS::OnUpdateComponent>().each([](ECS::OnUpdateComponent& component)
+			{
+				component.OnUpdateScript = Assets::AssetService::GetScript(component.OnUpdateScriptHandle);
+			});
+			return;
+		case ECS::ComponentType::OnCreate:
+			registry.view<ECS::OnCreateComponent>().each([](ECS::OnCreateComponent& component)
+			{
+				component.OnCreateScript = Assets::AssetService::GetScript(component.OnCreateScriptHandle);
+			});
+			return;
+		case ECS::ComponentType::ParticleEmitter:
+			registry.view<ECS::ParticleEmitterComponent>().each([](ECS::ParticleEmitterComponent& component)
+			{
+				component.m_EmitterConfigRef = Assets::AssetService::GetEmitterConfig(component.m_EmitterConfigHandle);
+			});
+			return;
+		case ECS::ComponentType::AIState:
+			registry.view<ECS::AIStateComponent>().each([](ECS::AIStateComponent& component)
+			{
+				component.CurrentStateReference = Assets::AssetService::GetAIState(component.CurrentStateHandle);
+				component.PreviousStateReference = Assets::AssetService::GetAIState(component.PreviousStateHandle);
+				component.GlobalStateReference = Assets::AssetService::GetAIState(component.GlobalStateHandle);
+			});
+			return;
+		case ECS::ComponentType::Rigidbody2D:
+			registry.view<ECS::Rigidbody2DComponent>().each([](ECS::Rigidbody2DComponent& component)
+			{
+				component.OnCollisionStartScript = Assets::AssetService::GetScript(component.OnCollisionStartScriptHandle);
+				component.OnCollisionEndScript = Assets::AssetService::GetScript(component.OnCollisionEndScriptHandle);
+			});
+			return;
+		case ECS::ComponentType::Shape:
+		{
+			auto& storage = registry.storage<ECS::ShapeComponent>();
+			ForEachSceneBinaryRecord<SceneShapeRecord>(fileData, block, entities, [&](entt::entity entity, const SceneShapeRecord& record)
+			{
+				ECS::ShapeComponent& component = storage.get(entity);
+				if (record.m_HasTexture)
+				{
+					component.Texture = Assets::AssetService::GetTexture2D(component.TextureHandle);
+				}
+				if (!record.m_HasShader)
+				{
+					return;
+				}
+
+				// Fall back to the stored specification if the shader asset no longer exists
+				component.Shader = Assets::AssetService::GetShader(component.ShaderHandle);
+				if (!component.Shader)
+				{
+					auto [newHandle, newShader] = Assets::AssetService::GetShader(record.m_ShaderSpecification);
+					component.ShaderHandle = newHandle;
+					component.Shader = newShader;
+				}
+				component.ShaderSpecification = component.Shader->GetSpecification();
+				LoadShapeGeometry(component);
+			});
+			return;
+		}
+		default:
+			return;
+		}
+	}
 }
 
 namespace Kargono::Assets
@@ -263,9 +828,22 @@ namespace Kargono::Assets
 		out << YAML::EndMap; // Start of File Map
 		if (submitScene)
 		{
-			std::ofstream fout(assetPath);
-			fout << out.c_str();
+			{
+				std::ofstream fout(assetPath);
+				fout << out.c_str();
+			}
 			KG_INFO("Successfully Serialized Scene at {}", assetPath.string());
+
+			// Keep the binary intermediate in sync for registered scenes
+			AssetHandle sceneHandle = GetAssetHandleFromFileLocation(Utility::FileSystem::ConvertToUnixStylePath(
+				Utility::FileSystem::GetRelativePath(Projects::ProjectService::GetActiveAssetDirectory(), assetPath)));
+			std::error_code fileSizeError;
+			uint64_t sourceFileSize = std::filesystem::file_size(assetPath, fileSizeError);
+			if (sceneHandle != Assets::EmptyHandle && !fileSizeError)
+			{
+				SerializeSceneBinary(assetReference, GetSceneBinaryLocation(sceneHandle), 
+					Utility::FileSystem::ChecksumFromFile(assetPath), sourceFileSize);
+			}
 		}
 		else
 		{
@@ -274,7 +852,15 @@ namespace Kargono::Assets
 	}
 	Ref<Scenes::Scene> SceneManager::DeserializeAsset(Assets::AssetInfo& assetInfo, const std::filesystem::path& assetPath)
 	{
-		UNREFERENCED_PARAMETER(assetInfo);
+		// Load the binary intermediate if it is up to date with the scene file
+		ScenePreload binaryLoad{};
+		bool useBinary = PrepareSceneBinary(binaryLoad, assetInfo, assetPath);
+		if (useBinary && LoadSceneBinary(binaryLoad))
+		{
+			ResolveSceneBinary(binaryLoad);
+			return binaryLoad.m_Scene;
+		}
+
 		Ref<Scenes::Scene> newScene = CreateRef<Scenes::Scene>();
 		YAML::Node data;
 		try
@@ -444,21 +1030,7 @@ namespace Kargono::Assets
 						Buffer buffer{ binary.size() };
 						memcpy(buffer.Data, binary.data(), buffer.Size);
 						sc.ShaderData = buffer;
-						if (sc.CurrentShape != Rendering::ShapeTypes::None)
-						{
-							if (sc.ShaderSpecification.RenderType == Rendering::RenderingType::DrawIndex)
-							{
-								sc.Vertices = CreateRef<std::vector<Math::vec3>>(Utility::ShapeTypeToShape(sc.CurrentShape).GetIndexVertices());
-								sc.Indices = CreateRef<std::vector<uint32_t>>(Utility::ShapeTypeToShape(sc.CurrentShape).GetIndices());
-								sc.TextureCoordinates = CreateRef<std::vector<Math::vec2>>(Utility::ShapeTypeToShape(sc.CurrentShape).GetIndexTextureCoordinates());
-							}
-
-							if (sc.ShaderSpecification.RenderType == Rendering::RenderingType::DrawTriangle)
-							{
-								sc.Vertices = CreateRef<std::vector<Math::vec3>>(Utility::ShapeTypeToShape(sc.CurrentShape).GetTriangleVertices());
-								sc.TextureCoordinates = CreateRef<std::vector<Math::vec2>>(Utility::ShapeTypeToShape(sc.CurrentShape).GetTriangleTextureCoordinates());
-							}
-						}
+						Utility::LoadShapeGeometry(sc);
 					}
 				}
 
@@ -532,8 +1104,582 @@ namespace Kargono::Assets
 			}
 		}
 
+		// Regenerate the binary intermediate, so the next load can skip parsing
+		if (useBinary)
+		{
+			binaryLoad.m_File.Close();
+			SerializeSceneBinary(newScene, binaryLoad.m_BinaryPath, binaryLoad.m_SourceChecksum, binaryLoad.m_SourceFileSize);
+		}
+
 		return newScene;
 	}
+	void SceneManager::DeleteAssetValidation(AssetHandle assetHandle)
+	{
+		std::filesystem::path binaryPath = GetSceneBinaryLocation(assetHandle);
+		if (Utility::FileSystem::PathExists(binaryPath))
+		{
+			Utility::FileSystem::DeleteSelectedFile(binaryPath);
+		}
+	}
+	std::filesystem::path SceneManager::GetSceneBinaryLocation(AssetHandle sceneHandle)
+	{
+		return Projects::ProjectService::GetActiveIntermediateDirectory() / 
+			m_RegistryLocation.parent_path() / ((std::string)sceneHandle + m_IntermediateExtension.CString());
+	}
+	void SceneManager::SerializeSceneBinary(Ref<Scenes::Scene> sceneReference, const std::filesystem::path& binaryPath,
+		const std::string& sourceChecksum, uint64_t sourceFileSize)
+	{
+		KG_ASSERT(sceneReference);
+		if (sourceChecksum.size() != Utility::k_SceneChecksumSize)
+		{
+			KG_WARN("Could not create binary scene intermediate. Invalid checksum provided for the scene file.");
+			return;
+		}
+
+		// Gather all entities. Records refer to entities by their index in this list.
+		std::vector<ECS::Entity> entities{};
+		std::vector<uint64_t> entityIDs{};
+		sceneReference->m_EntityRegistry.m_EnTTRegistry.each([&](entt::entity enttID)
+		{
+			ECS::Entity entity{ enttID, &sceneReference->m_EntityRegistry };
+			if (!entity) { return; }
+			entities.push_back(entity);
+			entityIDs.push_back((uint64_t)entity.GetUUID());
+		});
+
+		// Create one block for every component type
+		using Utility::SceneBinaryBlockBuilder;
+		SceneBinaryBlockBuilder tagBlock{ ECS::ComponentType::Tag, sizeof(Utility::SceneTagRecord) };
+		SceneBinaryBlockBuilder transformBlock{ ECS::ComponentType::Transform, sizeof(Utility::SceneTransformRecord) };
+		SceneBinaryBlockBuilder onUpdateBlock{ ECS::ComponentType::OnUpdate, sizeof(Utility::SceneHandleRecord) };
+		SceneBinaryBlockBuilder onCreateBlock{ ECS::ComponentType::OnCreate, sizeof(Utility::SceneHandleRecord) };
+		SceneBinaryBlockBuilder emitterBlock{ ECS::ComponentType::ParticleEmitter, sizeof(Utility::SceneHandleRecord) };
+		SceneBinaryBlockBuilder aiStateBlock{ ECS::ComponentType::AIState, sizeof(Utility::SceneAIStateRecord) };
+		SceneBinaryBlockBuilder cameraBlock{ ECS::ComponentType::Camera, sizeof(Utility::SceneCameraRecord) };
+		SceneBinaryBlockBuilder shapeBlock{ ECS::ComponentType::Shape, sizeof(Utility::SceneShapeRecord) };
+		SceneBinaryBlockBuilder rigidbodyBlock{ ECS::ComponentType::Rigidbody2D, sizeof(Utility::SceneRigidbody2DRecord) };
+		SceneBinaryBlockBuilder boxColliderBlock{ ECS::ComponentType::BoxCollider2D, sizeof(Utility::SceneBoxCollider2DRecord) };
+		SceneBinaryBlockBuilder circleColliderBlock{ ECS::ComponentType::CircleCollider2D, sizeof(Utility::SceneCircleCollider2DRecord) };
+
+		// Project components each get their own block
+		std::vector<SceneBinaryBlockBuilder> projectComponentBlocks{};
+		std::vector<Ref<ECS::ProjectComponent>> projectComponents{};
+		for (auto& [handle, asset] : Assets::AssetService::GetProjectComponentRegistry())
+		{
+			Ref<ECS::ProjectComponent> projectComponent = Assets::AssetService::GetProjectComponent(handle);
+			KG_ASSERT(projectComponent);
+			if (projectComponent->m_BufferSize == 0)
+			{
+				continue;
+			}
+			SceneBinaryBlockBuilder& newBlock = projectComponentBlocks.emplace_back(ECS::ComponentType::ProjectComponent, 
+				Utility::GetProjectComponentRecordStride(*projectComponent));
+			newBlock.m_Block.m_ProjectComponentHandle = (uint64_t)handle;
+			newBlock.m_Block.m_LayoutHash = Utility::GetProjectComponentLayoutHash(*projectComponent);
+			projectComponents.push_back(projectComponent);
+		}
+
+		// Write each entity's components into their blocks
+		std::vector<uint8_t> projectComponentRecord{};
+		for (uint32_t entityIndex{ 0 }; entityIndex < (uint32_t)entities.size(); entityIndex++)
+		{
+			ECS::Entity entity = entities.at(entityIndex);
+
+			if (entity.HasComponent<ECS::TagComponent>())
+			{
+				ECS::TagComponent& component = entity.GetComponent<ECS::TagComponent>();
+				Utility::SceneTagRecord record{};
+				record.m_Entity = entityIndex;
+				record.m_Tag = tagBlock.AddToPool(component.Tag);
+				record.m_Group = tagBlock.AddToPool(component.Group);
+				tagBlock.AddRecord(record);
+			}
+
+			if (entity.HasComponent<ECS::TransformComponent>())
+			{
+				ECS::TransformComponent& component = entity.GetComponent<ECS::TransformComponent>();
+				transformBlock.AddRecord(Utility::SceneTransformRecord{ entityIndex, component.Translation, component.Rotation, component.Scale });
+			}
+
+			if (entity.HasComponent<ECS::OnUpdateComponent>())
+			{
+				ECS::OnUpdateComponent& component = entity.GetComponent<ECS::OnUpdateComponent>();
+				onUpdateBlock.AddRecord(Utility::SceneHandleRecord{ entityIndex, (uint64_t)component.OnUpdateScriptHandle });
+			}
+
+			if (entity.HasComponent<ECS::OnCreateComponent>())
+			{
+				ECS::OnCreateComponent& component = entity.GetComponent<ECS::OnCreateComponent>();
+				onCreateBlock.AddRecord(Utility::SceneHandleRecord{ entityIndex, (uint64_t)component.OnCreateScriptHandle });
+			}
+
+			if (entity.HasComponent<ECS::ParticleEmitterComponent>())
+			{
+				ECS::ParticleEmitterComponent& component = entity.GetComponent<ECS::ParticleEmitterComponent>();
+				emitterBlock.AddRecord(Utility::SceneHandleRecord{ entityIndex, (uint64_t)component.m_EmitterConfigHandle });
+			}
+
+			if (entity.HasComponent<ECS::AIStateComponent>())
+			{
+				ECS::AIStateComponent& component = entity.GetComponent<ECS::AIStateComponent>();
+				aiStateBlock.AddRecord(Utility::SceneAIStateRecord{ entityIndex, (uint64_t)component.CurrentStateHandle, 
+					(uint64_t)component.PreviousStateHandle, (uint64_t)component.GlobalStateHandle });
+			}
+
+			if (entity.HasComponent<ECS::CameraComponent>())
+			{
+				ECS::CameraComponent& component = entity.GetComponent<ECS::CameraComponent>();
+				Scenes::SceneCamera& camera = component.Camera;
+				Utility::SceneCameraRecord record{};
+				record.m_Entity = entityIndex;
+				record.m_ProjectionType = (int32_t)camera.GetProjectionType();
+				record.m_PerspectiveFOV = camera.GetPerspectiveVerticalFOV();
+				record.m_PerspectiveNear = camera.GetPerspectiveNearClip();
+				record.m_PerspectiveFar = camera.GetPerspectiveFarClip();
+				record.m_OrthographicSize = camera.GetOrthographicSize();
+				record.m_OrthographicNear = camera.GetOrthographicNearClip();
+				record.m_OrthographicFar = camera.GetOrthographicFarClip();
+				record.m_Primary = component.Primary;
+				cameraBlock.AddRecord(record);
+			}
+
+			if (entity.HasComponent<ECS::ShapeComponent>())
+			{
+				ECS::ShapeComponent& component = entity.GetComponent<ECS::ShapeComponent>();
+				Utility::SceneShapeRecord record{};
+				record.m_Entity = entityIndex;
+				record.m_CurrentShape = component.CurrentShape;
+				if (component.VertexColors)
+				{
+					record.m_HasVertexColors = true;
+					record.m_VertexColors = shapeBlock.AddToPool(component.VertexColors->data(), 
+						component.VertexColors->size() * sizeof(Math::vec4));
+				}
+				if (component.Texture)
+				{
+					record.m_HasTexture = true;
+					record.m_TextureHandle = (uint64_t)component.TextureHandle;
+				}
+				if (component.Shader)
+				{
+					record.m_HasShader = true;
+					record.m_ShaderHandle = (uint64_t)component.ShaderHandle;
+					record.m_ShaderSpecification = component.Shader->GetSpecification();
+					record.m_ShaderData = shapeBlock.AddToPool(component.ShaderData.Data, component.ShaderData.Size);
+				}
+				shapeBlock.AddRecord(record);
+			}
+
+			if (entity.HasComponent<ECS::Rigidbody2DComponent>())
+			{
+				ECS::Rigidbody2DComponent& component = entity.GetComponent<ECS::Rigidbody2DComponent>();
+				Utility::SceneRigidbody2DRecord record{};
+				record.m_Entity = entityIndex;
+				record.m_Type = component.Type;
+				record.m_OnCollisionStartHandle = (uint64_t)component.OnCollisionStartScriptHandle;
+				record.m_OnCollisionEndHandle = (uint64_t)component.OnCollisionEndScriptHandle;
+				record.m_FixedRotation = component.FixedRotation;
+				rigidbodyBlock.AddRecord(record);
+			}
+
+			if (entity.HasComponent<ECS::BoxCollider2DComponent>())
+			{
+				ECS::BoxCollider2DComponent& component = entity.GetComponent<ECS::BoxCollider2DComponent>();
+				boxColliderBlock.AddRecord(Utility::SceneBoxCollider2DRecord{ entityIndex, component.Offset, component.Size, component.Density, 
+					component.Friction, component.Restitution, component.RestitutionThreshold, component.IsSensor });
+			}
+
+			if (entity.HasComponent<ECS::CircleCollider2DComponent>())
+			{
+				ECS::CircleCollider2DComponent& component = entity.GetComponent<ECS::CircleCollider2DComponent>();
+				circleColliderBlock.AddRecord(Utility::SceneCircleCollider2DRecord{ entityIndex, component.Offset, component.Radius, component.Density,
+					component.Friction, component.Restitution, component.RestitutionThreshold, component.IsSensor });
+			}
+
+			for (size_t componentIndex{ 0 }; componentIndex < projectComponents.size(); componentIndex++)
+			{
+				ECS::ProjectComponent& projectComponent = *projectComponents.at(componentIndex);
+				SceneBinaryBlockBuilder& block = projectComponentBlocks.at(componentIndex);
+				AssetHandle projectComponentHandle = block.m_Block.m_ProjectComponentHandle;
+				if (!entity.HasProjectComponentData(projectComponentHandle))
+				{
+					continue;
+				}
+
+				// Copy each field into the record. Strings are moved into the block's pool.
+				projectComponentRecord.assign(block.m_Block.m_RecordStride, 0);
+				*(uint32_t*)projectComponentRecord.data() = entityIndex;
+				uint8_t* recordData = projectComponentRecord.data() + Utility::k_ProjectComponentRecordDataOffset;
+				uint8_t* componentData = (uint8_t*)entity.GetProjectComponentData(projectComponentHandle);
+				for (size_t fieldIndex{ 0 }; fieldIndex < projectComponent.m_DataLocations.size(); fieldIndex++)
+				{
+					WrappedVarType fieldType = projectComponent.m_DataTypes.at(fieldIndex);
+					uint64_t fieldLocation = projectComponent.m_DataLocations.at(fieldIndex);
+					if (fieldType == WrappedVarType::String)
+					{
+						*(Utility::SceneBinaryRange*)(recordData + fieldLocation) = block.AddToPool(*(std::string*)(componentData + fieldLocation));
+						continue;
+					}
+					memcpy(recordData + fieldLocation, componentData + fieldLocation, Utility::WrappedVarTypeToDataSizeBytes(fieldType));
+				}
+				block.AddRecordBytes(projectComponentRecord.data());
+			}
+		}
+
+		// Only keep blocks that hold components
+		std::vector<SceneBinaryBlockBuilder*> blocks{};
+		for (SceneBinaryBlockBuilder* block : { &tagBlock, &transformBlock, &onUpdateBlock, &onCreateBlock, &emitterBlock, &aiStateBlock,
+			&cameraBlock, &shapeBlock, &rigidbodyBlock, &boxColliderBlock, &circleColliderBlock })
+		{
+			if (block->m_Block.m_RecordCount > 0)
+			{
+				blocks.push_back(block);
+			}
+		}
+		for (SceneBinaryBlockBuilder& block : projectComponentBlocks)
+		{
+			if (block.m_Block.m_RecordCount > 0)
+			{
+				blocks.push_back(&block);
+			}
+		}
+
+		// Lay out the file
+		uint64_t entitiesOffset = Utility::AlignSceneBinarySize(sizeof(Utility::SceneBinaryHeader));
+		uint64_t blockTableOffset = Utility::AlignSceneBinarySize(entitiesOffset + entityIDs.size() * sizeof(uint64_t));
+		uint64_t fileSize = Utility::AlignSceneBinarySize(blockTableOffset + blocks.size() * sizeof(Utility::SceneBinaryBlock));
+		for (SceneBinaryBlockBuilder* block : blocks)
+		{
+			block->m_Block.m_RecordOffset = fileSize;
+			block->m_Block.m_PoolOffset = Utility::AlignSceneBinarySize(fileSize + block->m_Records.size());
+			block->m_Block.m_PoolSize = block->m_Pool.size();
+			fileSize = Utility::AlignSceneBinarySize(block->m_Block.m_PoolOffset + block->m_Block.m_PoolSize);
+		}
+
+		// Write the header, entities, block table, and block data
+		std::vector<uint8_t> fileData(fileSize, 0);
+		Utility::SceneBinaryHeader header{};
+		header.m_Magic = Utility::k_SceneBinaryMagic;
+		header.m_Version = Utility::k_SceneBinaryVersion;
+		header.m_SourceFileSize = sourceFileSize;
+		memcpy(header.m_SourceChecksum, sourceChecksum.data(), Utility::k_SceneChecksumSize);
+		header.m_BackgroundColor = sceneReference->m_BackgroundColor;
+		header.m_Gravity = sceneReference->m_PhysicsSpecification.Gravity;
+		header.m_EntityCount = (uint32_t)entityIDs.size();
+		header.m_BlockCount = (uint32_t)blocks.size();
+		memcpy(fileData.data(), &header, sizeof(header));
+		memcpy(fileData.data() + entitiesOffset, entityIDs.data(), entityIDs.size() * sizeof(uint64_t));
+		for (size_t blockIndex{ 0 }; blockIndex < blocks.size(); blockIndex++)
+		{
+			SceneBinaryBlockBuilder& block = *blocks.at(blockIndex);
+			memcpy(fileData.data() + blockTableOffset + blockIndex * sizeof(Utility::SceneBinaryBlock), &block.m_Block, sizeof(Utility::SceneBinaryBlock));
+			memcpy(fileData.data() + block.m_Block.m_RecordOffset, block.m_Records.data(), block.m_Records.size());
+			memcpy(fileData.data() + block.m_Block.m_PoolOffset, block.m_Pool.data(), block.m_Pool.size());
+		}
+
+		Buffer fileBuffer{};
+		fileBuffer.Data = fileData.data();
+		fileBuffer.Size = fileData.size();
+		if (!Utility::FileSystem::WriteFileBinary(binaryPath, fileBuffer))
+		{
+			KG_WARN("Failed to write binary scene intermediate at {}", binaryPath.string());
+		}
+	}
+	bool SceneManager::PrepareSceneBinary(ScenePreload& preload, const AssetInfo& assetInfo, const std::filesystem::path& assetPath)
+	{
+		std::error_code fileSizeError;
+		uint64_t sourceFileSize = std::filesystem::file_size(assetPath, fileSizeError);
+		if (assetInfo.m_Handle == Assets::EmptyHandle || fileSizeError)
+		{
+			return false;
+		}
+		preload.m_SceneHandle = assetInfo.m_Handle;
+		preload.m_BinaryPath = GetSceneBinaryLocation(assetInfo.m_Handle);
+		preload.m_SourceChecksum = assetInfo.Data.CheckSum;
+		preload.m_SourceFileSize = sourceFileSize;
+
+		// Fetch the project components here, so loading the intermediate does not touch the asset caches
+		for (auto& [handle, asset] : Assets::AssetService::GetProjectComponentRegistry())
+		{
+			preload.m_ProjectComponents.insert({ handle, Assets::AssetService::GetProjectComponent(handle) });
+		}
+		preload.m_Scene = CreateRef<Scenes::Scene>();
+		return true;
+	}
+
+	bool SceneManager::LoadSceneBinary(ScenePreload& preload)
+	{
+		if (!preload.m_Scene)
+		{
+			return false;
+		}
+
+		// Map the intermediate into memory. It may not exist yet.
+		MappedFile& file = preload.m_File;
+		if (!file.Open(preload.m_BinaryPath))
+		{
+			return false;
+		}
+		const uint8_t* fileData = file.GetData();
+		const uint64_t fileSize = file.GetSize();
+
+		// Ensure the intermediate matches the current version and scene file
+		if (fileSize < sizeof(Utility::SceneBinaryHeader))
+		{
+			return false;
+		}
+		const Utility::SceneBinaryHeader& header = *(const Utility::SceneBinaryHeader*)fileData;
+		if (header.m_Magic != Utility::k_SceneBinaryMagic || header.m_Version != Utility::k_SceneBinaryVersion ||
+			header.m_SourceFileSize != preload.m_SourceFileSize ||
+			std::string_view(header.m_SourceChecksum, Utility::k_SceneChecksumSize) != preload.m_SourceChecksum)
+		{
+			return false;
+		}
+
+		// Ensure the entity list and block table are inside the file
+		uint64_t entitiesOffset = Utility::AlignSceneBinarySize(sizeof(Utility::SceneBinaryHeader));
+		uint64_t blockTableOffset = Utility::AlignSceneBinarySize(entitiesOffset + (uint64_t)header.m_EntityCount * sizeof(uint64_t));
+		if (blockTableOffset + (uint64_t)header.m_BlockCount * sizeof(Utility::SceneBinaryBlock) > fileSize)
+		{
+			KG_WARN("Binary scene intermediate at {} is truncated", preload.m_BinaryPath.string());
+			return false;
+		}
+		const uint64_t* entityIDs = (const uint64_t*)(fileData + entitiesOffset);
+		const Utility::SceneBinaryBlock* blocks = (const Utility::SceneBinaryBlock*)(fileData + blockTableOffset);
+
+		// Validate each block and find the project components they refer to
+		std::vector<ECS::ProjectComponent*> blockProjectComponents(header.m_BlockCount);
+		for (uint32_t blockIndex{ 0 }; blockIndex < header.m_BlockCount; blockIndex++)
+		{
+			const Utility::SceneBinaryBlock& block = blocks[blockIndex];
+			uint32_t expectedStride{ Utility::GetSceneBinaryRecordStride(block.m_ComponentType) };
+			if (block.m_ComponentType == ECS::ComponentType::ProjectComponent)
+			{
+				// Project components may have changed since the intermediate was written
+				auto projectComponentIt = preload.m_ProjectComponents.find(block.m_ProjectComponentHandle);
+				ECS::ProjectComponent* projectComponent = projectComponentIt != preload.m_ProjectComponents.end() ?
+					projectComponentIt->second.get() : nullptr;
+				if (!projectComponent || projectComponent->m_BufferSize == 0 ||
+					Utility::GetProjectComponentLayoutHash(*projectComponent) != block.m_LayoutHash)
+				{
+					return false;
+				}
+				expectedStride = Utility::GetProjectComponentRecordStride(*projectComponent);
+				blockProjectComponents.at(blockIndex) = projectComponent;
+			}
+
+			if (expectedStride == 0 || block.m_RecordStride != expectedStride ||
+				block.m_RecordOffset % Utility::k_SceneBinaryAlignment != 0 ||
+				block.m_RecordOffset + (uint64_t)block.m_RecordCount * block.m_RecordStride > fileSize ||
+				block.m_PoolOffset + block.m_PoolSize > fileSize)
+			{
+				KG_WARN("Invalid block found in binary scene intermediate at {}", preload.m_BinaryPath.string());
+				return false;
+			}
+		}
+
+		Ref<Scenes::Scene> newScene = preload.m_Scene;
+		newScene->m_PhysicsSpecification.Gravity = header.m_Gravity;
+		newScene->m_BackgroundColor = header.m_BackgroundColor;
+		ECS::EntityRegistry& entityRegistry = newScene->m_EntityRegistry;
+		entt::registry& registry = entityRegistry.m_EnTTRegistry;
+
+		// Create all entities along with the ID, transform, and tag components every entity holds
+		std::vector<entt::entity>& entities = preload.m_Entities;
+		entities.resize(header.m_EntityCount);
+		registry.create(entities.begin(), entities.end());
+		auto& idStorage = registry.storage<ECS::IDComponent>();
+		auto& transformStorage = registry.storage<ECS::TransformComponent>();
+		auto& tagStorage = registry.storage<ECS::TagComponent>();
+		idStorage.reserve(entities.size());
+		transformStorage.reserve(entities.size());
+		tagStorage.reserve(entities.size());
+		entityRegistry.m_EntityMap.reserve(entities.size());
+		for (size_t entityIndex{ 0 }; entityIndex < entities.size(); entityIndex++)
+		{
+			idStorage.emplace(entities.at(entityIndex), UUID(entityIDs[entityIndex]));
+			transformStorage.emplace(entities.at(entityIndex));
+			tagStorage.emplace(entities.at(entityIndex), "Entity");
+			entityRegistry.m_EntityMap[entityIDs[entityIndex]] = entities.at(entityIndex);
+		}
+
+		// Create the remaining storages up front. The registry's storage map is not thread-safe,
+		//		while separate storages can be filled concurrently.
+		registry.storage<ECS::OnUpdateComponent>();
+		registry.storage<ECS::OnCreateComponent>();
+		registry.storage<ECS::ParticleEmitterComponent>();
+		registry.storage<ECS::AIStateComponent>();
+		registry.storage<ECS::CameraComponent>();
+		registry.storage<ECS::ShapeComponent>();
+		registry.storage<ECS::Rigidbody2DComponent>();
+		registry.storage<ECS::BoxCollider2DComponent>();
+		registry.storage<ECS::CircleCollider2DComponent>();
+
+		// Fill every component storage in parallel
+		JobService::ParallelFor(header.m_BlockCount, 1, [&](size_t begin, size_t end)
+		{
+			for (size_t blockIndex{ begin }; blockIndex < end; blockIndex++)
+			{
+				Utility::LoadSceneBinaryBlock(entityRegistry, entities, fileData, blocks[blockIndex], blockProjectComponents.at(blockIndex));
+			}
+		});
+
+		preload.m_BlockTableOffset = blockTableOffset;
+		preload.m_BlockCount = header.m_BlockCount;
+		preload.m_EntitiesLoaded = true;
+		return true;
+	}
+
+	void SceneManager::ResolveSceneBinary(ScenePreload& preload)
+	{
+		KG_ASSERT(preload.m_EntitiesLoaded);
+		const uint8_t* fileData = preload.m_File.GetData();
+		const uint64_t* entityIDs = (const uint64_t*)(fileData + Utility::AlignSceneBinarySize(sizeof(Utility::SceneBinaryHeader)));
+		const Utility::SceneBinaryBlock* blocks = (const Utility::SceneBinaryBlock*)(fileData + preload.m_BlockTableOffset);
+		entt::registry& registry = preload.m_Scene->m_EntityRegistry.m_EnTTRegistry;
+
+		// Resolve asset references
+		for (uint32_t blockIndex{ 0 }; blockIndex < preload.m_BlockCount; blockIndex++)
+		{
+			Utility::ResolveSceneBinaryBlock(registry, preload.m_Entities, fileData, blocks[blockIndex]);
+		}
+
+		// Notify listeners of the new entities, as Scene::CreateEntityWithUUID() does
+		for (size_t entityIndex{ 0 }; entityIndex < preload.m_Entities.size(); entityIndex++)
+		{
+			Events::ManageEntity event = { UUID(entityIDs[entityIndex]), preload.m_Scene.get(), Events::ManageEntityAction::Create };
+			EngineService::OnEvent(&event);
+		}
+
+		// The intermediate is no longer needed once all references are resolved
+		preload.m_File.Close();
+	}
+
+	Ref<ScenePreload> SceneManager::CreateScenePreload(AssetHandle sceneHandle)
+	{
+		if (!m_AssetRegistry.contains(sceneHandle))
+		{
+			KG_WARN("Attempt to preload scene with invalid handle {}", sceneHandle);
+			return nullptr;
+		}
+
+		Ref<ScenePreload> preload = CreateRef<ScenePreload>();
+		const AssetInfo& assetInfo = m_AssetRegistry.at(sceneHandle);
+		PrepareSceneBinary(*preload, assetInfo, Projects::ProjectService::GetActiveAssetDirectory() / assetInfo.Data.FileLocation);
+		preload->m_SceneHandle = sceneHandle;
+		return preload;
+	}
+
+	void SceneManager::LoadScenePreloadEntities(ScenePreload& preload)
+	{
+		// Scenes without an up to date intermediate are loaded by FinishScenePreload() instead
+		if (!LoadSceneBinary(preload))
+		{
+			return;
+		}
+
+		// Gather the assets referenced by the scene, so the main thread can load them ahead of the transition
+		entt::registry& registry = preload.m_Scene->m_EntityRegistry.m_EnTTRegistry;
+		std::vector<std::pair<AssetType, AssetHandle>>& assets = preload.m_Assets;
+		registry.view<ECS::OnUpdateComponent>().each([&](ECS::OnUpdateComponent& component)
+		{
+			assets.push_back({ AssetType::Script, component.OnUpdateScriptHandle });
+		});
+		registry.view<ECS::OnCreateComponent>().each([&](ECS::OnCreateComponent& component)
+		{
+			assets.push_back({ AssetType::Script, component.OnCreateScriptHandle });
+		});
+		registry.view<ECS::ParticleEmitterComponent>().each([&](ECS::ParticleEmitterComponent& component)
+		{
+			assets.push_back({ AssetType::EmitterConfig, component.m_EmitterConfigHandle });
+		});
+		registry.view<ECS::AIStateComponent>().each([&](ECS::AIStateComponent& component)
+		{
+			assets.push_back({ AssetType::AIState, component.CurrentStateHandle });
+			assets.push_back({ AssetType::AIState, component.PreviousStateHandle });
+			assets.push_back({ AssetType::AIState, component.GlobalStateHandle });
+		});
+		registry.view<ECS::Rigidbody2DComponent>().each([&](ECS::Rigidbody2DComponent& component)
+		{
+			assets.push_back({ AssetType::Script, component.OnCollisionStartScriptHandle });
+			assets.push_back({ AssetType::Script, component.OnCollisionEndScriptHandle });
+		});
+		registry.view<ECS::ShapeComponent>().each([&](ECS::ShapeComponent& component)
+		{
+			assets.push_back({ AssetType::Texture, component.TextureHandle });
+			assets.push_back({ AssetType::Shader, component.ShaderHandle });
+		});
+
+		// Remove empty and repeated references
+		std::erase_if(assets, [](const std::pair<AssetType, AssetHandle>& asset)
+		{
+			return asset.second == Assets::EmptyHandle;
+		});
+		std::sort(assets.begin(), assets.end());
+		assets.erase(std::unique(assets.begin(), assets.end()), assets.end());
+	}
+
+	bool SceneManager::LoadScenePreloadAssets(ScenePreload& preload, size_t maxAssetCount)
+	{
+		KG_ASSERT(preload.m_LoadCounter.IsDone(), "Attempt to load scene assets before its entities are loaded");
+
+		// Loading the asset fills its manager's cache, so resolving the scene later only performs lookups
+		size_t assetCount{ 0 };
+		while (preload.m_AssetsLoaded < preload.m_Assets.size() && assetCount < maxAssetCount)
+		{
+			auto [assetType, assetHandle] = preload.m_Assets.at(preload.m_AssetsLoaded);
+			switch (assetType)
+			{
+			case AssetType::Script:
+				Assets::AssetService::GetScript(assetHandle);
+				break;
+			case AssetType::EmitterConfig:
+				Assets::AssetService::GetEmitterConfig(assetHandle);
+				break;
+			case AssetType::AIState:
+				Assets::AssetService::GetAIState(assetHandle);
+				break;
+			case AssetType::Texture:
+				preload.m_TextureRequests.push_back(Assets::AssetService::GetTexture2DAsync(assetHandle));
+				break;
+			case AssetType::Shader:
+				Assets::AssetService::GetShader(assetHandle);
+				break;
+			default:
+				KG_ERROR("Invalid asset type found while preloading scene");
+				break;
+			}
+			preload.m_AssetsLoaded++;
+			assetCount++;
+		}
+
+		if (preload.m_AssetsLoaded < preload.m_Assets.size())
+		{
+			return false;
+		}
+		return std::all_of(preload.m_TextureRequests.begin(), preload.m_TextureRequests.end(),
+			[](const Ref<AssetLoadRequest<Rendering::Texture2D>>& request)
+		{
+			return request->IsReady();
+		});
+	}
+
+	Ref<Scenes::Scene> SceneManager::FinishScenePreload(ScenePreload& preload)
+	{
+		JobService::WaitForCounter(preload.m_LoadCounter);
+
+		// Fall back to a regular load, which also regenerates the intermediate
+		if (!preload.m_EntitiesLoaded)
+		{
+			preload.m_File.Close();
+			return GetAsset(preload.m_SceneHandle);
+		}
+
+		LoadScenePreloadAssets(preload, SIZE_MAX);
+		ResolveSceneBinary(preload);
+		return preload.m_Scene;
+	}
+
 	bool SceneManager::RemoveScript(Ref<Scenes::Scene> sceneRef, Assets::AssetHandle scriptHandle)
 	{
 		bool sceneModified{ false };
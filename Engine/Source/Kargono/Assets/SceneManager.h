@@ -1,10 +1,45 @@
 #pragma once
 #include "Kargono/Assets/AssetManager.h"
+#include "Kargono/Core/JobSystem.h"
+#include "Kargono/Core/MappedFile.h"
+#include "API/EntityComponentSystem/enttAPI.h"
 
 namespace Kargono::Scenes { class Scene; }
+namespace Kargono::ECS { struct ProjectComponent; }
+namespace Kargono::Rendering { class Texture2D; }
 
 namespace Kargono::Assets
 {
+	//==============================
+	// Scene Preload Struct
+	//==============================
+	// Holds a scene while it is loaded ahead of time. The entities and components are built from the
+	//		scene's binary intermediate by a background job. Asset caches and GPU resources are only
+	//		touched on the main thread, which loads the referenced assets and finishes the scene.
+	struct ScenePreload
+	{
+		AssetHandle m_SceneHandle{ EmptyHandle };
+		Ref<Scenes::Scene> m_Scene{ nullptr };
+		// Gathered on the main thread before loading starts
+		std::filesystem::path m_BinaryPath{};
+		std::string m_SourceChecksum{};
+		uint64_t m_SourceFileSize{ 0 };
+		std::unordered_map<AssetHandle, Ref<ECS::ProjectComponent>> m_ProjectComponents{};
+		// Written while loading the binary intermediate
+		MappedFile m_File{};
+		std::vector<entt::entity> m_Entities{};
+		uint64_t m_BlockTableOffset{ 0 };
+		uint32_t m_BlockCount{ 0 };
+		bool m_EntitiesLoaded{ false };
+		std::vector<std::pair<AssetType, AssetHandle>> m_Assets{};
+		// Tracks the background job
+		JobCounter m_LoadCounter{};
+		// Number of m_Assets loaded by the main thread. Textures are read by worker threads, so they are
+		//		tracked until their requests are ready.
+		size_t m_AssetsLoaded{ 0 };
+		std::vector<Ref<AssetLoadRequest<Rendering::Texture2D>>> m_TextureRequests{};
+	};
+
 	class SceneManager : public AssetManager<Scenes::Scene>
 	{
 	public:
@@ -28,10 +63,28 @@ namespace Kargono::Assets
 		virtual void CreateAssetFileFromName(std::string_view name, AssetInfo& asset, const std::filesystem::path& assetPath) override;
 		virtual void SerializeAsset(Ref<Scenes::Scene> assetReference, const std::filesystem::path& assetPath) override;
 		virtual Ref<Scenes::Scene> DeserializeAsset(Assets::AssetInfo& asset, const std::filesystem::path& assetPath) override;
+		virtual void DeleteAssetValidation(AssetHandle assetHandle) override;
 
 		bool RemoveScript(Ref<Scenes::Scene> sceneRef, Assets::AssetHandle scriptHandle);
 		bool RemoveAIState(Ref<Scenes::Scene> sceneRef, Assets::AssetHandle aiStateHandle);
 		bool RemoveProjectComponent(Ref<Scenes::Scene> sceneRef, Assets::AssetHandle projectCompHandle);
 		bool RemoveEmitterConfig(Ref<Scenes::Scene> sceneRef, Assets::AssetHandle emitterConfigHandle);
+
+		// Preloading stages. CreateScenePreload(), LoadScenePreloadAssets(), and FinishScenePreload() must
+		//		be called from the main thread, while LoadScenePreloadEntities() may run on any thread.
+		Ref<ScenePreload> CreateScenePreload(AssetHandle sceneHandle);
+		void LoadScenePreloadEntities(ScenePreload& preload);
+		// Loads up to maxAssetCount referenced assets. Returns true once all assets are loaded.
+		bool LoadScenePreloadAssets(ScenePreload& preload, size_t maxAssetCount);
+		Ref<Scenes::Scene> FinishScenePreload(ScenePreload& preload);
+	private:
+		// Scenes keep a binary intermediate next to their YAML file. It is regenerated whenever it does
+		//		not match the scene file, and loaded instead of the YAML otherwise.
+		std::filesystem::path GetSceneBinaryLocation(AssetHandle sceneHandle);
+		void SerializeSceneBinary(Ref<Scenes::Scene> sceneReference, const std::filesystem::path& binaryPath, 
+			const std::string& sourceChecksum, uint64_t sourceFileSize);
+		bool PrepareSceneBinary(ScenePreload& preload, const AssetInfo& assetInfo, const std::filesystem::path& assetPath);
+		bool LoadSceneBinary(ScenePreload& preload);
+		void ResolveSceneBinary(ScenePreload& preload);
 	};
 }
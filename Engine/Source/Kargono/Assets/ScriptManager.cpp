@@ -52,7 +52,7 @@ namespace Kargono::Assets
 		m_AssetRegistry.insert({ newHandle, newAsset }); // Update Registry Map in-memory
 		SerializeAssetRegistry(); // Update Registry File on Disk
 
-		m_AssetCache.insert({ newHandle, DeserializeAsset(newAsset, Projects::ProjectService::GetActiveAssetDirectory() / newAsset.Data.FileLocation) });
+		AddToAssetCache(newHandle, DeserializeAsset(newAsset, Projects::ProjectService::GetActiveAssetDirectory() / newAsset.Data.FileLocation));
 
 		Ref<Events::ManageAsset> event = CreateRef<Events::ManageAsset>
 		(
@@ -322,7 +322,7 @@ namespace Kargono::Assets
 
 			// Insert Engine Script into registry/in-memory
 			m_AssetRegistry.insert({ newAsset.m_Handle, newAsset });
-			m_AssetCache.insert({ newAsset.m_Handle, script });
+			AddToAssetCache(newAsset.m_Handle, script);
 		}
 
 		// Get Section Labels
@@ -178,7 +178,7 @@ namespace Kargono::Assets
 		m_AssetRegistry.insert({ newHandle, newAsset }); // Update Registry Map in-memory
 		SerializeAssetRegistry(); // Update Registry File on Disk
 		Ref<Kargono::Rendering::Shader> newShader = DeserializeAsset(newAsset, Projects::ProjectService::GetActiveIntermediateDirectory() / newAsset.Data.IntermediateLocation);
-		m_AssetCache.insert({ newHandle, newShader });
+		AddToAssetCache(newHandle, newShader);
 
 		Ref<Events::ManageAsset> event = CreateRef<Events::ManageAsset>
 		(
@@ -210,7 +210,7 @@ namespace Kargono::Assets
 			{
 				Ref<Kargono::Rendering::Shader> newShader = DeserializeAsset(asset, 
 					Projects::ProjectService::GetActiveIntermediateDirectory() / asset.Data.IntermediateLocation);
-				m_AssetCache.insert({ asset.m_Handle, newShader });
+				AddToAssetCache(asset.m_Handle, newShader);
 				return std::make_tuple(assetHandle, newShader);
 			}
 		}
@@ -313,6 +313,7 @@ namespace Kargono::Assets
 		serializer << YAML::Key << "TextureInput" << YAML::Value << Utility::TextureInputTypeToString(metadata->ShaderSpec.TextureInput);
 		serializer << YAML::Key << "DrawOutline" << YAML::Value << metadata->ShaderSpec.DrawOutline;
 		serializer << YAML::Key << "RenderType" << YAML::Value << Utility::RenderingTypeToString(metadata->ShaderSpec.RenderType);
+		serializer << YAML::Key << "DrawInstanced" << YAML::Value << metadata->ShaderSpec.DrawInstanced;
 
 		// InputBufferLayout Section
 		serializer << YAML::Key << "InputBufferLayout" << YAML::Value << YAML::BeginMap; // Input Buffer Layout Map
@@ -352,6 +353,11 @@ namespace Kargono::Assets
 		shaderMetaData->ShaderSpec.TextureInput = Utility::StringToTextureInputType(metadataNode["TextureInput"].as<std::string>());
 		shaderMetaData->ShaderSpec.DrawOutline = metadataNode["DrawOutline"].as<bool>();
 		shaderMetaData->ShaderSpec.RenderType = Utility::StringToRenderingType(metadataNode["RenderType"].as<std::string>());
+		// Registries written before instanced shaders existed do not contain this key
+		if (metadataNode["DrawInstanced"])
+		{
+			shaderMetaData->ShaderSpec.DrawInstanced = metadataNode["DrawInstanced"].as<bool>();
+		}
 
 		static_assert(sizeof(uint8_t) * 20 == sizeof(Rendering::ShaderSpecification));
 
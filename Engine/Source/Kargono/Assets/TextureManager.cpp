@@ -3,6 +3,7 @@
 #include "Kargono/Assets/AssetService.h"
 #include "Kargono/Assets/TextureManager.h"
 #include "Kargono/Rendering/Texture.h"
+#include "Kargono/Rendering/TextureCompression.h"
 
 #include "API/ImageProcessing/stbAPI.h"
 
@@ -52,7 +53,7 @@ namespace Kargono::Assets
 		if (m_Flags.test(AssetManagerOptions::HasAssetCache))
 		{
 			std::filesystem::path assetPath = Projects::ProjectService::GetActiveIntermediateDirectory() / newAsset.Data.IntermediateLocation;
-			m_AssetCache.insert({ newHandle, DeserializeAsset(newAsset, assetPath) });
+			AddToAssetCache(newHandle, DeserializeAsset(newAsset, assetPath));
 		}
 
 		Ref<Events::ManageAsset> event = CreateRef<Events::ManageAsset>
@@ -82,18 +83,30 @@ namespace Kargono::Assets
 
 	Ref<Rendering::Texture2D> Texture2DManager::DeserializeAsset(Assets::AssetInfo& asset, const std::filesystem::path& assetPath)
 	{
-		Assets::TextureMetaData metadata = *asset.Data.GetSpecificMetaData<TextureMetaData>();
 		Buffer currentResource = Utility::FileSystem::ReadFileBinary(assetPath);
-		Ref<Rendering::Texture2D> newTexture = Rendering::Texture2D::Create(currentResource, metadata);
+		Ref<Rendering::Texture2D> newTexture = CreateAssetFromFileData(asset, currentResource);
 		currentResource.Release();
 		return newTexture;
 	}
+	Ref<Rendering::Texture2D> Texture2DManager::CreateAssetFromFileData(Assets::AssetInfo& asset, Buffer fileData)
+	{
+		Assets::TextureMetaData metadata = *asset.Data.GetSpecificMetaData<TextureMetaData>();
+		return Rendering::Texture2D::Create(fileData, metadata);
+	}
+	uint64_t Texture2DManager::GetAssetMemoryCost(Assets::AssetInfo& asset)
+	{
+		Assets::TextureMetaData* metadata = asset.Data.GetSpecificMetaData<TextureMetaData>();
+		std::vector<Rendering::TextureMipLevel> layout = Utility::GetTextureMipLayout(*metadata);
+		return layout.at(0).m_Offset + layout.at(0).m_Size;
+	}
 	void Texture2DManager::SerializeAssetSpecificMetadata(YAML::Emitter& serializer, Assets::AssetInfo& currentAsset)
 	{
 		Assets::TextureMetaData* metadata = static_cast<Assets::TextureMetaData*>(currentAsset.Data.SpecificFileData.get());
 		serializer << YAML::Key << "TextureHeight" << YAML::Value << metadata->Height;
 		serializer << YAML::Key << "TextureWidth" << YAML::Value << metadata->Width;
 		serializer << YAML::Key << "TextureChannels" << YAML::Value << metadata->Channels;
+		serializer << YAML::Key << "TextureCompression" << YAML::Value << Utility::TextureCompressionToString(metadata->Compression);
+		serializer << YAML::Key << "TextureMipCount" << YAML::Value << metadata->MipCount;
 	}
 
 	void Texture2DManager::CreateAssetFileFromName(std::string_view name, AssetInfo& asset, const std::filesystem::path& assetPath)
@@ -112,35 +125,42 @@ namespace Kargono::Assets
 
 	void Texture2DManager::CreateAssetIntermediateFromFile(AssetInfo& newAsset, const std::filesystem::path& fullFileLocation, const std::filesystem::path& fullIntermediateLocation)
 	{
-		// Create Texture Binary Intermediate
+		// Load image from file
 		int32_t width, height, channels;
 		stbi_set_flip_vertically_on_load(1);
-		Buffer buffer{};
 		stbi_uc* data = nullptr;
 		{
 			data = stbi_load(fullFileLocation.string().c_str(), &width, &height, &channels, 0);
 		}
 
-		buffer.Allocate(static_cast<unsigned long long>(width) * height * channels * sizeof(uint8_t));
-		buffer.Data = data;
-
-		// Save Binary Intermediate into File
-		Utility::FileSystem::WriteFileBinary(fullIntermediateLocation, buffer);
-
-		// Check that save was successful
+		// Check that load was successful
 		if (!data)
 		{
 			KG_ERROR("Failed to load data from file in texture importer!");
-			buffer.Release();
 			return;
 		}
 
+		// Textures are stored as RGB or RGBA, so expand grayscale images
+		if (channels < 3)
+		{
+			stbi_image_free(data);
+			data = stbi_load(fullFileLocation.string().c_str(), &width, &height, &channels, 4);
+			channels = 4;
+		}
+
 		// Load data into In-Memory Metadata object
 		Ref<Assets::TextureMetaData> metadata = CreateRef<Assets::TextureMetaData>();
 		metadata->Width = width;
 		metadata->Height = height;
 		metadata->Channels = channels;
+		metadata->Compression = Utility::SelectTextureCompression(width, height, channels);
+		metadata->MipCount = Utility::GetTextureMipCount(width, height);
 		newAsset.Data.SpecificFileData = metadata;
+
+		// Encode the mip chain and save it as the binary intermediate
+		Buffer buffer = Utility::CreateTextureMipChain(data, *metadata);
+		stbi_image_free(data);
+		Utility::FileSystem::WriteFileBinary(fullIntermediateLocation, buffer);
 		buffer.Release();
 	}
 
@@ -151,6 +171,15 @@ namespace Kargono::Assets
 		texMetaData->Height = metadataNode["TextureHeight"].as<int32_t>();
 		texMetaData->Width = metadataNode["TextureWidth"].as<int32_t>();
 		texMetaData->Channels = metadataNode["TextureChannels"].as<int32_t>();
+		// Intermediates created before compression support hold a single uncompressed level
+		if (metadataNode["TextureCompression"])
+		{
+			texMetaData->Compression = Utility::StringToTextureCompression(metadataNode["TextureCompression"].as<std::string>());
+		}
+		if (metadataNode["TextureMipCount"])
+		{
+			texMetaData->MipCount = metadataNode["TextureMipCount"].as<uint32_t>();
+		}
 
 		currentAsset.Data.SpecificFileData = texMetaData;
 	}
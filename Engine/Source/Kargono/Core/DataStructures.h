@@ -7,6 +7,10 @@
 #include <cstdint>
 #include <type_traits>
 #include <concepts>
+#include <atomic>
+#include <memory>
+#include <bit>
+#include <new>
 
 #include <Kargono/Core/Iterator.h>
 #include "Kargono/Core/Base.h"
@@ -85,6 +89,230 @@ namespace Kargono
 	};
 
 
+	// Bounded multi-producer/single-consumer queue. Producers claim slots with a single CAS on the
+	//		enqueue position and publish them through a per-slot sequence number, so neither side ever
+	//		takes a lock. Push fails (returns false) once the queue is full.
+	template<typename T>
+	class BoundedMPSCQueue
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		BoundedMPSCQueue() = default;
+		BoundedMPSCQueue(const BoundedMPSCQueue&) = delete;
+		BoundedMPSCQueue& operator=(const BoundedMPSCQueue&) = delete;
+		~BoundedMPSCQueue()
+		{
+			Terminate();
+		}
+
+		//==============================
+		// Lifecycle Functions
+		//==============================
+		void Init(size_t capacity)
+		{
+			KG_ASSERT(!m_Slots);
+			KG_ASSERT(capacity > 0);
+
+			// Capacity must be a power of two to allow masking the positions
+			m_Capacity = std::bit_ceil(capacity);
+			m_Slots = std::make_unique<Slot[]>(m_Capacity);
+			for (size_t index{ 0 }; index < m_Capacity; index++)
+			{
+				m_Slots[index].m_Sequence.store(index, std::memory_order_relaxed);
+			}
+			m_EnqueuePosition.store(0, std::memory_order_relaxed);
+			m_DequeuePosition = 0;
+		}
+
+		void Terminate()
+		{
+			if (!m_Slots)
+			{
+				return;
+			}
+
+			// Destroy any items that were never consumed
+			while (TryPop()) {}
+			m_Slots.reset();
+			m_Capacity = 0;
+		}
+
+		//==============================
+		// Modify Queue
+		//==============================
+		// Safe to call from any number of threads
+		bool TryPush(T&& item)
+		{
+			KG_ASSERT(m_Slots);
+
+			size_t position{ m_EnqueuePosition.load(std::memory_order_relaxed) };
+			while (true)
+			{
+				Slot& slot{ m_Slots[position & (m_Capacity - 1)] };
+				size_t sequence{ slot.m_Sequence.load(std::memory_order_acquire) };
+				intptr_t difference{ (intptr_t)sequence - (intptr_t)position };
+
+				if (difference == 0)
+				{
+					// Slot is free for this position, attempt to claim it
+					if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						new (slot.m_Storage) T(std::move(item));
+						slot.m_Sequence.store(position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					// Slot has not been consumed yet (queue is full)
+					return false;
+				}
+				else
+				{
+					// Another producer claimed this position
+					position = m_EnqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// Only call from the single consumer thread
+		std::optional<T> TryPop()
+		{
+			KG_ASSERT(m_Slots);
+
+			Slot& slot{ m_Slots[m_DequeuePosition & (m_Capacity - 1)] };
+			size_t sequence{ slot.m_Sequence.load(std::memory_order_acquire) };
+			if (sequence != m_DequeuePosition + 1)
+			{
+				return std::nullopt;
+			}
+
+			// Move the item out and release the slot for the next lap
+			T* itemPointer{ std::launder(reinterpret_cast<T*>(slot.m_Storage)) };
+			std::optional<T> item{ std::move(*itemPointer) };
+			itemPointer->~T();
+			slot.m_Sequence.store(m_DequeuePosition + m_Capacity, std::memory_order_release);
+			m_DequeuePosition++;
+			return item;
+		}
+
+		//==============================
+		// Query Queue
+		//==============================
+		size_t GetCapacity() const
+		{
+			return m_Capacity;
+		}
+	private:
+		struct Slot
+		{
+			std::atomic<size_t> m_Sequence{ 0 };
+			alignas(T) unsigned char m_Storage[sizeof(T)];
+		};
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		std::unique_ptr<Slot[]> m_Slots{ nullptr };
+		size_t m_Capacity{ 0 };
+		// Producer and consumer positions live on separate cache lines
+		alignas(64) std::atomic<size_t> m_EnqueuePosition{ 0 };
+		alignas(64) size_t m_DequeuePosition{ 0 };
+	};
+
+	// Multi-producer/single-consumer work queue that never rejects items. Items normally go through
+	//		a lock-free BoundedMPSCQueue. Only when the ring is full do producers spill into a
+	//		mutex-guarded overflow buffer, which is then used until the consumer drains it so each
+	//		producer's items stay in submission order.
+	template<typename T>
+	class MPSCWorkQueue
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		MPSCWorkQueue(size_t capacity)
+		{
+			m_Ring.Init(capacity);
+			m_DrainCache.reserve(m_Ring.GetCapacity());
+		}
+		~MPSCWorkQueue() = default;
+		MPSCWorkQueue(const MPSCWorkQueue&) = delete;
+		MPSCWorkQueue& operator=(const MPSCWorkQueue&) = delete;
+
+		//==============================
+		// Modify Queue
+		//==============================
+		// Safe to call from any number of threads
+		void Push(T&& item)
+		{
+			if (!m_OverflowActive.load(std::memory_order_acquire) && m_Ring.TryPush(std::move(item)))
+			{
+				return;
+			}
+
+			// Ring is full (or already spilling), so fall back to the locked overflow buffer
+			std::scoped_lock<std::mutex> lock(m_OverflowMutex);
+			m_Overflow.push_back(std::move(item));
+			m_OverflowActive.store(true, std::memory_order_release);
+		}
+
+		// Swap out all currently queued items and invoke the consumer on each of them. Items pushed
+		//		while the consumer runs are left for the next call. Only call from the consumer thread.
+		template<typename ConsumerFunc>
+		void Drain(ConsumerFunc&& consumer)
+		{
+			KG_ASSERT(m_DrainCache.empty());
+
+			// Move the ring's items into the local cache
+			while (std::optional<T> item = m_Ring.TryPop())
+			{
+				m_DrainCache.push_back(std::move(*item));
+			}
+
+			// Overflow items were submitted after the ring's items
+			if (m_OverflowActive.load(std::memory_order_acquire))
+			{
+				std::scoped_lock<std::mutex> lock(m_OverflowMutex);
+				for (T& item : m_Overflow)
+				{
+					m_DrainCache.push_back(std::move(item));
+				}
+				m_Overflow.clear();
+				m_OverflowActive.store(false, std::memory_order_release);
+			}
+
+			for (T& item : m_DrainCache)
+			{
+				consumer(item);
+			}
+			m_DrainCache.clear();
+		}
+
+		// Discard all queued items. Only call from the consumer thread.
+		void Clear()
+		{
+			while (m_Ring.TryPop()) {}
+
+			std::scoped_lock<std::mutex> lock(m_OverflowMutex);
+			m_Overflow.clear();
+			m_OverflowActive.store(false, std::memory_order_release);
+		}
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		BoundedMPSCQueue<T> m_Ring{};
+		// Consumer-only buffer reused between drains
+		std::vector<T> m_DrainCache{};
+		// Fallback storage used while the ring is full
+		std::atomic<bool> m_OverflowActive{ false };
+		std::mutex m_OverflowMutex{};
+		std::vector<T> m_Overflow{};
+	};
+
 	template<typename T, std::unsigned_integral IndexType = size_t>
 	struct EmplaceResult
 	{
@@ -7,6 +7,7 @@
 #include "Kargono/Physics/Physics2D.h"
 #include "Kargono/Rendering/RenderingService.h"
 #include "Kargono/Core/Profiler.h"
+#include "Kargono/Core/JobSystem.h"
 #include "Kargono/Utility/Timers.h"
 #include "Kargono/Events/NetworkingEvent.h"
 #include "Kargono/ECS/Entity.h"
@@ -55,6 +56,9 @@ namespace Kargono
 		// Set up event queue
 		s_ActiveEngine->m_EventQueue.Init(OnEvent);
 
+		// Start the job scheduler's worker threads
+		JobService::Init();
+
 		// Initialize current app (editor, runtime, server, etc...)
 		app->Init();
 	}
@@ -75,6 +79,9 @@ namespace Kargono
 		}
 		KG_VERIFY(!s_ActiveEngine->m_CurrentApp, "Application Terminated");
 
+		// Stop the job scheduler once no application code can submit jobs
+		JobService::Terminate();
+
 		delete s_ActiveEngine;
 		s_ActiveEngine = nullptr;
 		KG_VERIFY(!s_ActiveEngine, "Active Engine Terminated");
@@ -121,6 +128,8 @@ namespace Kargono
 				{
 					s_ActiveEngine->m_CurrentApp->OnUpdate(k_ConstantFrameTimeStep);
 				}
+				// Systems may fan out work during the update. Join it before handling events.
+				JobService::WaitForFrameJobs();
 				ProcessEventQueue();
 				s_ActiveEngine->m_Window->OnUpdate();
 			}
@@ -363,9 +372,9 @@ namespace Kargono
 		contactListener.SetEventCallback(EngineService::OnEvent);
 	}
 
-	void EngineService::SubmitToMainThread(const std::function<void()>& function)
+	void EngineService::SubmitToMainThread(FunctionQueue::Function function)
 	{
-		s_ActiveEngine->m_WorkQueue.SubmitFunction(function);
+		s_ActiveEngine->m_WorkQueue.SubmitFunction(std::move(function));
 	}
 
 	void EngineService::SubmitToEventQueue(Ref<Events::Event> e)
@@ -133,7 +133,7 @@ namespace Kargono
 		//==============================
 		// Submit to Event/Function Queues
 		//==============================
-		static void SubmitToMainThread(const std::function<void()>& function);
+		static void SubmitToMainThread(FunctionQueue::Function function);
 		static void SubmitToEventQueue(Ref<Events::Event> e);
 		static void SubmitApplicationCloseEvent();
 		//==============================
@@ -1,46 +1,23 @@
 #include "kgpch.h"
 #include "FunctionQueue.h"
 
-void FunctionQueue::SubmitFunction(const std::function<void()>& function)
+void FunctionQueue::SubmitFunction(Function function)
 {
-	// Obtain the function queue lock
-	std::scoped_lock<std::mutex> lock(m_FunctionQueueMutex);
-
-	// Add the function
-	m_FunctionQueue.emplace_back(function);
+	// Add the function (lock-free unless the queue overflows)
+	m_FunctionQueue.Push(std::move(function));
 }
 
 void FunctionQueue::ClearQueue()
 {
-	// Obtain the function queue lock
-	std::scoped_lock<std::mutex> lock(m_FunctionQueueMutex);
-
-	m_FunctionQueue.clear();
+	m_FunctionQueue.Clear();
 }
 
 void FunctionQueue::ProcessQueue()
 {
-	std::vector<std::function<void()>> localFunctionCache;
-
-	// Ensure the function queue doesn't become invalidated if one of the functions modifies the queue
-	// inside the loop
-	{
-		localFunctionCache.resize(m_FunctionQueue.size());
-
-		// Obtain the function queue lock
-		std::scoped_lock<std::mutex> lock(m_FunctionQueueMutex);
-
-		// Move the event queue into a local variable and reset the queue
-		localFunctionCache = std::move(m_FunctionQueue);
-
-		// Reset the queue
-		m_FunctionQueue.clear();
-	}
-
-
-	// Call all of the functions in the queue
-	for (std::function<void()>& func : localFunctionCache)
+	// Swap out the queued functions first, so functions that submit more work while running
+	// do not invalidate the loop. Their work is handled on the next call.
+	m_FunctionQueue.Drain([](Function& func)
 	{
 		func();
-	}
+	});
 }
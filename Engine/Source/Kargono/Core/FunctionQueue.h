@@ -1,10 +1,16 @@
 #pragma once
 
+#include "Kargono/Core/DataStructures.h"
+#include "Kargono/Core/InplaceFunction.h"
+
 #include <vector>
 #include <functional>
 
 class FunctionQueue
 {
+public:
+	// Queued callables are stored inline, so submitting a small lambda does not allocate
+	using Function = Kargono::InplaceFunction<void()>;
 public:
 	//=========================
 	// Constructor/Destructor
@@ -15,7 +21,9 @@ public:
 	//=========================
 	// Modify Queue
 	//=========================
-	void SubmitFunction(const std::function<void()>& function);
+	// Safe to call from any thread
+	void SubmitFunction(Function function);
+	// Only call from the thread processing the queue
 	void ClearQueue();
 
 	//=========================
@@ -26,6 +34,5 @@ private:
 	//=========================
 	// Internal Fields
 	//=========================
-	std::vector<std::function<void()>> m_FunctionQueue{};
-	std::mutex m_FunctionQueueMutex{};
+	Kargono::MPSCWorkQueue<Function> m_FunctionQueue{ 1024 };
 };
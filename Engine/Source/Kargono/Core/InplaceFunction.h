@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Kargono/Core/Base.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Kargono
+{
+	template<typename Signature, size_t k_BufferSize = 64>
+	class InplaceFunction;
+
+	// Move-only callable wrapper with small-buffer storage. Callables that fit inside k_BufferSize
+	//		are constructed directly inside the wrapper, so submitting a typical lambda performs no
+	//		heap allocation. Larger callables fall back to a single heap allocation.
+	template<typename ReturnType, typename... Args, size_t k_BufferSize>
+	class InplaceFunction<ReturnType(Args...), k_BufferSize>
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		InplaceFunction() = default;
+		InplaceFunction(std::nullptr_t) {}
+
+		template<typename Func>
+			requires (!std::is_same_v<std::decay_t<Func>, InplaceFunction> &&
+				std::is_invocable_r_v<ReturnType, std::decay_t<Func>&, Args...>)
+		InplaceFunction(Func&& func)
+		{
+			using StoredType = std::decay_t<Func>;
+			if constexpr (k_StoredInline<StoredType>)
+			{
+				new (m_Storage) StoredType(std::forward<Func>(func));
+			}
+			else
+			{
+				new (m_Storage) StoredType*(new StoredType(std::forward<Func>(func)));
+			}
+			m_Operations = &k_Operations<StoredType>;
+		}
+
+		InplaceFunction(InplaceFunction&& other) noexcept
+		{
+			MoveFrom(other);
+		}
+
+		InplaceFunction& operator=(InplaceFunction&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		InplaceFunction(const InplaceFunction&) = delete;
+		InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+		~InplaceFunction()
+		{
+			Reset();
+		}
+
+	public:
+		//==============================
+		// Invoke Function
+		//==============================
+		ReturnType operator()(Args... args)
+		{
+			KG_ASSERT(m_Operations);
+			return m_Operations->m_Invoke(m_Storage, std::forward<Args>(args)...);
+		}
+
+		//==============================
+		// Modify Function
+		//==============================
+		void Reset()
+		{
+			if (m_Operations)
+			{
+				m_Operations->m_Destroy(m_Storage);
+				m_Operations = nullptr;
+			}
+		}
+
+		//==============================
+		// Query Function
+		//==============================
+		explicit operator bool() const
+		{
+			return m_Operations != nullptr;
+		}
+	private:
+		// Table of type-erased operations for the stored callable
+		struct Operations
+		{
+			ReturnType(*m_Invoke)(void* storage, Args&&... args);
+			void(*m_MoveConstruct)(void* destination, void* source);
+			void(*m_Destroy)(void* storage);
+		};
+
+		template<typename Func>
+		static constexpr bool k_StoredInline
+		{
+			sizeof(Func) <= k_BufferSize &&
+			alignof(Func) <= alignof(std::max_align_t) &&
+			std::is_nothrow_move_constructible_v<Func>
+		};
+
+		template<typename Func>
+		static Func& GetCallable(void* storage)
+		{
+			if constexpr (k_StoredInline<Func>)
+			{
+				return *std::launder(reinterpret_cast<Func*>(storage));
+			}
+			else
+			{
+				return **std::launder(reinterpret_cast<Func**>(storage));
+			}
+		}
+
+		template<typename Func>
+		static constexpr Operations k_Operations
+		{
+			// Invoke
+			[](void* storage, Args&&... args) -> ReturnType
+			{
+				return GetCallable<Func>(storage)(std::forward<Args>(args)...);
+			},
+			// Move construct
+			[](void* destination, void* source)
+			{
+				if constexpr (k_StoredInline<Func>)
+				{
+					Func& sourceCallable{ GetCallable<Func>(source) };
+					new (destination) Func(std::move(sourceCallable));
+					sourceCallable.~Func();
+				}
+				else
+				{
+					// Only the heap pointer needs to be transferred
+					new (destination) Func*(*std::launder(reinterpret_cast<Func**>(source)));
+				}
+			},
+			// Destroy
+			[](void* storage)
+			{
+				if constexpr (k_StoredInline<Func>)
+				{
+					GetCallable<Func>(storage).~Func();
+				}
+				else
+				{
+					delete *std::launder(reinterpret_cast<Func**>(storage));
+				}
+			}
+		};
+
+		void MoveFrom(InplaceFunction& other)
+		{
+			if (other.m_Operations)
+			{
+				other.m_Operations->m_MoveConstruct(m_Storage, other.m_Storage);
+				m_Operations = other.m_Operations;
+				other.m_Operations = nullptr;
+			}
+		}
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		const Operations* m_Operations{ nullptr };
+		alignas(std::max_align_t) unsigned char m_Storage[k_BufferSize];
+	};
+}
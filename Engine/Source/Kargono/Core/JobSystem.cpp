@@ -0,0 +1,450 @@
+#include "kgpch.h"
+
+#include "Kargono/Core/JobSystem.h"
+
+#include "Kargono/Core/Profiler.h"
+
+#include <thread>
+#include <deque>
+
+namespace Kargono
+{
+	//==============================
+	// Job Struct
+	//==============================
+	struct Job
+	{
+		JobFunction m_Function{};
+		JobCounter* m_Counter{ nullptr };
+		// Pooled jobs are returned to their pool, others were allocated on the heap
+		std::atomic<bool> m_InUse{ false };
+		bool m_HeapAllocated{ false };
+	};
+
+	//==============================
+	// Work-Stealing Deque Class
+	//==============================
+	// Fixed-capacity Chase-Lev deque. Only the owning thread may call Push/Pop, any thread may Steal.
+	class JobDeque
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		JobDeque() = default;
+		JobDeque(const JobDeque&) = delete;
+		JobDeque& operator=(const JobDeque&) = delete;
+	public:
+		//==============================
+		// Modify Deque
+		//==============================
+		// Returns false if the deque is full
+		bool Push(Job* job)
+		{
+			int64_t bottom{ m_Bottom.load(std::memory_order_relaxed) };
+			int64_t top{ m_Top.load(std::memory_order_acquire) };
+			if (bottom - top >= (int64_t)k_Capacity)
+			{
+				return false;
+			}
+
+			// Publish the job (and its contents) to stealing threads
+			m_Jobs[bottom & (k_Capacity - 1)].store(job, std::memory_order_relaxed);
+			m_Bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		Job* Pop()
+		{
+			int64_t bottom{ m_Bottom.load(std::memory_order_relaxed) - 1 };
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top{ m_Top.load(std::memory_order_relaxed) };
+
+			// Deque is empty
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* job{ m_Jobs[bottom & (k_Capacity - 1)].load(std::memory_order_relaxed) };
+			if (top == bottom)
+			{
+				// Last job, race against the stealing threads
+				if (!m_Top.compare_exchange_strong(top, top + 1,
+					std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					job = nullptr;
+				}
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return job;
+		}
+
+		Job* Steal()
+		{
+			int64_t top{ m_Top.load(std::memory_order_acquire) };
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom{ m_Bottom.load(std::memory_order_acquire) };
+			if (top >= bottom)
+			{
+				return nullptr;
+			}
+
+			Job* job{ m_Jobs[top & (k_Capacity - 1)].load(std::memory_order_relaxed) };
+			if (!m_Top.compare_exchange_strong(top, top + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				// Another thread took this job
+				return nullptr;
+			}
+			return job;
+		}
+	private:
+		static constexpr size_t k_Capacity{ 4096 };
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		alignas(64) std::atomic<int64_t> m_Top{ 0 };
+		alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+		std::atomic<Job*> m_Jobs[k_Capacity]{};
+	};
+
+	//==============================
+	// Job Context Struct
+	//==============================
+	constexpr size_t k_JobPoolSize{ 4096 };
+
+	// Per-thread scheduler state (the main thread uses index 0)
+	struct JobThreadContext
+	{
+		JobDeque m_Deque{};
+		// Ring of reusable jobs allocated by this thread
+		std::vector<Job> m_JobPool = std::vector<Job>(k_JobPoolSize);
+		size_t m_NextPoolIndex{ 0 };
+		uint32_t m_NextVictim{ 0 };
+	};
+
+	struct JobContext
+	{
+		std::vector<Scope<JobThreadContext>> m_ThreadContexts{};
+		std::vector<std::thread> m_Workers{};
+		std::atomic<bool> m_Running{ false };
+		// Incremented whenever a job becomes available. Idle workers wait on changes.
+		std::atomic<uint32_t> m_JobSignal{ 0 };
+		// Jobs submitted from threads without a deque (network threads, asset loaders, etc...)
+		std::mutex m_ExternalMutex{};
+		std::deque<Job*> m_ExternalJobs{};
+		std::atomic<size_t> m_ExternalJobCount{ 0 };
+		// Jobs the engine waits on before the end of the frame
+		JobCounter m_FrameCounter{};
+	};
+
+	static Scope<JobContext> s_JobContext{ nullptr };
+	// Index into the thread contexts for the current thread (-1 if the thread has no deque)
+	static thread_local int32_t t_JobThreadIndex{ -1 };
+
+	//==============================
+	// Internal Functions
+	//==============================
+	static Job* AllocateJob()
+	{
+		if (t_JobThreadIndex >= 0)
+		{
+			// Find an unused job in this thread's pool
+			JobThreadContext& threadContext{ *s_JobContext->m_ThreadContexts[t_JobThreadIndex] };
+			for (size_t attempt{ 0 }; attempt < k_JobPoolSize; attempt++)
+			{
+				Job& job{ threadContext.m_JobPool[threadContext.m_NextPoolIndex] };
+				threadContext.m_NextPoolIndex = (threadContext.m_NextPoolIndex + 1) % k_JobPoolSize;
+				if (!job.m_InUse.load(std::memory_order_acquire))
+				{
+					job.m_InUse.store(true, std::memory_order_relaxed);
+					return &job;
+				}
+			}
+		}
+
+		// Pool is exhausted (or the thread has no pool)
+		Job* job{ new Job() };
+		job->m_InUse.store(true, std::memory_order_relaxed);
+		job->m_HeapAllocated = true;
+		return job;
+	}
+
+	static void FreeJob(Job* job)
+	{
+		job->m_Function.Reset();
+		job->m_Counter = nullptr;
+		if (job->m_HeapAllocated)
+		{
+			delete job;
+			return;
+		}
+		job->m_InUse.store(false, std::memory_order_release);
+	}
+
+	static void SignalJobAvailable()
+	{
+		s_JobContext->m_JobSignal.fetch_add(1, std::memory_order_release);
+		s_JobContext->m_JobSignal.notify_one();
+	}
+
+	static void QueueJob(Job* job)
+	{
+		// Prefer the current thread's deque
+		if (t_JobThreadIndex >= 0)
+		{
+			if (s_JobContext->m_ThreadContexts[t_JobThreadIndex]->m_Deque.Push(job))
+			{
+				SignalJobAvailable();
+				return;
+			}
+		}
+
+		// Fall back to the shared queue
+		{
+			std::scoped_lock<std::mutex> lock(s_JobContext->m_ExternalMutex);
+			s_JobContext->m_ExternalJobs.push_back(job);
+			s_JobContext->m_ExternalJobCount.fetch_add(1, std::memory_order_release);
+		}
+		SignalJobAvailable();
+	}
+
+	static Job* FindJob()
+	{
+		std::vector<Scope<JobThreadContext>>& threadContexts{ s_JobContext->m_ThreadContexts };
+
+		// Check this thread's own deque first (most recently pushed jobs are the most cache-friendly)
+		if (t_JobThreadIndex >= 0)
+		{
+			if (Job* job = threadContexts[t_JobThreadIndex]->m_Deque.Pop())
+			{
+				return job;
+			}
+		}
+
+		// Attempt to steal from the other threads
+		uint32_t startIndex{ t_JobThreadIndex >= 0 ? threadContexts[t_JobThreadIndex]->m_NextVictim++ : 0 };
+		for (size_t offset{ 0 }; offset < threadContexts.size(); offset++)
+		{
+			size_t victim{ (startIndex + offset) % threadContexts.size() };
+			if ((int32_t)victim == t_JobThreadIndex)
+			{
+				continue;
+			}
+
+			if (Job* job = threadContexts[victim]->m_Deque.Steal())
+			{
+				return job;
+			}
+		}
+
+		// Check jobs submitted from outside of the scheduler
+		if (s_JobContext->m_ExternalJobCount.load(std::memory_order_acquire) > 0)
+		{
+			std::scoped_lock<std::mutex> lock(s_JobContext->m_ExternalMutex);
+			if (!s_JobContext->m_ExternalJobs.empty())
+			{
+				Job* job{ s_JobContext->m_ExternalJobs.front() };
+				s_JobContext->m_ExternalJobs.pop_front();
+				s_JobContext->m_ExternalJobCount.fetch_sub(1, std::memory_order_relaxed);
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void FinishJobCounter(JobCounter& counter)
+	{
+		// Keep waiting threads from considering the counter done until dependents are queued
+		counter.m_ReleaseGuard.fetch_add(1);
+		if (counter.m_Count.fetch_sub(1) == 1)
+		{
+			std::vector<Job*> dependentJobs;
+			{
+				std::scoped_lock<std::mutex> lock(counter.m_DependentMutex);
+				dependentJobs.swap(counter.m_DependentJobs);
+			}
+
+			for (Job* job : dependentJobs)
+			{
+				QueueJob(job);
+			}
+		}
+		counter.m_ReleaseGuard.fetch_sub(1);
+	}
+
+	static void ExecuteJob(Job* job)
+	{
+		job->m_Function();
+
+		JobCounter* counter{ job->m_Counter };
+		FreeJob(job);
+
+		if (counter)
+		{
+			FinishJobCounter(*counter);
+		}
+	}
+
+	static void RunWorker(int32_t threadIndex)
+	{
+		KG_PROFILE_THREAD_DESC("Job Worker");
+		t_JobThreadIndex = threadIndex;
+
+		while (s_JobContext->m_Running.load(std::memory_order_acquire))
+		{
+			// Read the signal before searching, so jobs submitted during the search wake this thread
+			uint32_t signal{ s_JobContext->m_JobSignal.load(std::memory_order_acquire) };
+			if (Job* job = FindJob())
+			{
+				ExecuteJob(job);
+				continue;
+			}
+
+			// Sleep until more jobs are submitted
+			s_JobContext->m_JobSignal.wait(signal, std::memory_order_acquire);
+		}
+
+		t_JobThreadIndex = -1;
+	}
+
+	//==============================
+	// Job Service Functions
+	//==============================
+	void JobService::Init(size_t workerCount)
+	{
+		KG_ASSERT(!s_JobContext);
+
+		// Leave one hardware thread for the main thread
+		if (workerCount == 0)
+		{
+			size_t hardwareThreads{ (size_t)std::thread::hardware_concurrency() };
+			workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		s_JobContext = CreateScope<JobContext>();
+		s_JobContext->m_Running = true;
+
+		// Create a context for the main thread and each worker
+		for (size_t index{ 0 }; index < workerCount + 1; index++)
+		{
+			s_JobContext->m_ThreadContexts.push_back(CreateScope<JobThreadContext>());
+			s_JobContext->m_ThreadContexts.back()->m_NextVictim = (uint32_t)index + 1;
+		}
+		t_JobThreadIndex = 0;
+
+		// Start the workers
+		for (size_t index{ 1 }; index < workerCount + 1; index++)
+		{
+			s_JobContext->m_Workers.emplace_back(RunWorker, (int32_t)index);
+		}
+
+		KG_VERIFY(s_JobContext, "Job Service Init");
+	}
+
+	void JobService::Terminate()
+	{
+		KG_ASSERT(s_JobContext);
+
+		// Finish all outstanding frame work before stopping the workers
+		WaitForFrameJobs();
+
+		// Wake and join all workers
+		s_JobContext->m_Running.store(false, std::memory_order_release);
+		s_JobContext->m_JobSignal.fetch_add(1, std::memory_order_release);
+		s_JobContext->m_JobSignal.notify_all();
+		for (std::thread& worker : s_JobContext->m_Workers)
+		{
+			worker.join();
+		}
+
+		// Run any jobs that are still queued, so their counters are released
+		while (Job* job = FindJob())
+		{
+			ExecuteJob(job);
+		}
+
+		t_JobThreadIndex = -1;
+		s_JobContext.reset();
+
+		KG_VERIFY(!s_JobContext, "Job Service Terminate");
+	}
+
+	void JobService::SubmitJob(JobFunction function, JobCounter* signalCounter, JobCounter* dependency)
+	{
+		// Run jobs inline if the scheduler is not running
+		if (!s_JobContext)
+		{
+			function();
+			return;
+		}
+
+		Job* job{ AllocateJob() };
+		job->m_Function = std::move(function);
+		job->m_Counter = signalCounter;
+		if (signalCounter)
+		{
+			signalCounter->m_Count.fetch_add(1);
+		}
+
+		// Hold the job until its dependency is done
+		if (dependency)
+		{
+			std::scoped_lock<std::mutex> lock(dependency->m_DependentMutex);
+			if (dependency->m_Count.load() > 0)
+			{
+				dependency->m_DependentJobs.push_back(job);
+				return;
+			}
+		}
+
+		QueueJob(job);
+	}
+
+	void JobService::WaitForCounter(JobCounter& counter)
+	{
+		// Help process jobs instead of blocking the thread
+		while (!counter.IsDone())
+		{
+			if (!s_JobContext)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			if (Job* job = FindJob())
+			{
+				ExecuteJob(job);
+				continue;
+			}
+			std::this_thread::yield();
+		}
+	}
+
+	void JobService::SubmitFrameJob(JobFunction function)
+	{
+		KG_ASSERT(s_JobContext);
+		SubmitJob(std::move(function), &s_JobContext->m_FrameCounter);
+	}
+
+	void JobService::WaitForFrameJobs()
+	{
+		KG_ASSERT(s_JobContext);
+		WaitForCounter(s_JobContext->m_FrameCounter);
+	}
+
+	bool JobService::IsActive()
+	{
+		return s_JobContext != nullptr;
+	}
+
+	size_t JobService::GetWorkerCount()
+	{
+		return s_JobContext ? s_JobContext->m_Workers.size() : 0;
+	}
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Kargono/Core/Base.h"
+#include "Kargono/Core/InplaceFunction.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+namespace Kargono
+{
+	struct Job;
+	class JobCounter;
+
+	void FinishJobCounter(JobCounter& counter);
+
+	// Jobs are stored inside the scheduler's job pools, so keep captures small
+	using JobFunction = InplaceFunction<void(), 48>;
+
+	//==============================
+	// Job Counter Class
+	//==============================
+	// Tracks a group of in-flight jobs. Each job submitted with a counter increments it, and
+	//		decrements it when finished. Jobs may also depend on a counter, in which case they are
+	//		only queued once the counter reaches zero.
+	class JobCounter
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		JobCounter() = default;
+		~JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+	public:
+		//==============================
+		// Query Counter
+		//==============================
+		bool IsDone() const
+		{
+			// The release guard keeps the counter alive until dependent jobs are handed off
+			return m_Count.load() == 0 && m_ReleaseGuard.load() == 0;
+		}
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		std::atomic<uint32_t> m_Count{ 0 };
+		std::atomic<uint32_t> m_ReleaseGuard{ 0 };
+		// Jobs waiting on this counter
+		std::mutex m_DependentMutex{};
+		std::vector<Job*> m_DependentJobs{};
+	private:
+		friend class JobService;
+		// Decrements the counter and queues its dependent jobs once it reaches zero
+		friend void FinishJobCounter(JobCounter& counter);
+	};
+
+	//==============================
+	// Job Service Class
+	//==============================
+	// Work-stealing job scheduler. Every worker thread (and the main thread) owns a lock-free
+	//		deque. Owners push/pop jobs from the bottom of their deque while idle threads steal from
+	//		the top of the others. Threads without a deque submit through a shared locked queue.
+	class JobService
+	{
+	public:
+		//==============================
+		// Lifecycle Functions
+		//==============================
+		// Must be called from the main thread. A worker count of 0 uses one worker per
+		//		remaining hardware thread.
+		static void Init(size_t workerCount = 0);
+		static void Terminate();
+
+		//==============================
+		// Submit Jobs
+		//==============================
+		// Queue a job. The signal counter (optional) is incremented now and decremented once the job
+		//		finishes. If a dependency is provided, the job is held until the dependency is done.
+		static void SubmitJob(JobFunction function, JobCounter* signalCounter = nullptr,
+			JobCounter* dependency = nullptr);
+		// Run queued jobs on the calling thread until the counter is done
+		static void WaitForCounter(JobCounter& counter);
+
+		// Split [0, count) into batches and process them across the workers. The calling thread
+		//		processes batches as well and returns once all batches are finished.
+		template<typename Func>
+		static void ParallelFor(size_t count, size_t batchSize, Func&& func)
+		{
+			if (count == 0)
+			{
+				return;
+			}
+			batchSize = batchSize > 0 ? batchSize : 1;
+
+			// Run small ranges (or everything if the scheduler is not running) inline
+			if (!IsActive() || count <= batchSize)
+			{
+				func((size_t)0, count);
+				return;
+			}
+
+			// Submit all batches except the first one, which runs on this thread
+			JobCounter counter;
+			for (size_t begin{ batchSize }; begin < count; begin += batchSize)
+			{
+				size_t end{ begin + batchSize < count ? begin + batchSize : count };
+				SubmitJob([&func, begin, end]()
+				{
+					func(begin, end);
+				}, &counter);
+			}
+			func((size_t)0, batchSize);
+
+			WaitForCounter(counter);
+		}
+
+		//==============================
+		// Frame Jobs
+		//==============================
+		// Frame jobs are guaranteed to finish before the engine processes its event queue
+		static void SubmitFrameJob(JobFunction function);
+		static void WaitForFrameJobs();
+
+		//==============================
+		// Getters/Setters
+		//==============================
+		static bool IsActive();
+		static size_t GetWorkerCount();
+	};
+}
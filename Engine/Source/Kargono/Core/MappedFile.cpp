@@ -0,0 +1,105 @@
+#include "kgpch.h"
+
+#include "Kargono/Core/MappedFile.h"
+
+#if defined(KG_PLATFORM_WINDOWS)
+#include "API/Platform/WindowsBackendAPI.h"
+#elif defined(KG_PLATFORM_LINUX)
+#include "API/Platform/LinuxBackendAPI.h"
+#endif
+
+namespace Kargono
+{
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	bool MappedFile::Open(const std::filesystem::path& filepath)
+	{
+		Close();
+
+#if defined(KG_PLATFORM_WINDOWS)
+		// Open the file and create a read-only view of its contents
+		HANDLE fileHandle = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER fileSize{};
+		if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+		{
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mappingHandle)
+		{
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if (!view)
+		{
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		m_FileHandle = fileHandle;
+		m_MappingHandle = mappingHandle;
+		m_Data = (const uint8_t*)view;
+		m_Size = (uint64_t)fileSize.QuadPart;
+		return true;
+#elif defined(KG_PLATFORM_LINUX)
+		// Open the file and map its contents. The descriptor is not needed once the mapping exists.
+		int fileDescriptor = open(filepath.c_str(), O_RDONLY);
+		if (fileDescriptor < 0)
+		{
+			return false;
+		}
+
+		struct stat fileStatus{};
+		if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0)
+		{
+			close(fileDescriptor);
+			return false;
+		}
+
+		void* view = mmap(nullptr, (size_t)fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		close(fileDescriptor);
+		if (view == MAP_FAILED)
+		{
+			return false;
+		}
+
+		m_Data = (const uint8_t*)view;
+		m_Size = (uint64_t)fileStatus.st_size;
+		return true;
+#endif
+	}
+
+	void MappedFile::Close()
+	{
+		if (!m_Data)
+		{
+			return;
+		}
+
+#if defined(KG_PLATFORM_WINDOWS)
+		UnmapViewOfFile(m_Data);
+		CloseHandle((HANDLE)m_MappingHandle);
+		CloseHandle((HANDLE)m_FileHandle);
+		m_MappingHandle = nullptr;
+		m_FileHandle = nullptr;
+#elif defined(KG_PLATFORM_LINUX)
+		munmap((void*)m_Data, (size_t)m_Size);
+#endif
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <filesystem>
+#include <cstdint>
+
+namespace Kargono
+{
+	//==============================
+	// Mapped File Class
+	//==============================
+	// Read-only memory mapping of a file on disk. The mapping is released when the object is
+	//		destroyed or closed.
+	class MappedFile
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		MappedFile() = default;
+		~MappedFile();
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+	public:
+		//==============================
+		// Manage Mapping
+		//==============================
+		bool Open(const std::filesystem::path& filepath);
+		void Close();
+
+		//==============================
+		// Getters/Setters
+		//==============================
+		const uint8_t* GetData() const { return m_Data; }
+		uint64_t GetSize() const { return m_Size; }
+		bool IsOpen() const { return m_Data != nullptr; }
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		const uint8_t* m_Data{ nullptr };
+		uint64_t m_Size{ 0 };
+#if defined(KG_PLATFORM_WINDOWS)
+		void* m_FileHandle{ nullptr };
+		void* m_MappingHandle{ nullptr };
+#endif
+	};
+}
@@ -363,156 +363,42 @@ namespace Kargono
 	typedef bool (*bool_uint64uint64)(uint64_t, uint64_t);
 	typedef bool (*bool_uint64uint16uint64)(uint64_t, uint16_t, uint64_t);
 
+	// Script functions are called every frame for every entity, so the function type is stored as plain
+	//		data rather than queried through a virtual call. Call sites cast to the typed wrapper below
+	//		and call the raw function pointer directly.
 	class WrappedFunction
 	{
 	public:
-		virtual ~WrappedFunction() = default;
+		WrappedFunction(WrappedFuncType type) : m_Type{ type } {}
 	public:
-		virtual WrappedFuncType Type() = 0;
+		WrappedFuncType Type() const { return m_Type; }
+	private:
+		WrappedFuncType m_Type{ WrappedFuncType::None };
 	};
 
-	class WrappedVoidNone : public WrappedFunction
+	template<WrappedFuncType k_Type, typename FunctionPointer>
+	class WrappedFunctionPointer : public WrappedFunction
 	{
 	public:
-		WrappedVoidNone() = default;
-		WrappedVoidNone(void_none value) : m_Value {value} {}
+		WrappedFunctionPointer() : WrappedFunction(k_Type) {}
+		WrappedFunctionPointer(FunctionPointer value) : WrappedFunction(k_Type), m_Value{ value } {}
 	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_None; }
-	public:
-		void_none m_Value{};
-	};
-
-	class WrappedVoidString : public WrappedFunction
-	{
-	public:
-		WrappedVoidString() = default;
-		WrappedVoidString(void_string value) : m_Value{ value } {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_String; }
-	public:
-		void_string m_Value{};
-	};
-
-	class WrappedVoidFloat : public WrappedFunction
-	{
-	public:
-		WrappedVoidFloat() = default;
-		WrappedVoidFloat(void_float value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_Float; }
-	public:
-		void_float m_Value{};
-	};
-
-	class WrappedVoidUInt16 : public WrappedFunction
-	{
-	public:
-		WrappedVoidUInt16() = default;
-		WrappedVoidUInt16(void_uint16 value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_UInt16; }
-	public:
-		void_uint16 m_Value{};
-	};
-
-	class WrappedVoidUInt32 : public WrappedFunction
-	{
-	public:
-		WrappedVoidUInt32() = default;
-		WrappedVoidUInt32(void_uint32 value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_UInt32; }
-	public:
-		void_uint32 m_Value{};
-	};
-
-	class WrappedVoidUInt32UInt32 : public WrappedFunction
-	{
-	public:
-		WrappedVoidUInt32UInt32() = default;
-		WrappedVoidUInt32UInt32(void_uint32uint32 value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_UInt32UInt32; }
-	public:
-		void_uint32uint32 m_Value{};
-	};
-
-	class WrappedVoidEntity : public WrappedFunction
-	{
-	public:
-		WrappedVoidEntity() = default;
-		WrappedVoidEntity(void_uint64 value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_Entity; }
-	public:
-		void_uint64 m_Value{};
-	};
-
-	class WrappedVoidEntityFloat : public WrappedFunction
-	{
-	public:
-		WrappedVoidEntityFloat() = default;
-		WrappedVoidEntityFloat(void_uint64float value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_EntityFloat; }
-	public:
-		void_uint64float m_Value{};
-	};
-
-	class WrappedVoidUInt32EntityEntityFloat : public WrappedFunction
-	{
-	public:
-		WrappedVoidUInt32EntityEntityFloat() = default;
-		WrappedVoidUInt32EntityEntityFloat(void_uint32uint64uint64float value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_UInt32EntityEntityFloat; }
-	public:
-		void_uint32uint64uint64float m_Value{};
-	};
-
-	class WrappedVoidBool : public WrappedFunction
-	{
-	public:
-		WrappedVoidBool() = default;
-		WrappedVoidBool(void_bool value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Void_Bool; }
-	public:
-		void_bool m_Value{};
-	};
-
-	class WrappedBoolNone : public WrappedFunction
-	{
-	public:
-		WrappedBoolNone() = default;
-		WrappedBoolNone(bool_none value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Bool_None; }
-	public:
-		bool_none m_Value{};
-	};
-
-	class WrappedBoolEntity : public WrappedFunction
-	{
-	public:
-		WrappedBoolEntity() = default;
-		WrappedBoolEntity(bool_uint64 value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Bool_Entity; }
-	public:
-		bool_uint64 m_Value{};
+		FunctionPointer m_Value{};
 	};
 
-	class WrappedBoolEntityEntity : public WrappedFunction
-	{
-	public:
-		WrappedBoolEntityEntity() = default;
-		WrappedBoolEntityEntity(bool_uint64uint64 value) : m_Value(value) {}
-	public:
-		virtual WrappedFuncType Type() override { return WrappedFuncType::Bool_EntityEntity; }
-	public:
-		bool_uint64uint64 m_Value{};
-	};
+	using WrappedVoidNone = WrappedFunctionPointer<WrappedFuncType::Void_None, void_none>;
+	using WrappedVoidString = WrappedFunctionPointer<WrappedFuncType::Void_String, void_string>;
+	using WrappedVoidFloat = WrappedFunctionPointer<WrappedFuncType::Void_Float, void_float>;
+	using WrappedVoidUInt16 = WrappedFunctionPointer<WrappedFuncType::Void_UInt16, void_uint16>;
+	using WrappedVoidUInt32 = WrappedFunctionPointer<WrappedFuncType::Void_UInt32, void_uint32>;
+	using WrappedVoidUInt32UInt32 = WrappedFunctionPointer<WrappedFuncType::Void_UInt32UInt32, void_uint32uint32>;
+	using WrappedVoidEntity = WrappedFunctionPointer<WrappedFuncType::Void_Entity, void_uint64>;
+	using WrappedVoidEntityFloat = WrappedFunctionPointer<WrappedFuncType::Void_EntityFloat, void_uint64float>;
+	using WrappedVoidUInt32EntityEntityFloat = WrappedFunctionPointer<WrappedFuncType::Void_UInt32EntityEntityFloat, void_uint32uint64uint64float>;
+	using WrappedVoidBool = WrappedFunctionPointer<WrappedFuncType::Void_Bool, void_bool>;
+	using WrappedBoolNone = WrappedFunctionPointer<WrappedFuncType::Bool_None, bool_none>;
+	using WrappedBoolEntity = WrappedFunctionPointer<WrappedFuncType::Bool_Entity, bool_uint64>;
+	using WrappedBoolEntityEntity = WrappedFunctionPointer<WrappedFuncType::Bool_EntityEntity, bool_uint64uint64>;
 
 	namespace Utility
 	{
@@ -932,81 +818,81 @@ namespace Kargono
 			return WrappedFuncType::None;
 		}
 
-		inline void CallWrappedVoidNone(Ref<WrappedFunction> wrappedFunction)
+		inline void CallWrappedVoidNone(const Ref<WrappedFunction>& wrappedFunction)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_None, "Invalid wrapped function type provided");
-			((WrappedVoidNone*)wrappedFunction.get())->m_Value();
+			static_cast<WrappedVoidNone*>(wrappedFunction.get())->m_Value();
 		}
 
-		inline void CallWrappedVoidString(Ref<WrappedFunction> wrappedFunction, const std::string& argumentOne)
+		inline void CallWrappedVoidString(const Ref<WrappedFunction>& wrappedFunction, const std::string& argumentOne)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_String, "Invalid wrapped function type provided");
-			((WrappedVoidString*)wrappedFunction.get())->m_Value(argumentOne);
+			static_cast<WrappedVoidString*>(wrappedFunction.get())->m_Value(argumentOne);
 		}
 
-		inline void CallWrappedVoidFloat(Ref<WrappedFunction> wrappedFunction, float argumentOne)
+		inline void CallWrappedVoidFloat(const Ref<WrappedFunction>& wrappedFunction, float argumentOne)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_Float, "Invalid wrapped function type provided");
-			((WrappedVoidFloat*)wrappedFunction.get())->m_Value(argumentOne);
+			static_cast<WrappedVoidFloat*>(wrappedFunction.get())->m_Value(argumentOne);
 		}
 
-		inline void CallWrappedVoidUInt16(Ref<WrappedFunction> wrappedFunction, uint16_t argumentOne)
+		inline void CallWrappedVoidUInt16(const Ref<WrappedFunction>& wrappedFunction, uint16_t argumentOne)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_UInt16, "Invalid wrapped function type provided");
-			((WrappedVoidUInt16*)wrappedFunction.get())->m_Value(argumentOne);
+			static_cast<WrappedVoidUInt16*>(wrappedFunction.get())->m_Value(argumentOne);
 		}
 
-		inline void CallWrappedVoidUInt32(Ref<WrappedFunction> wrappedFunction, uint32_t argumentOne)
+		inline void CallWrappedVoidUInt32(const Ref<WrappedFunction>& wrappedFunction, uint32_t argumentOne)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_UInt32, "Invalid wrapped function type provided");
-			((WrappedVoidUInt32*)wrappedFunction.get())->m_Value(argumentOne);
+			static_cast<WrappedVoidUInt32*>(wrappedFunction.get())->m_Value(argumentOne);
 		}
-		inline void CallWrappedVoidUInt32UInt32(Ref<WrappedFunction> wrappedFunction, uint32_t argumentOne, uint32_t argumentTwo)
+		inline void CallWrappedVoidUInt32UInt32(const Ref<WrappedFunction>& wrappedFunction, uint32_t argumentOne, uint32_t argumentTwo)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_UInt32UInt32, "Invalid wrapped function type provided");
-			((WrappedVoidUInt32UInt32*)wrappedFunction.get())->m_Value(argumentOne, argumentTwo);
+			static_cast<WrappedVoidUInt32UInt32*>(wrappedFunction.get())->m_Value(argumentOne, argumentTwo);
 		}
 
-		inline void CallWrappedVoidEntity(Ref<WrappedFunction> wrappedFunction, uint64_t argumentOne)
+		inline void CallWrappedVoidEntity(const Ref<WrappedFunction>& wrappedFunction, uint64_t argumentOne)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_Entity, "Invalid wrapped function type provided");
-			((WrappedVoidEntity*)wrappedFunction.get())->m_Value(argumentOne);
+			static_cast<WrappedVoidEntity*>(wrappedFunction.get())->m_Value(argumentOne);
 		}
 
-		inline void CallWrappedVoidBool(Ref<WrappedFunction> wrappedFunction, bool argumentOne)
+		inline void CallWrappedVoidBool(const Ref<WrappedFunction>& wrappedFunction, bool argumentOne)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_Bool, "Invalid wrapped function type provided");
-			((WrappedVoidBool*)wrappedFunction.get())->m_Value(argumentOne);
+			static_cast<WrappedVoidBool*>(wrappedFunction.get())->m_Value(argumentOne);
 		}
 
-		inline void CallWrappedVoidEntityFloat(Ref<WrappedFunction> wrappedFunction, uint64_t argumentOne, float argumentTwo)
+		inline void CallWrappedVoidEntityFloat(const Ref<WrappedFunction>& wrappedFunction, uint64_t argumentOne, float argumentTwo)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_EntityFloat, "Invalid wrapped function type provided");
-			((WrappedVoidEntityFloat*)wrappedFunction.get())->m_Value(argumentOne, argumentTwo);
+			static_cast<WrappedVoidEntityFloat*>(wrappedFunction.get())->m_Value(argumentOne, argumentTwo);
 		}
 
-		inline void CallWrappedVoidUInt32EntityEntityFloat(Ref<WrappedFunction> wrappedFunction, uint32_t argumentOne, uint64_t argumentTwo, uint64_t argumentThree, float argumentFour)
+		inline void CallWrappedVoidUInt32EntityEntityFloat(const Ref<WrappedFunction>& wrappedFunction, uint32_t argumentOne, uint64_t argumentTwo, uint64_t argumentThree, float argumentFour)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Void_UInt32EntityEntityFloat, "Invalid wrapped function type provided");
-			((WrappedVoidUInt32EntityEntityFloat*)wrappedFunction.get())->m_Value(argumentOne, argumentTwo, argumentThree, argumentFour);
+			static_cast<WrappedVoidUInt32EntityEntityFloat*>(wrappedFunction.get())->m_Value(argumentOne, argumentTwo, argumentThree, argumentFour);
 		}
 
-		inline bool CallWrappedBoolNone(Ref<WrappedFunction> wrappedFunction)
+		inline bool CallWrappedBoolNone(const Ref<WrappedFunction>& wrappedFunction)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Bool_None, "Invalid wrapped function type provided");
-			return ((WrappedBoolNone*)wrappedFunction.get())->m_Value();
+			return static_cast<WrappedBoolNone*>(wrappedFunction.get())->m_Value();
 		}
 
-		inline bool CallWrappedBoolEntity(Ref<WrappedFunction> wrappedFunction, uint64_t argumentOne)
+		inline bool CallWrappedBoolEntity(const Ref<WrappedFunction>& wrappedFunction, uint64_t argumentOne)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Bool_Entity, "Invalid wrapped function type provided");
-			return ((WrappedBoolEntity*)wrappedFunction.get())->m_Value(argumentOne);
+			return static_cast<WrappedBoolEntity*>(wrappedFunction.get())->m_Value(argumentOne);
 		}
 
-		inline bool CallWrappedBoolEntityEntity(Ref<WrappedFunction> wrappedFunction, uint64_t argumentOne, uint64_t argumentTwo)
+		inline bool CallWrappedBoolEntityEntity(const Ref<WrappedFunction>& wrappedFunction, uint64_t argumentOne, uint64_t argumentTwo)
 		{
 			KG_ASSERT(wrappedFunction->Type() == WrappedFuncType::Bool_EntityEntity, "Invalid wrapped function type provided");
-			return ((WrappedBoolEntityEntity*)wrappedFunction.get())->m_Value(argumentOne, argumentTwo);
+			return static_cast<WrappedBoolEntityEntity*>(wrappedFunction.get())->m_Value(argumentOne, argumentTwo);
 		}
 
 		inline WrappedVarType WrappedFuncTypeToReturnType(WrappedFuncType type)
@@ -15,42 +15,24 @@ namespace Kargono::Events
 
 	void EventQueue::SubmitEvent(Ref<Event> event)
 	{
-		// Obtain the event queue lock
-		std::scoped_lock<std::mutex> lock(m_EventQueueMutex);
-
-		// Add the event
-		m_EventQueue.emplace_back(event);
+		// Add the event (lock-free unless the queue overflows)
+		m_EventQueue.Push(std::move(event));
 	}
 
 	void EventQueue::ClearQueue()
 	{
-		// Obtain the event queue lock
-		std::scoped_lock<std::mutex> lock(m_EventQueueMutex);
-
 		// Clear the queue
-		m_EventQueue.clear();
+		m_EventQueue.Clear();
 	}
 
 	void EventQueue::ProcessQueue()
 	{
 		KG_ASSERT(m_ProcessQueueFunc);
 
-		std::vector<Ref<Event>> cachedEvents;
-
-		// Cache a copy of the event queue to prevent loop invalidation
-		{
-			// Obtain the event queue lock
-			std::scoped_lock<std::mutex> lock(m_EventQueueMutex);
-
-			// Store the events in the cache
-			cachedEvents = std::move(m_EventQueue);
-			m_EventQueue.clear();
-		}
-
-		// Handle the event queue
-		for (Ref<Event> event : cachedEvents)
+		// Swap out the queued events before handling them to prevent loop invalidation
+		m_EventQueue.Drain([&](Ref<Event>& event)
 		{
 			m_ProcessQueueFunc(event.get());
-		}
+		});
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Kargono/Core/Base.h"
+#include "Kargono/Core/DataStructures.h"
 #include "Kargono/Events/Event.h"
 
 #include <vector>
@@ -28,7 +29,9 @@ namespace Kargono::Events
 		//=========================
 		// Modify Queue
 		//=========================
+		// Safe to call from any thread
 		void SubmitEvent(Ref<Event> event);
+		// Only call from the thread processing the queue
 		void ClearQueue();
 
 		//=========================
@@ -39,8 +42,7 @@ namespace Kargono::Events
 		//=========================
 		// Internal Fields
 		//=========================
-		std::vector<Ref<Event>> m_EventQueue{};
-		std::mutex m_EventQueueMutex{};
+		MPSCWorkQueue<Ref<Event>> m_EventQueue{ 1024 };
 		EventCallbackFn m_ProcessQueueFunc{ nullptr };
 	};
 }
@@ -70,4 +70,42 @@ namespace Kargono::Math
 		return true;
 	}
 
+	Frustum ExtractFrustum(const glm::mat4& viewProjection)
+	{
+		// Rows of the column major matrix give the planes of the clip volume (Gribb/Hartmann)
+		glm::vec4 rows[4];
+		for (int row{ 0 }; row < 4; row++)
+		{
+			rows[row] = { viewProjection[0][row], viewProjection[1][row], viewProjection[2][row], viewProjection[3][row] };
+		}
+
+		Frustum frustum;
+		frustum.m_Planes[0] = rows[3] + rows[0];
+		frustum.m_Planes[1] = rows[3] - rows[0];
+		frustum.m_Planes[2] = rows[3] + rows[1];
+		frustum.m_Planes[3] = rows[3] - rows[1];
+		frustum.m_Planes[4] = rows[3] + rows[2];
+		frustum.m_Planes[5] = rows[3] - rows[2];
+		return frustum;
+	}
+
+	FrustumIntersection TestFrustumBox(const Frustum& frustum, const glm::vec3& center, const glm::vec3& extents)
+	{
+		FrustumIntersection result{ FrustumIntersection::Inside };
+		for (const glm::vec4& plane : frustum.m_Planes)
+		{
+			glm::vec3 normal{ plane };
+			float distance = glm::dot(normal, center) + plane.w;
+			float radius = glm::dot(glm::abs(normal), extents);
+			if (distance + radius < 0.0f)
+			{
+				return FrustumIntersection::Outside;
+			}
+			if (distance - radius < 0.0f)
+			{
+				result = FrustumIntersection::Intersecting;
+			}
+		}
+		return result;
+	}
 }
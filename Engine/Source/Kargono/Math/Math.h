@@ -19,5 +19,29 @@ namespace Kargono::Math
 	//		successful.
 	bool DecomposeTransform(const glm::mat4& transform, glm::vec3& translation,
 			glm::vec3& rotation, glm::vec3& scale);
+
+	//==============================
+	// Frustum Culling
+	//==============================
+
+	// The six planes bounding the volume visible through a view projection matrix. Each plane
+	//		is stored as (normal, distance) with the normal facing into the volume.
+	struct Frustum
+	{
+		glm::vec4 m_Planes[6];
+	};
+
+	enum class FrustumIntersection
+	{
+		Outside = 0,
+		Intersecting,
+		Inside
+	};
+
+	// This function extracts the clip planes of the provided view projection matrix
+	Frustum ExtractFrustum(const glm::mat4& viewProjection);
+	// This function classifies an axis aligned box, described by its center and half extents,
+	//		against the frustum. Boxes close to a frustum corner may be reported as intersecting.
+	FrustumIntersection TestFrustumBox(const Frustum& frustum, const glm::vec3& center, const glm::vec3& extents);
 	
 }
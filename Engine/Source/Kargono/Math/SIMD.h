@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+
+// SSE2 is part of the x86-64 baseline, so it is available on all supported desktop targets.
+//		Other architectures fall back to plain scalar loops.
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+	#define KG_SIMD_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace Kargono::Math::SIMD
+{
+	// Number of floats processed per SIMD operation
+	constexpr size_t k_FloatWidth{ 4 };
+
+#if defined(KG_SIMD_SSE2)
+	//==============================
+	// SSE2 Float Vector
+	//==============================
+	struct Float4
+	{
+		__m128 m_Value;
+	};
+
+	inline Float4 Load(const float* source) { return { _mm_loadu_ps(source) }; }
+	inline void Store(float* destination, Float4 value) { _mm_storeu_ps(destination, value.m_Value); }
+	inline Float4 Splat(float value) { return { _mm_set1_ps(value) }; }
+
+	inline Float4 operator+(Float4 left, Float4 right) { return { _mm_add_ps(left.m_Value, right.m_Value) }; }
+	inline Float4 operator-(Float4 left, Float4 right) { return { _mm_sub_ps(left.m_Value, right.m_Value) }; }
+	inline Float4 operator*(Float4 left, Float4 right) { return { _mm_mul_ps(left.m_Value, right.m_Value) }; }
+	inline Float4 operator/(Float4 left, Float4 right) { return { _mm_div_ps(left.m_Value, right.m_Value) }; }
+	inline Float4 Min(Float4 left, Float4 right) { return { _mm_min_ps(left.m_Value, right.m_Value) }; }
+	inline Float4 Max(Float4 left, Float4 right) { return { _mm_max_ps(left.m_Value, right.m_Value) }; }
+#else
+	//==============================
+	// Scalar Float Vector
+	//==============================
+	struct Float4
+	{
+		float m_Value[k_FloatWidth];
+	};
+
+	inline Float4 Load(const float* source) { return { source[0], source[1], source[2], source[3] }; }
+	inline void Store(float* destination, Float4 value)
+	{
+		for (size_t index{ 0 }; index < k_FloatWidth; index++) { destination[index] = value.m_Value[index]; }
+	}
+	inline Float4 Splat(float value) { return { value, value, value, value }; }
+
+	#define KG_SIMD_SCALAR_OPERATION(expression) \
+		Float4 result; \
+		for (size_t index{ 0 }; index < k_FloatWidth; index++) { result.m_Value[index] = expression; } \
+		return result;
+
+	inline Float4 operator+(Float4 left, Float4 right) { KG_SIMD_SCALAR_OPERATION(left.m_Value[index] + right.m_Value[index]) }
+	inline Float4 operator-(Float4 left, Float4 right) { KG_SIMD_SCALAR_OPERATION(left.m_Value[index] - right.m_Value[index]) }
+	inline Float4 operator*(Float4 left, Float4 right) { KG_SIMD_SCALAR_OPERATION(left.m_Value[index] * right.m_Value[index]) }
+	inline Float4 operator/(Float4 left, Float4 right) { KG_SIMD_SCALAR_OPERATION(left.m_Value[index] / right.m_Value[index]) }
+	inline Float4 Min(Float4 left, Float4 right)
+	{
+		KG_SIMD_SCALAR_OPERATION(left.m_Value[index] < right.m_Value[index] ? left.m_Value[index] : right.m_Value[index])
+	}
+	inline Float4 Max(Float4 left, Float4 right)
+	{
+		KG_SIMD_SCALAR_OPERATION(left.m_Value[index] > right.m_Value[index] ? left.m_Value[index] : right.m_Value[index])
+	}
+
+	#undef KG_SIMD_SCALAR_OPERATION
+#endif
+}
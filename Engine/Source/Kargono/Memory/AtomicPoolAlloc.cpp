@@ -0,0 +1,114 @@
+#include "kgpch.h"
+#include "Kargono/Memory/AtomicPoolAlloc.h"
+
+#include "Kargono/Memory/MemoryCommon.h"
+
+namespace Kargono::Memory
+{
+	constexpr uint32_t k_EndOfFreeList{ std::numeric_limits<uint32_t>::max() };
+
+	static uint64_t PackHead(uint64_t tag, uint32_t chunkIndex)
+	{
+		return (tag << 32) | (uint64_t)chunkIndex;
+	}
+
+	void AtomicPoolAlloc::Init(uint8_t* backingBuffer, size_t bufferSize, size_t chunkSize, size_t chunkAlignment)
+	{
+		// Align the backing buffer to the chunk's alignment
+		uintptr_t initialStart = (uintptr_t)backingBuffer;
+		uintptr_t alignedStart = Utility::AlignForward(initialStart, (uintptr_t)chunkAlignment);
+		bufferSize -= (size_t)(alignedStart - initialStart);
+
+		// Align the chunk size up to the required chunk alignment
+		chunkSize = Utility::AlignForward(chunkSize, chunkAlignment);
+
+		// Ensure the parameters are valid
+		KG_ASSERT(chunkSize >= sizeof(uint32_t), "Chunk size is too small for pool");
+		KG_ASSERT(bufferSize >= chunkSize, "Buffer size is too small for the chunk size");
+		KG_ASSERT(bufferSize / chunkSize < (size_t)k_EndOfFreeList, "Too many chunks for pool");
+
+		// Store the adjusted parameters
+		m_Buffer = (uint8_t*)alignedStart;
+		m_BufferSize = bufferSize;
+		m_ChunkSize = chunkSize;
+		m_ChunkCount = bufferSize / chunkSize;
+
+		// Set entire buffer to free list nodes
+		Reset();
+	}
+
+	void AtomicPoolAlloc::Terminate()
+	{
+		m_Buffer = nullptr;
+		m_BufferSize = 0;
+		m_ChunkSize = 0;
+		m_ChunkCount = 0;
+		m_Head.store(PackHead(0, k_EndOfFreeList));
+	}
+
+	uint8_t* AtomicPoolAlloc::AllocRaw()
+	{
+		uint64_t currentHead = m_Head.load(std::memory_order_acquire);
+
+		while (true)
+		{
+			uint32_t chunkIndex = (uint32_t)currentHead;
+			if (chunkIndex == k_EndOfFreeList)
+			{
+				return nullptr;
+			}
+
+			// The next index may be stale if another thread popped this chunk first. The tag
+			//		then differs and the compare-exchange fails, so the stale value is never used.
+			uint32_t nextIndex = GetNextIndex(chunkIndex);
+			uint64_t newHead = PackHead((currentHead >> 32) + 1, nextIndex);
+
+			if (m_Head.compare_exchange_weak(currentHead, newHead,
+				std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				return &m_Buffer[chunkIndex * m_ChunkSize];
+			}
+		}
+	}
+
+	void AtomicPoolAlloc::Free(uint8_t* dataPtr)
+	{
+		// Ensure data pointer is valid for this pool
+		if (dataPtr == nullptr)
+		{
+			return;
+		}
+		KG_ASSERT(Contains(dataPtr), "Data pointer is out of bounds for this pool");
+
+		uint32_t chunkIndex = (uint32_t)((size_t)(dataPtr - m_Buffer) / m_ChunkSize);
+		uint64_t currentHead = m_Head.load(std::memory_order_relaxed);
+
+		// Push the chunk onto the free list
+		do
+		{
+			GetNextIndex(chunkIndex) = (uint32_t)currentHead;
+		} while (!m_Head.compare_exchange_weak(currentHead, PackHead((currentHead >> 32) + 1, chunkIndex),
+			std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	void AtomicPoolAlloc::Reset()
+	{
+		// Link every chunk to its neighbor
+		for (size_t i{ 0 }; i < m_ChunkCount; i++)
+		{
+			GetNextIndex((uint32_t)i) = i + 1 < m_ChunkCount ? (uint32_t)(i + 1) : k_EndOfFreeList;
+		}
+
+		m_Head.store(PackHead(0, m_ChunkCount > 0 ? 0 : k_EndOfFreeList), std::memory_order_release);
+	}
+
+	bool AtomicPoolAlloc::Contains(const uint8_t* dataPtr) const
+	{
+		return m_Buffer <= dataPtr && dataPtr < &m_Buffer[m_ChunkCount * m_ChunkSize];
+	}
+
+	uint32_t& AtomicPoolAlloc::GetNextIndex(uint32_t chunkIndex)
+	{
+		return *(uint32_t*)&m_Buffer[chunkIndex * m_ChunkSize];
+	}
+}
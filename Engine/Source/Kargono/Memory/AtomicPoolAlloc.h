@@ -0,0 +1,92 @@
+#pragma once
+
+#include <utility>
+#include <cstdint>
+#include <atomic>
+#include <limits>
+
+namespace Kargono::Memory
+{
+	// Thread-safe variant of PoolAlloc. Free chunks form an index-linked list whose head is
+	//		packed with a modification tag, so concurrent AllocRaw/Free calls are resolved with a
+	//		single compare-and-swap and are immune to the ABA problem.
+	class AtomicPoolAlloc
+	{
+	public:
+		//==============================
+		// Constuctors/Destructors
+		//==============================
+		AtomicPoolAlloc() = default;
+		~AtomicPoolAlloc() = default;
+	public:
+		//==============================
+		// Lifecycle Functions
+		//==============================
+		void Init(uint8_t* backingBuffer, size_t bufferSize, size_t chunkSize, size_t chunkAlignment);
+
+		template<typename Type>
+		void Init(uint8_t* backingBuffer, size_t bufferSize)
+		{
+			Init(backingBuffer, bufferSize, sizeof(Type), alignof(Type));
+		}
+		void Terminate();
+
+		//==============================
+		// Allocate Memory
+		//==============================
+		// Allocate uninitialized bytes (returns nullptr if the pool is exhausted)
+		uint8_t* AllocRaw();
+
+		// Allocate memory for specified type
+		template<typename Type>
+		Type* Alloc(auto&&... args)
+		{
+			KG_ASSERT(sizeof(Type) <= m_ChunkSize);
+
+			uint8_t* rawPtr = AllocRaw();
+			if (!rawPtr)
+			{
+				return nullptr;
+			}
+
+			// Construct the object inside the chunk
+			return new (rawPtr) Type(std::forward<decltype(args)>(args)...);
+		}
+
+		//==============================
+		// De-Allocate Memory
+		//==============================
+		void Free(uint8_t* dataPtr);
+	public:
+		//==============================
+		// Manage Allocator
+		//==============================
+		// Not thread-safe. Ensure no other thread is using the pool.
+		void Reset();
+
+		//==============================
+		// Query Allocator
+		//==============================
+		bool Contains(const uint8_t* dataPtr) const;
+		size_t GetChunkSize() const
+		{
+			return m_ChunkSize;
+		}
+	private:
+		//==============================
+		// Internal Functions
+		//==============================
+		uint32_t& GetNextIndex(uint32_t chunkIndex);
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		uint8_t* m_Buffer{ nullptr };
+		size_t m_BufferSize{ 0 };
+		size_t m_ChunkSize{ 0 };
+		size_t m_ChunkCount{ 0 };
+
+		// Upper 32 bits are the modification tag, lower 32 bits are the head chunk index
+		std::atomic<uint64_t> m_Head{ std::numeric_limits<uint32_t>::max() /*empty list*/ };
+	};
+}
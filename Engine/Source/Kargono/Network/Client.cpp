@@ -10,7 +10,6 @@
 #include "Kargono/Core/Engine.h"
 #include "Kargono/Utility/Timers.h"
 
-#include <conio.h>
 #include <queue>
 
 namespace Kargono::Network
@@ -224,6 +223,12 @@ namespace Kargono::Network
 			// Send keep-alive packets
 			HandleConnectionKeepAlive();
 
+			// Resend the entity snapshot until the server acknowledges the latest state
+			if (m_ServerConnection.m_Connection.m_SnapshotSendContext.HasPendingChanges())
+			{
+				m_SnapshotEntitiesChanged = true;
+			}
+
 			// Handle connection timeout
 			if (!HandleConnectionTimeout(m_ManageConnectionTimer.GetConstantFrameTimeFloat()))
 			{
@@ -235,22 +240,28 @@ namespace Kargono::Network
 		m_EventQueue.ProcessQueue();
 		m_WorkQueue.ProcessQueue();
 
+		// Send all entity updates from the processed events in a single snapshot
+		if (m_SnapshotEntitiesChanged)
+		{
+			SendEntitySnapshotMessage();
+		}
+
 		Address sender;
-		unsigned char buffer[k_MaxPacketSize];
 		int bytesRead{ 0 };
 
+		// Receive directly into the pooled message slab
+		Message msg;
+		uint8_t* buffer{ msg.GetPacketPointer() };
+
 		do
 		{
-			bytesRead = i_ClientSocket->Receive(sender, buffer, sizeof(buffer));
+			bytesRead = i_ClientSocket->Receive(sender, buffer, (int)k_MaxPacketSize);
 
 			// Packet cannot be smaller than header
-			if (bytesRead < k_PacketHeaderSize)
+			if (bytesRead < (int)k_PacketHeaderSize)
 			{
 				continue;
 			}
-			
-			// Start forming incoming message
-			Message msg;
 
 			// Check for a valid app ID
 			uint8_t* headerIterator{ buffer };
@@ -294,15 +305,11 @@ namespace Kargono::Network
 			for (AckData data : relContext.GetRecentAcks())
 			{
 				m_ReliabilityNotifiers.m_AckPacketNotifier.Notify(index, data.m_Sequence, data.m_RTT);
+				m_ServerConnection.m_Connection.m_SnapshotSendContext.OnPacketAcked(data.m_Sequence);
 			}
 
-			// Load the packet payload into message
-			if (bytesRead > k_PacketHeaderSize)
-			{
-				msg.m_Header.m_PayloadSize = bytesRead - k_PacketHeaderSize;
-				msg.m_PayloadData.resize(msg.m_Header.m_PayloadSize);
-				memcpy(msg.m_PayloadData.data(), (uint8_t*)buffer + k_PacketHeaderSize, msg.m_Header.m_PayloadSize);
-			}
+			// The payload is already in place after the header
+			msg.m_Header.m_PayloadSize = (size_t)bytesRead - k_PacketHeaderSize;
 
 			OpenMessageFromServer(msg);
 			
@@ -316,27 +323,28 @@ namespace Kargono::Network
 	{
 		m_WorkQueue.ProcessQueue();
 
-		DWORD waitResult = WaitForMultipleObjects(1, &m_NetworkEventHandle, FALSE, (DWORD)m_ActiveSyncPingFreq);
-
-		if (waitResult == WAIT_OBJECT_0)  // Network event
-		{
-			WSANETWORKEVENTS netEvents;
-			WSAEnumNetworkEvents(i_ClientSocket->GetHandle(), m_NetworkEventHandle, &netEvents);
-
-			if (netEvents.lNetworkEvents & FD_READ)
-			{
-				i_NetworkThread->ResumeThread(false);
-			}
-		}
-		else
+		// Block until the socket is readable or the sync-ping timer fires
+		switch (m_SocketEvent.WaitForEvent())
 		{
+		case SocketEventType::SocketReadable:
+		case SocketEventType::TimerExpired:
+			i_NetworkThread->ResumeThread(false);
+			break;
+		case SocketEventType::Interrupted:
+			// Process the work queue/exit on the next iteration
+			break;
+		case SocketEventType::None:
+		case SocketEventType::Failure:
+		default:
+			KG_WARN("Failed to wait on the client's network event handle");
 			i_NetworkThread->ResumeThread(false);
+			break;
 		}
 	}
 
-	void ClientNetworkThread::SubmitFunction(const std::function<void()> workFunction)
+	void ClientNetworkThread::SubmitFunction(FunctionQueue::Function workFunction)
 	{
-		m_WorkQueue.SubmitFunction(workFunction);
+		m_WorkQueue.SubmitFunction(std::move(workFunction));
 
 		m_Thread.ResumeThread(false);
 	}
@@ -369,6 +377,7 @@ namespace Kargono::Network
 			// Essentially clear all session information from this client context
 			m_SessionIndex = k_InvalidSessionIndex;
 			m_SessionStartFrame = 0;
+			ClearSnapshotEntities();
 			break;
 		case Events::EventType::EnableReadyCheck:
 			SendEnableReadyCheckMessage();
@@ -380,7 +389,7 @@ namespace Kargono::Network
 			SendAllEntityLocation(*(Events::SendAllEntityLocation*)event);
 			break;
 		case Events::EventType::SendAllEntityPhysics:
-			SendAllEntityPhysicsMessage(*(Events::SendAllEntityPhysics*)event);
+			UpdateSnapshotEntity(*(Events::SendAllEntityPhysics*)event);
 			break;
 		case Events::EventType::SignalAll:
 			SendAllClientsSignalMessage(*(Events::SignalAll*)event);
@@ -388,6 +397,41 @@ namespace Kargono::Network
 		}
 	}
 
+	void ClientNetworkThread::UpdateSnapshotEntity(Events::SendAllEntityPhysics& event)
+	{
+		QuantizedEntityState newState{ QuantizeEntityState({ event.GetEntityID(), 
+			event.GetTranslation(), event.GetLinearVelocity() }) };
+
+		// Find the entity's sorted position
+		auto entityIter = std::lower_bound(m_SnapshotEntities.begin(), m_SnapshotEntities.end(), newState.m_EntityID,
+			[](const QuantizedEntityState& state, uint64_t entityID)
+		{
+			return state.m_EntityID < entityID;
+		});
+
+		// Update the existing entry or insert a new one
+		if (entityIter != m_SnapshotEntities.end() && entityIter->m_EntityID == newState.m_EntityID)
+		{
+			if (*entityIter == newState)
+			{
+				return;
+			}
+			*entityIter = newState;
+		}
+		else
+		{
+			m_SnapshotEntities.insert(entityIter, newState);
+		}
+
+		m_SnapshotEntitiesChanged = true;
+	}
+
+	void ClientNetworkThread::ClearSnapshotEntities()
+	{
+		m_SnapshotEntities.clear();
+		m_SnapshotEntitiesChanged = false;
+	}
+
 	void ClientNetworkThread::RequestConnection()
 	{
 		// Check for a network update
@@ -470,9 +514,8 @@ namespace Kargono::Network
 
 		Connection& connection = m_ServerConnection.m_Connection;
 
-		// Prepare the final data buffer
-		uint8_t buffer[k_MaxPacketSize];
-		uint8_t* headerIterator{ buffer };
+		// Write the header in-place in front of the message's payload
+		uint8_t* headerIterator{ msg.GetPacketPointer() };
 
 		// Set the app ID
 		AppID& appIDLocation = *(AppID*)headerIterator;
@@ -498,15 +541,9 @@ namespace Kargono::Network
 			m_ReliabilityNotifiers.m_SendPacketNotifier.Notify(m_ServerConnection.m_ClientIndex, sentPacket);
 		}
 
-		if (msg.m_Header.m_PayloadSize > 0)
-		{
-			// Set the payload data
-			memcpy(&buffer[k_PacketHeaderSize], msg.m_PayloadData.data(), msg.m_Header.m_PayloadSize);
-		}
-
 		// Send the message
 		bool sendSuccess{ false };
-		sendSuccess = i_ClientSocket->Send(connection.m_Address, buffer, msg.m_Header.m_PayloadSize + k_PacketHeaderSize);
+		sendSuccess = i_ClientSocket->Send(connection.m_Address, msg.GetPacketPointer(), (int)msg.GetPacketSize());
 
 		return sendSuccess;
 	}
@@ -515,6 +552,8 @@ namespace Kargono::Network
 	{
 		m_Connection.m_Address = config.m_ServerAddress;
 		m_Connection.m_ReliabilityContext = ReliabilityContext();
+		m_Connection.m_SnapshotSendContext.Reset();
+		m_Connection.m_SnapshotReceiveContext.Reset();
 		m_Status = ConnectionStatus::Disconnected;
 		m_ClientIndex = k_InvalidClientIndex;
 	}
@@ -523,6 +562,8 @@ namespace Kargono::Network
 	{
 		m_Connection.m_Address = Address();
 		m_Connection.m_ReliabilityContext = ReliabilityContext();
+		m_Connection.m_SnapshotSendContext.Reset();
+		m_Connection.m_SnapshotReceiveContext.Reset();
 		m_Status = ConnectionStatus::Disconnected;
 		m_ClientIndex = k_InvalidClientIndex;
 	}
@@ -602,20 +643,23 @@ namespace Kargono::Network
 		SendToServer(msg);
 	}
 
-	void ClientNetworkThread::SendAllEntityPhysicsMessage(Events::SendAllEntityPhysics& event)
+	void ClientNetworkThread::SendEntitySnapshotMessage()
 	{
-		// Create/send a message that updates all other clients with a particular entity's 
-		// ID, location, and velocity.
+		m_SnapshotEntitiesChanged = false;
+
+		// Entities are only replicated within a session
+		if (m_SessionIndex == k_InvalidSessionIndex)
+		{
+			return;
+		}
+
+		// Create/send a snapshot that updates all other clients with this client's entities.
+		// The snapshot is delta-encoded against the last snapshot acknowledged by the server.
+		Connection& connection = m_ServerConnection.m_Connection;
 		Message msg;
-		msg.m_Header.m_MessageType = MessageType::ManageSceneEntity_SendAllClientsPhysics;
-		msg << event.GetEntityID();
-		Math::vec3 translation = event.GetTranslation();
-		Math::vec2 linearVelocity = event.GetLinearVelocity();
-		msg << translation.x;
-		msg << translation.y;
-		msg << translation.z;
-		msg << linearVelocity.x;
-		msg << linearVelocity.y;
+		msg.m_Header.m_MessageType = MessageType::ManageSceneEntity_SendAllClientsSnapshot;
+		connection.m_SnapshotSendContext.WriteSnapshot(m_SnapshotEntities,
+			connection.m_ReliabilityContext.GetLocalSequence(), msg);
 
 		// Send the message quickly with UDP
 		SendToServer(msg);
@@ -632,6 +676,7 @@ namespace Kargono::Network
 
 		// Ensure current application/client is aware our session is invalid
 		m_SessionIndex = k_InvalidSessionIndex;
+		ClearSnapshotEntities();
 	}
 
 	void ClientNetworkThread::SendRequestConnectionMessage()
@@ -700,6 +745,9 @@ namespace Kargono::Network
 		case MessageType::ScriptMessaging_ReceiveSignal:
 			OpenReceiveSignalMessage(msg);
 			break;
+		case MessageType::ManageSceneEntity_UpdateSnapshot:
+			OpenUpdateSnapshotMessage(msg);
+			break;
 		case MessageType::ManageConnection_KeepAlive:
 			break;
 		default:
@@ -852,6 +900,25 @@ namespace Kargono::Network
 		EngineService::SubmitToEventQueue(CreateRef<Events::ReceiveSignal>(signal));
 	}
 
+	void ClientNetworkThread::OpenUpdateSnapshotMessage(Message& msg)
+	{
+		// Reconstruct the snapshot from its baseline and collect the modified entities
+		SnapshotReceiveContext& snapshotContext{ m_ServerConnection.m_Connection.m_SnapshotReceiveContext };
+		if (!snapshotContext.ReadSnapshot(msg, m_ReceivedSnapshotEntities))
+		{
+			KG_WARN("Failed to read entity snapshot from the server");
+			return;
+		}
+
+		// Pass each modified entity along to the main thread
+		for (const QuantizedEntityState& state : m_ReceivedSnapshotEntities)
+		{
+			EntitySnapshotState entityState{ DequantizeEntityState(state) };
+			EngineService::SubmitToEventQueue(CreateRef<Events::UpdateEntityPhysics>(entityState.m_EntityID, 
+				entityState.m_Translation, entityState.m_LinearVelocity));
+		}
+	}
+
 	bool ClientService::Init()
 	{
 		if (s_Client.m_ClientActive)
@@ -964,11 +1031,11 @@ namespace Kargono::Network
 		// Allow the network thread to handle this on its run loop
 		SubmitToNetworkEventQueue(CreateRef<Events::SignalAll>(signal));
 	}
-	void ClientService::SubmitToNetworkFunctionQueue(const std::function<void()>& function)
+	void ClientService::SubmitToNetworkFunctionQueue(FunctionQueue::Function function)
 	{
 		KG_ASSERT(s_Client.m_ClientActive);
 
-		s_Client.GetNetworkThread().SubmitFunction(function);
+		s_Client.GetNetworkThread().SubmitFunction(std::move(function));
 	}
 	void ClientService::SubmitToNetworkEventQueue(Ref<Events::Event> e)
 	{
@@ -985,9 +1052,8 @@ namespace Kargono::Network
 		i_ClientSocket = clientSocket;
 		i_NetworkThread = networkThread;
 
-		// Create network event
-		m_NetworkEventHandle = WSACreateEvent();
-		if (WSAEventSelect(i_ClientSocket->GetHandle(), m_NetworkEventHandle, FD_READ) != 0)
+		// Create the socket readiness and sync-ping timer event
+		if (!m_SocketEvent.Init(i_ClientSocket, m_ActiveSyncPingFreq))
 		{
 			KG_WARN("Failed to create the network event handle");
 			return false;
@@ -999,7 +1065,16 @@ namespace Kargono::Network
 	}
 	void ClientEventThread::Terminate(bool withinEventThread)
 	{
-		m_Thread.StopThread(withinEventThread);
+		if (withinEventThread)
+		{
+			m_Thread.StopThread(true);
+			return;
+		}
+
+		// Wake the thread if it is blocked waiting on the socket/timer
+		m_SocketEvent.Interrupt();
+		m_Thread.StopThread(false);
+		m_SocketEvent.Terminate();
 	}
 	void ClientEventThread::WaitOnThread()
 	{
@@ -1010,7 +1085,11 @@ namespace Kargono::Network
 		m_WorkQueue.SubmitFunction([&, frequency]()
 		{
 			m_ActiveSyncPingFreq = frequency;
+			m_SocketEvent.SetTimerFrequency(frequency);
 		});
+
+		// Wake the thread so the new frequency is applied immediately
+		m_SocketEvent.Interrupt();
 	}
 	void ClientNotifiers::Init(std::atomic<bool>* clientActive)
 	{
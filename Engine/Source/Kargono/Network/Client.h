@@ -158,11 +158,18 @@ namespace Kargono::Network
 		//==============================
 		// Work Queues
 		//==============================
-		void SubmitFunction(const std::function<void()> workFunction);
+		void SubmitFunction(FunctionQueue::Function workFunction);
 		void SubmitEvent(Ref<Events::Event> event);
 
 	private:
 		void OnEvent(Events::Event* event);
+
+		//==============================
+		// Manage Entity Snapshots
+		//==============================
+		// Store the entity's latest state for the next outgoing snapshot
+		void UpdateSnapshotEntity(Events::SendAllEntityPhysics& event);
+		void ClearSnapshotEntities();
 	public:
 		//==============================
 		// Getters/Setters
@@ -202,6 +209,7 @@ namespace Kargono::Network
 		void OpenUpdateEntityLocationMessage(Message& msg);
 		void OpenUpdateEntityPhysicsMessage(Message& msg);
 		void OpenReceiveSignalMessage(Message& msg);
+		void OpenUpdateSnapshotMessage(Message& msg);
 
 		//==============================
 		// Send Messages to Server
@@ -216,7 +224,7 @@ namespace Kargono::Network
 		void SendEnableReadyCheckMessage();
 		void SendSessionReadyCheckMessage();
 		void SendAllClientsSignalMessage(Events::SignalAll& event);
-		void SendAllEntityPhysicsMessage(Events::SendAllEntityPhysics& event);
+		void SendEntitySnapshotMessage();
 		void SendLeaveCurrentSessionMessage();
 		void SendRequestConnectionMessage();
 		void SendKeepAliveMessage();
@@ -239,6 +247,10 @@ namespace Kargono::Network
 		// Session
 		UpdateCount m_SessionStartFrame{ 0 };
 		std::atomic<SessionIndex> m_SessionIndex{ k_InvalidSessionIndex };
+		// Entity snapshots (sorted by entity ID)
+		std::vector<QuantizedEntityState> m_SnapshotEntities{};
+		std::vector<QuantizedEntityState> m_ReceivedSnapshotEntities{};
+		bool m_SnapshotEntitiesChanged{ false };
 		// Notifiers
 		ClientNetworkNotifiers m_Notifiers{};
 		ReliabilityContextNotifiers m_ReliabilityNotifiers{};
@@ -289,8 +301,8 @@ namespace Kargono::Network
 		// Thread context and queues
 		KGThread m_Thread{};
 		FunctionQueue m_WorkQueue{};
-		// OS handles
-		HANDLE m_NetworkEventHandle{};
+		// OS socket readiness/timer events
+		SocketEvent m_SocketEvent{};
 		// Config
 		size_t m_ActiveSyncPingFreq{ 1'000 /*1 sec*/ };
 
@@ -385,7 +397,7 @@ namespace Kargono::Network
 		//==============================
 		// Submit Client Events & Functions
 		//==============================
-		static void SubmitToNetworkFunctionQueue(const std::function<void()>& function);
+		static void SubmitToNetworkFunctionQueue(FunctionQueue::Function function);
 		static void SubmitToNetworkEventQueue(Ref<Events::Event> e);
 	private:
 		//==============================
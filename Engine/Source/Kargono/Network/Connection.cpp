@@ -21,7 +21,7 @@ namespace Kargono::Network
 
 		// Check for an empty connection slot
 		ClientIndex iteration{ 0 };
-		for (bool connected : m_ClientsConnected)
+		for (uint8_t connected : m_ClientsConnected)
 		{
 			if (!connected)
 			{
@@ -30,6 +30,8 @@ namespace Kargono::Network
 				m_ClientsConnected[iteration] = true;
 				indicatedConnection.m_Address = newAddress;
 				indicatedConnection.m_ReliabilityContext = ReliabilityContext();
+				indicatedConnection.m_SnapshotSendContext.Reset();
+				indicatedConnection.m_SnapshotReceiveContext.Reset();
 
 				// Update connection list state
 				m_NumClients++;
@@ -96,7 +98,7 @@ namespace Kargono::Network
 			KG_WARN("Attempt to query if a client is connected that is out of bounds {}", clientIndex);
 			return false;
 		}
-		return m_ClientsConnected[clientIndex];
+		return m_ClientsConnected[clientIndex] != 0;
 	}
 
 	bool ConnectionList::IsAddressActive(Address clientAddress)
@@ -3,6 +3,7 @@
 #include "Kargono/Network/Address.h"
 #include "Kargono/Network/NetworkCommon.h"
 #include "Kargono/Network/ReliabilityContext.h"
+#include "Kargono/Network/Snapshot.h"
 
 #include <vector>
 
@@ -12,6 +13,9 @@ namespace Kargono::Network
 	{
 		Address m_Address;
 		ReliabilityContext m_ReliabilityContext{};
+		// Entity snapshot replication state for this peer
+		SnapshotSendContext m_SnapshotSendContext{};
+		SnapshotReceiveContext m_SnapshotReceiveContext{};
 	};
 
 	class ConnectionList
@@ -48,6 +52,8 @@ namespace Kargono::Network
 		ClientIndex m_MaxClients{ 0 };
 		ClientIndex m_NumClients{ 0 };
 		std::vector<Connection> m_AllConnections{};
-		std::vector<bool> m_ClientsConnected{};
+		// One byte per client (not std::vector<bool>) so session workers can query the connections
+		//		they own while the network thread updates others
+		std::vector<uint8_t> m_ClientsConnected{};
 	};
 }
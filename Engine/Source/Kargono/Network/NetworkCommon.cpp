@@ -2,45 +2,144 @@
 
 #include "Kargono/Network/NetworkCommon.h"
 
+#include "Kargono/Memory/AtomicPoolAlloc.h"
+
 namespace Kargono::Network
 {
+	// Number of slabs held by the shared message pool (~1MB)
+	constexpr size_t k_MessagePoolSlabCount{ 4'096 };
+
+	static Memory::AtomicPoolAlloc& GetMessagePool()
+	{
+		// Function-local statics ensure the pool exists before any (static) message is created
+		alignas(16) static uint8_t s_BackingBuffer[k_MessagePoolSlabCount * k_MaxPacketSize];
+		static Memory::AtomicPoolAlloc s_Pool{};
+		[[maybe_unused]] static bool s_PoolInitialized = []()
+		{
+			s_Pool.Init(s_BackingBuffer, sizeof(s_BackingBuffer), k_MaxPacketSize, 16);
+			return true;
+		}();
+		return s_Pool;
+	}
+
+	uint8_t* MessageBufferPool::AllocBuffer()
+	{
+		uint8_t* buffer = GetMessagePool().AllocRaw();
+
+		// Fall back to the heap if every slab is in use
+		if (!buffer)
+		{
+			buffer = new uint8_t[k_MaxPacketSize];
+		}
+		return buffer;
+	}
+
+	void MessageBufferPool::FreeBuffer(uint8_t* buffer)
+	{
+		if (!buffer)
+		{
+			return;
+		}
+
+		Memory::AtomicPoolAlloc& pool = GetMessagePool();
+		if (pool.Contains(buffer))
+		{
+			pool.Free(buffer);
+		}
+		else
+		{
+			delete[] buffer;
+		}
+	}
+
+	Message::Message()
+	{
+		m_PacketBuffer = MessageBufferPool::AllocBuffer();
+	}
+
+	Message::~Message()
+	{
+		MessageBufferPool::FreeBuffer(m_PacketBuffer);
+	}
+
+	Message::Message(const Message& other)
+	{
+		m_Header = other.m_Header;
+		m_PacketBuffer = MessageBufferPool::AllocBuffer();
+		std::memcpy(m_PacketBuffer, other.m_PacketBuffer, k_PacketHeaderSize + other.m_Header.m_PayloadSize);
+	}
+
+	Message::Message(Message&& other) noexcept
+	{
+		m_Header = other.m_Header;
+		m_PacketBuffer = other.m_PacketBuffer;
+		other.m_Header = {};
+		other.m_PacketBuffer = nullptr;
+	}
+
+	Message& Message::operator=(const Message& other)
+	{
+		if (this != &other)
+		{
+			// Reuse the existing slab
+			if (!m_PacketBuffer)
+			{
+				m_PacketBuffer = MessageBufferPool::AllocBuffer();
+			}
+			m_Header = other.m_Header;
+			std::memcpy(m_PacketBuffer, other.m_PacketBuffer, k_PacketHeaderSize + other.m_Header.m_PayloadSize);
+		}
+		return *this;
+	}
+
+	Message& Message::operator=(Message&& other) noexcept
+	{
+		if (this != &other)
+		{
+			MessageBufferPool::FreeBuffer(m_PacketBuffer);
+			m_Header = other.m_Header;
+			m_PacketBuffer = other.m_PacketBuffer;
+			other.m_Header = {};
+			other.m_PacketBuffer = nullptr;
+		}
+		return *this;
+	}
+
 	size_t Message::GetEntireMessageSize() const
 	{
-		return sizeof(MessageHeader) + m_PayloadData.size();
+		return sizeof(MessageHeader) + m_Header.m_PayloadSize;
 	}
 	void Message::AppendPayload(void* buffer, uint64_t size)
 	{
-		// Cache current size of vector, as this will be the point we insert the data
-		size_t cachedBufferSize = m_PayloadData.size();
+		KG_ASSERT(m_Header.m_PayloadSize + size + sizeof(uint64_t) <= k_MaxPayloadSize);
 
-		// Resize the vector to contain the old-data + new-data + size-of-payload
-		m_PayloadData.resize(m_PayloadData.size() + size + sizeof(uint64_t));
+		// Cache current size of payload, as this will be the point we insert the data
+		uint8_t* payloadEnd = (uint8_t*)GetPayloadPointer() + m_Header.m_PayloadSize;
 
 		// Copy the data into the end of the current buffer
-		std::memcpy(m_PayloadData.data() + cachedBufferSize, buffer, size);
+		std::memcpy(payloadEnd, buffer, size);
 
 		// Append the new size of the payload to the end
-		std::memcpy(m_PayloadData.data() + cachedBufferSize + size, &size, sizeof(uint64_t));
+		std::memcpy(payloadEnd + size, &size, sizeof(uint64_t));
 
 		// Update message header's payload size
-		m_Header.m_PayloadSize = m_PayloadData.size();
+		m_Header.m_PayloadSize += size + sizeof(uint64_t);
 	}
 	std::vector<uint8_t> Message::GetPayloadCopy(uint64_t size)
 	{
+		KG_ASSERT(m_Header.m_PayloadSize >= size);
+
 		std::vector<uint8_t> newBuffer{};
 		newBuffer.resize(size);
 
-		// Cache current size of vector, as this will be the point we insert the data
-		size_t bufferSizeAfterRemoval = m_PayloadData.size() - size;
+		// Cache current size of payload, as this will be the point we read the data from
+		size_t bufferSizeAfterRemoval = m_Header.m_PayloadSize - size;
 
 		// Copy the data over
-		std::memcpy((void*)newBuffer.data(), m_PayloadData.data() + bufferSizeAfterRemoval, size);
-
-		// Shrink the vector to remove the read bytes
-		m_PayloadData.resize(bufferSizeAfterRemoval);
+		std::memcpy((void*)newBuffer.data(), (uint8_t*)GetPayloadPointer() + bufferSizeAfterRemoval, size);
 
-		// Update message header size
-		m_Header.m_PayloadSize = m_PayloadData.size();
+		// Update message header size to remove the read bytes
+		m_Header.m_PayloadSize = bufferSizeAfterRemoval;
 
 		return newBuffer;
 	}
@@ -50,7 +50,11 @@ namespace Kargono::Network
 
 		// Script communication
 		ScriptMessaging_SendAllClientsSignal,
-		ScriptMessaging_ReceiveSignal
+		ScriptMessaging_ReceiveSignal,
+
+		// Entity snapshot replication
+		ManageSceneEntity_SendAllClientsSnapshot,
+		ManageSceneEntity_UpdateSnapshot
 	};
 
 	// Packet Header Types
@@ -64,6 +68,15 @@ namespace Kargono::Network
 
 	constexpr ClientIndex k_InvalidClientIndex{ std::numeric_limits<ClientIndex>::max() };
 
+	// Compare sequence numbers while accounting for wrap-around
+	inline bool SequenceGreaterThan(PacketSequence sequence1, PacketSequence sequence2)
+	{
+		constexpr PacketSequence k_HalfSequence{ std::numeric_limits<PacketSequence>::max() / 2 };
+
+		return ((sequence1 > sequence2) && (sequence1 - sequence2 <= k_HalfSequence)) ||
+			((sequence1 < sequence2) && (sequence2 - sequence1 > k_HalfSequence));
+	}
+
 	constexpr size_t k_ReliabilitySegmentSize
 	{
 		sizeof(PacketSequence) /*packetSequenceNum*/ +
@@ -102,16 +115,44 @@ namespace Kargono::Network
 		uint64_t m_PayloadSize{ 0 };
 	};
 
+	//==============================
+	// Message Buffer Pool
+	//==============================
+	// Hands out fixed k_MaxPacketSize slabs to messages on any network thread. Slabs come from a
+	//		lock-free pool, so steady-state packet handling performs no heap allocations. If the pool
+	//		is exhausted, slabs fall back to the heap.
+	class MessageBufferPool
+	{
+	public:
+		//==============================
+		// Manage Buffers
+		//==============================
+		static uint8_t* AllocBuffer();
+		static void FreeBuffer(uint8_t* buffer);
+	};
+
 	//==============================
 	// Message Struct
 	//==============================
 	struct Message
 	{
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		Message();
+		~Message();
+		Message(const Message& other);
+		Message(Message&& other) noexcept;
+		Message& operator=(const Message& other);
+		Message& operator=(Message&& other) noexcept;
+
 		//==============================
 		// Fields
 		//==============================
 		MessageHeader m_Header{};
-		std::vector<uint8_t> m_PayloadData;
+		// Pooled packet slab. The packet header is written in-place into the first
+		//		k_PacketHeaderSize bytes and the payload follows directly after it.
+		uint8_t* m_PacketBuffer{ nullptr };
 
 		//==============================
 		// Modify Message Data
@@ -130,8 +171,12 @@ namespace Kargono::Network
 		//==============================
 		// Return size of Payload + Header
 		size_t GetEntireMessageSize() const;
+		// Returns pointer to start of the packet (header + payload)
+		uint8_t* GetPacketPointer() { return m_PacketBuffer; }
+		// Returns size of the packet (header + payload) in bytes
+		size_t GetPacketSize() const { return k_PacketHeaderSize + m_Header.m_PayloadSize; }
 		// Returns pointer to start of payload
-		void* GetPayloadPointer() { return (void*)m_PayloadData.data(); }
+		void* GetPayloadPointer() { return (void*)(m_PacketBuffer + k_PacketHeaderSize); }
 		// Returns size of payload in bytes
 		uint64_t GetPayloadSize() { return m_Header.m_PayloadSize; }
 		// Return copy internal buffer
@@ -147,18 +192,13 @@ namespace Kargono::Network
 	{
 		// Check that the type of the data being pushed is trivially copyable
 		static_assert(std::is_standard_layout_v<DataType>, "Data is too complex");
+		KG_ASSERT(msg.m_Header.m_PayloadSize + sizeof(DataType) <= k_MaxPayloadSize);
 
-		// Cache current size of vector, as this will be the point we insert the data
-		size_t currentBufferSize = msg.m_PayloadData.size();
-
-		// Resize the vector to contain the new data being added
-		msg.m_PayloadData.resize(msg.m_PayloadData.size() + sizeof(DataType));
-
-		// Copy the data over
-		std::memcpy(msg.m_PayloadData.data() + currentBufferSize, &data, sizeof(DataType));
+		// Copy the data onto the end of the current payload
+		std::memcpy((uint8_t*)msg.GetPayloadPointer() + msg.m_Header.m_PayloadSize, &data, sizeof(DataType));
 
 		// Update message header size
-		msg.m_Header.m_PayloadSize = (uint32_t)msg.m_PayloadData.size();
+		msg.m_Header.m_PayloadSize += sizeof(DataType);
 
 		return msg;
 	}
@@ -168,24 +208,24 @@ namespace Kargono::Network
 	{
 		// Check that the type of the data being pushed is trivially copyable
 		static_assert(std::is_standard_layout<DataType>::value, "Data is too complex");
-		KG_ASSERT((int)msg.m_PayloadData.size() - (int)sizeof(DataType) >= 0);
+		KG_ASSERT(msg.m_Header.m_PayloadSize >= sizeof(DataType));
 
-		// Cache current size of vector, as this will be the point we insert the data
-		size_t bufferSizeAfterRemoval = msg.m_PayloadData.size() - sizeof(DataType);
+		// Cache current size of payload, as this will be the point we read the data from
+		size_t bufferSizeAfterRemoval = msg.m_Header.m_PayloadSize - sizeof(DataType);
 
 		// Copy the data over
-		std::memcpy((void*)&data, msg.m_PayloadData.data() + bufferSizeAfterRemoval, sizeof(DataType));
+		std::memcpy((void*)&data, (uint8_t*)msg.GetPayloadPointer() + bufferSizeAfterRemoval, sizeof(DataType));
 
-		// Shrink the vector to remove the read bytes
-		msg.m_PayloadData.resize(bufferSizeAfterRemoval);
-
-		// Update message header size
-		msg.m_Header.m_PayloadSize = (uint32_t)msg.GetEntireMessageSize();
+		// Update message header size to remove the read bytes
+		msg.m_Header.m_PayloadSize = bufferSizeAfterRemoval;
 
 		return msg;
 	}
 	using SessionIndex = uint8_t;
 	constexpr SessionIndex k_InvalidSessionIndex = std::numeric_limits<SessionIndex>::max();
+	// Identifies one of the sessions hosted by a server
+	using SessionID = uint16_t;
+	constexpr SessionID k_InvalidSessionID = std::numeric_limits<SessionID>::max();
 	// TODO: VERY TEMPORARY. Only for pong!!!!
 	constexpr size_t k_MaxSessionClients{ 2 };
 
@@ -45,6 +45,12 @@ namespace Kargono::Network
 		outputStream << "  # \"LocalMachine\" only allows clients to connect on the same computer. \"Internet\" allows online connections" << '\n';
 		outputStream << "  ServerLocation: " << Utility::ServerLocationToString(config.m_ServerLocation) << '\n';
 
+		// Session hosting
+		outputStream << "  # Maximum number of sessions (matches) hosted by this server process." << '\n';
+		outputStream << "  MaxSessions: " << std::to_string(config.m_MaxSessions) << '\n';
+		outputStream << "  # Number of worker threads the sessions are spread across. 0 uses the available hardware threads." << '\n';
+		outputStream << "  SessionWorkers: " << std::to_string(config.m_SessionWorkerCount) << '\n';
+
 		// Client validation secrets
 		outputStream << "  # The secrets can be any number you want that is a 64 bit unsigned integer.These are used for basic security." << '\n';
 
@@ -16,14 +16,6 @@ namespace Kargono::Network
 		return duration<float>(steady_clock::now().time_since_epoch()).count();
 	}
 
-	static bool SequenceGreaterThan(PacketSequence sequence1, PacketSequence sequence2)
-	{
-		constexpr PacketSequence k_HalfSequence{ std::numeric_limits<PacketSequence>::max() / 2 };
-
-		return ((sequence1 > sequence2) && (sequence1 - sequence2 <= k_HalfSequence)) ||
-			((sequence1 < sequence2) && (sequence2 - sequence1 > k_HalfSequence));
-	}
-
 	void ReliabilityContext::OnUpdate(float deltaTime)
 	{
 		m_LastPacketReceived += deltaTime;
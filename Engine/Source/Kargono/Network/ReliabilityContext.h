@@ -50,6 +50,7 @@ namespace Kargono::Network
 
 	private:
 		friend class ServerNetworkThread;
+		friend class ServerSessionWorker;
 		friend class ClientNetworkThread;
 	};
 
@@ -162,6 +163,11 @@ namespace Kargono::Network
 
 			return { m_RecentAcks.data(), m_RecentAckCount };
 		}
+		// Sequence number the next outgoing packet will be stamped with
+		PacketSequence GetLocalSequence() const
+		{
+			return m_LocalSequence;
+		}
 
 		//==============================
 		// External Fields
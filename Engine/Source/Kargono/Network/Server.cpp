@@ -6,7 +6,6 @@
 #include "Kargono/Core/Engine.h"
 #include "Kargono/Utility/Operations.h"
 
-#include <conio.h>
 #include <queue>
 #include <atomic>
 
@@ -14,7 +13,7 @@ namespace Kargono::Network
 {
 	void ServerNetworkThread::OpenMessageFromClient(ClientIndex client, Kargono::Network::Message& incomingMessage)
 	{
-		// Handle messages based on their type
+		// Handle messages from clients outside of a session based on their type
 		switch (incomingMessage.m_Header.m_MessageType)
 		{
 		case MessageType::ManageSession_RequestClientJoin:
@@ -26,20 +25,16 @@ namespace Kargono::Network
 		case MessageType::ManageSession_NotifyAllLeave:
 			OpenNotifyAllLeaveMessage(client);
 			break;
-		case MessageType::ManageSession_StartReadyCheck:
-			OpenStartReadyCheckMessage(client);
+		case MessageType::ManageSceneEntity_SendAllClientsSnapshot:
+			// Keep the snapshot history intact, since the client may reference it as a baseline later
+			m_AllConnections.GetConnection(client).m_SnapshotReceiveContext.ReadSnapshot(incomingMessage, m_SnapshotEntities);
 			break;
+		case MessageType::ManageSession_StartReadyCheck:
 		case MessageType::ManageSession_EnableReadyCheck:
-			OpenEnableReadyCheckMessage();
-			break;
 		case MessageType::ManageSceneEntity_SendAllClientsLocation:
-			OpenSendAllClientsLocationMessage(client, incomingMessage);
-			break;
 		case MessageType::ManageSceneEntity_SendAllClientsPhysics:
-			OpenSendAllClientsPhysicsMessage(client, incomingMessage);
-			break;
 		case MessageType::ScriptMessaging_SendAllClientsSignal:
-			OpenSendAllClientsSignalMessage(client, incomingMessage);
+			// Session messages are ignored until the client joins a session
 			break;
 		case MessageType::ManageConnection_KeepAlive:
 			break;
@@ -50,48 +45,31 @@ namespace Kargono::Network
 	}
 	void ServerNetworkThread::OpenRequestClientJoinMessage(ClientIndex newClient, Kargono::Network::Message& msg)
 	{
-		// Deny client join if session slots are full
-		if (m_OnlySession.GetClientCount() >= k_MaxSessionClients)
+		// Deny client join if all session slots are full
+		SessionID sessionID{ FindJoinableSession() };
+		if (sessionID == k_InvalidSessionID)
 		{
 			SendDenyClientJoinMessage(newClient);
 			return;
 		}
 
-		// Add client to session and ensure slot is valid
-		SessionIndex clientSlot = m_OnlySession.AddClient(newClient);
-		if (clientSlot == k_InvalidSessionIndex)
+		// Hand the client's connection to the worker hosting the session
+		SessionHandoff handoff;
+		handoff.m_Type = SessionHandoffType::JoinSession;
+		handoff.m_Client = newClient;
+		handoff.m_SessionID = sessionID;
+		handoff.m_ClientCount = m_AllConnections.GetNumberOfClients();
+		if (!GetSessionWorker(sessionID).SubmitHandoff(std::move(handoff)))
 		{
+			KG_WARN("Failed to add client {} to session {}. The session worker's queue is full.", newClient, sessionID);
 			SendDenyClientJoinMessage(newClient);
 			return;
 		}
 
-		// Send approval message to the new client
-		SendApproveClientJoinMessage(newClient, clientSlot);
-
-		// Notify all other session clients that new client has been added
-		for (SessionIndex sessionIndex : m_OnlySession.GetSessionClients().GetActiveIndices())
-		{
-			ClientIndex sessionClient{ m_OnlySession.GetClient(sessionIndex)};
-
-			// Skip the current client (it already knows from approval)
-			if (newClient == sessionClient)
-			{
-				continue;
-			}
-
-			// Update existing client about new addition
-			SendUpdateClientSlotMessage(sessionClient, clientSlot);
-
-			// Update new client about other session clients
-			SendUpdateClientSlotMessage(newClient, sessionIndex);
-		}
-
-		// If enough clients are connected, start the session
-		if (m_OnlySession.GetClientCount() == k_MaxSessionClients)
-		{
-			// TODO: Probably should expose this to the scripts instead of automatically starting the session
-			m_OnlySession.CreateSession();
-		}
+		// The network thread no longer accesses this connection
+		m_ClientSessions[newClient] = sessionID;
+		m_SessionClientCounts[sessionID]++;
+		m_WorkersToResume[sessionID % m_SessionWorkers.size()] = true;
 	}
 	void ServerNetworkThread::OpenRequestClientCountMessage(ClientIndex client)
 	{
@@ -102,110 +80,25 @@ namespace Kargono::Network
 	}
 	void ServerNetworkThread::OpenNotifyAllLeaveMessage(ClientIndex client)
 	{
-		KG_INFO("[{}]: User Leaving Session", client);
-
-		// Remove the client from the session
-		SessionIndex removedClient = m_OnlySession.RemoveClient(client);
-
-		// Ensure the client removal was successful
-		if (removedClient == k_InvalidSessionIndex)
-		{
-			KG_WARN("Failed to remove client from the active session");
-			return;
-		}
-
-		// Notify all users in the same session that a client left
-		for (ClientIndex sessionClient : m_OnlySession.GetSessionClients())
-		{
-			SendClientLeftMessage(sessionClient, removedClient);
-		}
-
-		// Notify the removed client it is removed 
-		// (note this is necessary since the client no longer exists in the session list)
-		SendClientLeftMessage(client, removedClient);
-	}
-	void ServerNetworkThread::OpenStartReadyCheckMessage(ClientIndex client)
-	{
-		m_OnlySession.StoreClientReady(client);
-	}
-	void ServerNetworkThread::OpenEnableReadyCheckMessage()
-	{
-		m_OnlySession.StartReadyCheck();
-	}
-	void ServerNetworkThread::OpenSendAllClientsLocationMessage(ClientIndex client, Message& msg)
-	{
-		// Forward entity location to all other clients
-		for (ClientIndex sessionClient : m_OnlySession.GetSessionClients())
-		{
-			// Do not forward the message back to the original client
-			if (client == sessionClient)
-			{
-				continue;
-			}
-
-			SendUpdateLocationMessage(sessionClient, msg);
-		}
-	}
-	void ServerNetworkThread::OpenSendAllClientsPhysicsMessage(ClientIndex client, Message& msg)
-	{
-
-		// Forward entity Physics to all other clients
-		for (ClientIndex sessionClient : m_OnlySession.GetSessionClients())
-		{
-			// Do not forward the message back to the original client
-			if (client == sessionClient)
-			{
-				continue;
-			}
-
-			SendUpdatePhysicsMessage(sessionClient, msg);
-		}
-
-	}
-	void ServerNetworkThread::OpenSendAllClientsSignalMessage(ClientIndex client, Message& msg)
-	{
-		// Forward signal to all other session clients
-		for (ClientIndex sessionClient : m_OnlySession.GetSessionClients())
-		{
-			// Do not forward the message back to the original client
-			if (client == sessionClient)
-			{
-				continue;
-			}
-
-			SendSignalMessage(sessionClient, msg);
-		}
+		// Clients inside of a session are handled by their session worker
+		KG_WARN("[{}]: Failed to remove client from session. Client is not in a session", client);
 	}
 
 	void ServerNetworkThread::HandleConnectionKeepAlive()
 	{
-		if (m_CongestionCounter % 3 == 0)
-		{
-			// Send keep-alive to all connections
-			Message msg;
-			msg.m_Header.m_MessageType = MessageType::ManageConnection_KeepAlive;
-			SendToAllConnections(msg);
-		}
-		else
+		// Only manage connections owned by the network thread. Session workers manage their own clients.
+		ClientIndex recipients[k_InvalidClientIndex];
+		size_t recipientCount{ 0 };
+		for (ClientIndex index{ 0 }; index < (ClientIndex)m_AllConnections.GetAllConnections().size(); index++)
 		{
-			// Only send keep alive to non-congested connections
-			ClientIndex index{ 0 };
-			for (Connection& connection : m_AllConnections.GetAllConnections())
+			if (m_AllConnections.IsConnectionActive(index) && m_ClientSessions[index] == k_InvalidSessionID)
 			{
-				if (!m_AllConnections.IsConnectionActive(index))
-				{
-					continue;
-				}
-
-				if (!connection.m_ReliabilityContext.m_CongestionContext.IsCongested())
-				{
-					Message msg;
-					msg.m_Header.m_MessageType = MessageType::ManageConnection_KeepAlive;
-					SendToConnection(index, msg);
-				}
-				index++;
+				recipients[recipientCount++] = index;
 			}
 		}
+
+		// Congested connections only receive every third keep-alive
+		SendKeepAliveToAllMessage({ recipients, recipientCount }, m_CongestionCounter % 3 == 0);
 		m_CongestionCounter++;
 	}
 
@@ -234,17 +127,14 @@ namespace Kargono::Network
 		}
 	}
 
-	void ServerNetworkThread::SendClientLeftMessageToAll(SessionIndex removedClientSlot)
+	void ServerNetworkThread::SendClientLeftMessageToAll(Session& session, SessionIndex removedClientSlot)
 	{
 		Message newMessage;
 		newMessage.m_Header.m_MessageType = MessageType::ManageSession_ClientLeft;
 		newMessage << removedClientSlot;
 
 		// Notify all users in the same session that a client left
-		for (ClientIndex clientIndex : m_OnlySession.GetSessionClients())
-		{
-			SendToConnection(clientIndex, newMessage);
-		}
+		SendToSessionClients(session, newMessage);
 
 	}
 	void ServerNetworkThread::SendServerPingMessage(ClientIndex client, Kargono::Network::Message& msg)
@@ -299,8 +189,21 @@ namespace Kargono::Network
 		clientCountMessage.m_Header.m_MessageType = MessageType::ServerQuery_ReceiveClientCount;
 		clientCountMessage << clientCount;
 
-		// Send message reliably with TCP to *all clients
+		// Send message reliably with TCP to *all clients outside of a session
 		SendToAllConnections(clientCountMessage, ignoredClient);
+
+		// Session workers forward the count to their own clients
+		for (size_t workerIndex{ 0 }; workerIndex < m_SessionWorkers.size(); workerIndex++)
+		{
+			SessionHandoff handoff;
+			handoff.m_Type = SessionHandoffType::UpdateClientCount;
+			handoff.m_Client = ignoredClient;
+			handoff.m_ClientCount = clientCount;
+			if (m_SessionWorkers[workerIndex]->SubmitHandoff(std::move(handoff)))
+			{
+				m_WorkersToResume[workerIndex] = true;
+			}
+		}
 	}
 	void ServerNetworkThread::SendClientLeftMessage(ClientIndex receivingClient, SessionIndex removedClientSlot)
 	{
@@ -323,35 +226,56 @@ namespace Kargono::Network
 		// Send message reliably with TCP
 		SendToConnection(receivingClient, newMessage);
 	}
-	void ServerNetworkThread::SendUpdateLocationMessage(ClientIndex receivingClient, Message& msg)
+	void ServerNetworkThread::SendUpdateLocationToAllMessage(Session& session, ClientIndex ignoredClient, Message& msg)
 	{
 		// (Assuming the provided message already contains the location)
 
 		// Forward the client's location to all other clients
 		msg.m_Header.m_MessageType = MessageType::ManageSceneEntity_UpdateLocation;
 
-		// Send message quickly using UDP
-		SendToConnection(receivingClient, msg);
+		// Send message quickly using UDP to all other session clients
+		SendToSessionClients(session, msg, ignoredClient);
 	}
-	void ServerNetworkThread::SendUpdatePhysicsMessage(ClientIndex receivingClient, Message& msg)
+	void ServerNetworkThread::SendUpdatePhysicsToAllMessage(Session& session, ClientIndex ignoredClient, Message& msg)
 	{
 		// (Assuming the provided message already contains the physics data)
 
 		// Forward the client's physics data to all other clients
 		msg.m_Header.m_MessageType = MessageType::ManageSceneEntity_UpdatePhysics;
 
-		// Send message quickly using UDP
-		SendToConnection(receivingClient, msg);
+		// Send message quickly using UDP to all other session clients
+		SendToSessionClients(session, msg, ignoredClient);
 	}
-	void ServerNetworkThread::SendSignalMessage(ClientIndex receivingClient, Message& msg)
+	void ServerNetworkThread::SendSignalToAllMessage(Session& session, ClientIndex ignoredClient, Message& msg)
 	{
 		// (Assuming the provided message already contains the signal data)
 
 		// Forward the signal to all other clients
 		msg.m_Header.m_MessageType = MessageType::ScriptMessaging_ReceiveSignal;
 
-		// Send message reliably using TCP
-		SendToConnection(receivingClient, msg);
+		// Send message reliably using TCP to all other session clients
+		SendToSessionClients(session, msg, ignoredClient);
+	}
+	void ServerNetworkThread::SendKeepAliveToAllMessage(std::span<const ClientIndex> clients, bool includeCongested)
+	{
+		ClientIndex recipients[k_InvalidClientIndex];
+		size_t recipientCount{ 0 };
+
+		// Optionally skip congested connections
+		for (ClientIndex client : clients)
+		{
+			Connection& connection = m_AllConnections.GetConnection(client);
+			if (includeCongested || !connection.m_ReliabilityContext.m_CongestionContext.IsCongested())
+			{
+				recipients[recipientCount++] = client;
+			}
+		}
+
+		Message keepAliveMessage;
+		keepAliveMessage.m_Header.m_MessageType = MessageType::ManageConnection_KeepAlive;
+
+		// Send message quickly using UDP
+		SendToConnections(keepAliveMessage, recipients, recipientCount);
 	}
 	void ServerNetworkThread::SendKeepAliveMessage(ClientIndex receivingClient)
 	{
@@ -396,11 +320,6 @@ namespace Kargono::Network
 		SendToConnection(receivingClient, newMessage);
 	}
 
-	void ServerNetworkThread::StartSession()
-	{
-		// Use the current frame count
-		m_OnlySession.StartGameplay(m_ManageConnectionTimer.GetUpdateCount());
-	}
 	void ServerNotifiers::Init(std::atomic<bool>* serverActive)
 	{
 		KG_ASSERT(serverActive);
@@ -507,28 +426,8 @@ namespace Kargono::Network
 				std::chrono::nanoseconds(i_ServerConfig->m_ServerPassiveRefresh * 1'000'000));
 		}
 
+		// (Session workers already removed the client from its session before handing it back)
 		SendReceiveClientCountToAllMessage(client, m_AllConnections.GetNumberOfClients());
-
-		for (ClientIndex sessionClient : m_OnlySession.GetSessionClients())
-		{
-			if (sessionClient == client)
-			{
-				// Remove the client from the session
-				SessionIndex removedClientSlot = m_OnlySession.RemoveClient(client);
-
-				// Check if client removal failed
-				if (removedClientSlot == k_InvalidSessionIndex)
-				{
-					KG_WARN("Client disconnect failed. Could not remove a client from a session.");
-					return;
-				}
-
-				// Notify all other clients which client was removed
-				SendClientLeftMessageToAll(removedClientSlot);
-				break;
-			}
-		}
-
 	}
 
 	bool Server::Init(const ServerConfig& initConfig)
@@ -614,93 +513,127 @@ namespace Kargono::Network
 	{
 		if (m_ManageConnectionTimer.CheckForMultipleUpdates() > 0)
 		{
-			// Handle connection(s)
+			// Handle connection(s) outside of a session
 			HandleConnectionKeepAlive();
 			HandleConnectionTimeouts(m_ManageConnectionTimer.GetConstantFrameTimeFloat());
+
+			// Session workers manage their own connections on the same tick
+			std::fill(m_WorkersToResume.begin(), m_WorkersToResume.end(), true);
 		}
 		
 		// Process queues
 		m_FunctionQueue.ProcessQueue();
 		m_EventQueue.ProcessQueue();
 
-		Address sender;
-		unsigned char buffer[k_MaxPacketSize];
-		int bytesRead{ 0 };
+		// Take back clients returned by the session workers
+		while (std::optional<SessionHandoff> handoff = m_HandoffQueue.TryPop())
+		{
+			ProcessHandoff(*handoff);
+		}
 
+		// Drain the socket in batches of datagrams directly into the pooled message slabs
+		SocketDatagram datagrams[k_MaxDatagramBatchSize];
+		size_t datagramCount{ 0 };
 		do
 		{
-			bytesRead = i_ServerSocket->Receive(sender, buffer, sizeof(buffer));
-			if (bytesRead < k_PacketHeaderSize)
+			for (size_t index{ 0 }; index < k_MaxDatagramBatchSize; index++)
 			{
-				continue;
+				// Replace slabs that were handed off to a session worker
+				if (!m_ReceiveMessages[index].GetPacketPointer())
+				{
+					m_ReceiveMessages[index] = Message();
+				}
+				datagrams[index].m_Data = m_ReceiveMessages[index].GetPacketPointer();
+				datagrams[index].m_Capacity = (int)k_MaxPacketSize;
 			}
-			uint8_t* headerIterator{ buffer };
 
-			// Check for a valid app ID
-			AppID appID{ *(AppID*)headerIterator };
-			if (appID != i_ServerConfig->m_AppProtocolID)
+			datagramCount = i_ServerSocket->ReceiveBatch(datagrams, k_MaxDatagramBatchSize);
+			for (size_t index{ 0 }; index < datagramCount; index++)
 			{
-				KG_WARN("Failed to validate the app ID from packet");
-				continue;
+				ProcessPacket(datagrams[index].m_Address, m_ReceiveMessages[index], datagrams[index].m_Size);
 			}
-			headerIterator += sizeof(AppID);
-
-			// Get the packet type
-			MessageType type = *(MessageType*)headerIterator;
-			headerIterator += sizeof(MessageType);
+		} while (datagramCount == k_MaxDatagramBatchSize);
 
-			ClientIndex clientIndex = *(ClientIndex*)headerIterator;
-			headerIterator += sizeof(ClientIndex);
-
-			// Handle messages for already connected clients
-			if (m_AllConnections.IsConnectionActive(clientIndex))
+		// Wake the session workers that received work during this update
+		for (size_t workerIndex{ 0 }; workerIndex < m_SessionWorkers.size(); workerIndex++)
+		{
+			if (m_WorkersToResume[workerIndex])
 			{
-				if (IsConnectionManagementPacket(type))
-				{
-					continue;
-				}
+				m_SessionWorkers[workerIndex]->ResumeThread(false);
+				m_WorkersToResume[workerIndex] = false;
+			}
+		}
 
-				// Get the indicated connection
-				Connection& connection = m_AllConnections.GetConnection(clientIndex);
+		// Allow the thread to sleep if not managing connections
+		m_Thread.SuspendThread(true);
+	}
 
-				// Process packet reliability
-				bool packetAccepted = connection.m_ReliabilityContext.ProcessReliabilitySegmentFromPacket(headerIterator);
+	void ServerNetworkThread::ProcessPacket(const Address& sender, Message& msg, int bytesRead)
+	{
+		if (bytesRead < (int)k_PacketHeaderSize)
+		{
+			return;
+		}
+		uint8_t* headerIterator{ msg.GetPacketPointer() };
 
-				if (!packetAccepted)
-				{
-					continue;
-				}
+		// Check for a valid app ID
+		AppID appID{ *(AppID*)headerIterator };
+		if (appID != i_ServerConfig->m_AppProtocolID)
+		{
+			KG_WARN("Failed to validate the app ID from packet");
+			return;
+		}
+		headerIterator += sizeof(AppID);
 
-				for (AckData data : connection.m_ReliabilityContext.GetRecentAcks())
-				{
-					m_ReliabilityNotifiers.m_AckPacketNotifier.Notify(clientIndex, data.m_Sequence, data.m_RTT);
-				}
+		// Get the packet type
+		MessageType type = *(MessageType*)headerIterator;
+		headerIterator += sizeof(MessageType);
 
+		ClientIndex clientIndex = *(ClientIndex*)headerIterator;
+		headerIterator += sizeof(ClientIndex);
 
-				// Set up message
-				Message msg;
-				msg.m_Header.m_MessageType = type;
-				msg.m_Header.m_PayloadSize = (size_t)bytesRead - k_PacketHeaderSize;
-				KG_ASSERT(msg.m_Header.m_PayloadSize >= 0);
+		// Handle messages for already connected clients
+		if (m_AllConnections.IsConnectionActive(clientIndex))
+		{
+			if (IsConnectionManagementPacket(type))
+			{
+				return;
+			}
 
-				// Load in the payload
-				if (msg.m_Header.m_PayloadSize > 0)
+			// Set up message (payload is already in place after the header)
+			msg.m_Header.m_MessageType = type;
+			msg.m_Header.m_PayloadSize = (size_t)bytesRead - k_PacketHeaderSize;
+
+			// Forward packets for clients inside of a session to the session's worker
+			SessionID sessionID{ m_ClientSessions[clientIndex] };
+			if (sessionID != k_InvalidSessionID)
+			{
+				SessionHandoff handoff;
+				handoff.m_Type = SessionHandoffType::ReceivePacket;
+				handoff.m_Client = clientIndex;
+				handoff.m_SessionID = sessionID;
+				handoff.m_Packet = std::move(msg);
+				if (!GetSessionWorker(sessionID).SubmitHandoff(std::move(handoff)))
 				{
-					msg.m_PayloadData.resize(msg.m_Header.m_PayloadSize);
-					memcpy(msg.m_PayloadData.data(), buffer + k_PacketHeaderSize, msg.m_Header.m_PayloadSize);
+					// Treat as a dropped packet
+					KG_WARN("Dropped packet from client {}. The session worker's queue is full.", clientIndex);
 				}
-
-				OpenMessageFromClient(clientIndex, msg);
+				m_WorkersToResume[sessionID % m_SessionWorkers.size()] = true;
+				return;
 			}
-			else
+
+			// Process packet reliability
+			if (!ProcessReliabilitySegment(clientIndex, headerIterator))
 			{
-				HandleNewConnectionPacket(type, sender);
+				return;
 			}
-			
-		} while (bytesRead > 0);
 
-		// Allow the thread to sleep if not managing connections
-		m_Thread.SuspendThread(true);
+			OpenMessageFromClient(clientIndex, msg);
+		}
+		else
+		{
+			HandleNewConnectionPacket(type, sender);
+		}
 	}
 
 	bool ServerEventThread::Init(Socket* serverSocket, ServerNetworkThread* networkThread)
@@ -712,9 +645,8 @@ namespace Kargono::Network
 		i_ServerSocket = serverSocket;
 		i_NetworkThread = networkThread;
 
-		// Create network event
-		m_NetworkEventHandle = WSACreateEvent();
-		if (WSAEventSelect(i_ServerSocket->GetHandle(), m_NetworkEventHandle, FD_READ) != 0)
+		// Create the socket readiness and sync-ping timer event
+		if (!m_SocketEvent.Init(i_ServerSocket, m_ActiveSyncPingFreq))
 		{
 			KG_WARN("Failed to create the network event handle");
 			return false;
@@ -727,7 +659,10 @@ namespace Kargono::Network
 
 	void ServerEventThread::Terminate()
 	{
+		// Wake the thread if it is blocked waiting on the socket/timer
+		m_SocketEvent.Interrupt();
 		m_Thread.StopThread(false);
+		m_SocketEvent.Terminate();
 	}
 
 	void ServerEventThread::WaitOnThread()
@@ -740,62 +675,51 @@ namespace Kargono::Network
 		m_WorkQueue.SubmitFunction([&, frequency]() 
 		{
 			m_ActiveSyncPingFreq = frequency;
+			m_SocketEvent.SetTimerFrequency(frequency);
 		});
+
+		// Wake the thread so the new frequency is applied immediately
+		m_SocketEvent.Interrupt();
 	}
 
 	void ServerEventThread::RunThread()
 	{
 		m_WorkQueue.ProcessQueue();
 
-		DWORD waitResult = WaitForMultipleObjects
-		(
-			1, &m_NetworkEventHandle, 
-			FALSE, (DWORD)m_ActiveSyncPingFreq
-		);
-
-		if (waitResult == WAIT_OBJECT_0)
-		{
-			WSANETWORKEVENTS netEvents;
-			WSAEnumNetworkEvents(i_ServerSocket->GetHandle(), m_NetworkEventHandle, &netEvents);
-
-			if (netEvents.lNetworkEvents & FD_READ)
-			{
-				i_NetworkThread->ResumeThread(false);
-			}
-		}
-		else
+		// Block until the socket is readable or the sync-ping timer fires
+		switch (m_SocketEvent.WaitForEvent())
 		{
+		case SocketEventType::SocketReadable:
+		case SocketEventType::TimerExpired:
 			i_NetworkThread->ResumeThread(false);
+			break;
+		case SocketEventType::Interrupted:
+			// Process the work queue/exit on the next iteration
+			break;
+		case SocketEventType::None:
+		case SocketEventType::Failure:
+		default:
+			KG_WARN("Failed to wait on the server's network event handle");
+			i_NetworkThread->ResumeThread(false);
+			break;
 		}
 	}
 
 	void ServerNetworkThread::HandleConnectionTimeouts(float deltaTime)
 	{
-		// Add delta-time to last-packet-received time for all connections
+		// Add delta-time to last-packet-received time for all connections outside of a session
 		std::vector<ClientIndex> clientsToRemove;
-		ClientIndex index{ 0 };
-		for (Connection& connection : m_AllConnections.GetAllConnections())
+		for (ClientIndex index{ 0 }; index < (ClientIndex)m_AllConnections.GetAllConnections().size(); index++)
 		{
-			if (!m_AllConnections.IsConnectionActive(index))
+			if (!m_AllConnections.IsConnectionActive(index) || m_ClientSessions[index] != k_InvalidSessionID)
 			{
 				continue;
 			}
 
-			// Update reliability observers
-			ReliabilityContext& relContext{ connection.m_ReliabilityContext };
-			m_ReliabilityNotifiers.m_ReliabilityStateNotifier.Notify(
-				index,
-				relContext.m_CongestionContext.IsCongested(),
-				relContext.m_RoundTripContext.GetAverageRoundTrip()
-			);
-
-			relContext.OnUpdate(deltaTime);
-
-			if (relContext.m_LastPacketReceived > i_ServerConfig->m_ConnectionTimeout)
+			if (UpdateConnectionTimeout(index, deltaTime))
 			{
 				clientsToRemove.push_back(index);
 			}
-			index++;
 		}
 
 		// Remove timed-out connections
@@ -809,6 +733,40 @@ namespace Kargono::Network
 	}
 
 
+	bool ServerNetworkThread::UpdateConnectionTimeout(ClientIndex client, float deltaTime)
+	{
+		ReliabilityContext& relContext{ m_AllConnections.GetConnection(client).m_ReliabilityContext };
+
+		// Update reliability observers
+		m_ReliabilityNotifiers.m_ReliabilityStateNotifier.Notify(
+			client,
+			relContext.m_CongestionContext.IsCongested(),
+			relContext.m_RoundTripContext.GetAverageRoundTrip()
+		);
+
+		relContext.OnUpdate(deltaTime);
+
+		return relContext.m_LastPacketReceived > i_ServerConfig->m_ConnectionTimeout;
+	}
+
+	bool ServerNetworkThread::ProcessReliabilitySegment(ClientIndex client, uint8_t* reliabilitySegment)
+	{
+		Connection& connection = m_AllConnections.GetConnection(client);
+
+		// Process packet reliability
+		if (!connection.m_ReliabilityContext.ProcessReliabilitySegmentFromPacket(reliabilitySegment))
+		{
+			return false;
+		}
+
+		for (AckData data : connection.m_ReliabilityContext.GetRecentAcks())
+		{
+			m_ReliabilityNotifiers.m_AckPacketNotifier.Notify(client, data.m_Sequence, data.m_RTT);
+			connection.m_SnapshotSendContext.OnPacketAcked(data.m_Sequence);
+		}
+		return true;
+	}
+
 	bool ServerNetworkThread::Init(ServerConfig* serverConfig, Socket* serverSocket, std::atomic<bool>* serverActive, ServerEventThread* eventThread)
 	{
 		KG_ASSERT(serverConfig);
@@ -829,11 +787,19 @@ namespace Kargono::Network
 		// Set up work queues
 		m_EventQueue.Init(KG_BIND_CLASS_FN(OnEvent));
 
-		// Init connections
-		m_AllConnections = ConnectionList(64);
+		// Init connections (client indices are 8-bit, so the connection count is capped below k_InvalidClientIndex)
+		size_t maxConnections = std::clamp<size_t>(i_ServerConfig->m_MaxSessions * k_MaxSessionClients, 
+			64, k_InvalidClientIndex);
+		m_AllConnections = ConnectionList((ClientIndex)maxConnections);
+		m_ClientSessions.fill(k_InvalidSessionID);
+		m_HandoffQueue.Init(256);
 
-		// Init session
-		m_OnlySession.Init(this, &m_AllConnections);
+		// Init sessions and their worker threads
+		if (!InitSessions())
+		{
+			m_HandoffQueue.Terminate();
+			return false;
+		}
 
 		// Init timers
 		m_ManageConnectionTimer.InitializeTimer();
@@ -849,6 +815,119 @@ namespace Kargono::Network
 	void ServerNetworkThread::Terminate()
 	{
 		m_Thread.StopThread(false);
+
+		// Session workers may still submit handoffs until they are stopped
+		TerminateSessions();
+		m_HandoffQueue.Terminate();
+	}
+
+	bool ServerNetworkThread::InitSessions()
+	{
+		KG_ASSERT(i_ServerConfig);
+
+		size_t sessionCount{ i_ServerConfig->m_MaxSessions };
+		if (sessionCount == 0)
+		{
+			KG_WARN("Failed to initialize server sessions. The maximum session count must be at least one.");
+			return false;
+		}
+
+		// Leave room for the main thread and the network threads when choosing the worker count
+		size_t workerCount{ i_ServerConfig->m_SessionWorkerCount };
+		if (workerCount == 0)
+		{
+			size_t hardwareThreads{ (size_t)std::thread::hardware_concurrency() };
+			workerCount = hardwareThreads > 3 ? hardwareThreads - 2 : 1;
+		}
+		workerCount = std::min(workerCount, sessionCount);
+
+		// Create the session workers
+		m_SessionWorkers.clear();
+		for (size_t workerIndex{ 0 }; workerIndex < workerCount; workerIndex++)
+		{
+			m_SessionWorkers.push_back(CreateScope<ServerSessionWorker>());
+		}
+		m_WorkersToResume.assign(workerCount, false);
+
+		// Create the sessions (the vector may not reallocate after this point)
+		m_Sessions = std::vector<Session>(sessionCount);
+		m_SessionClientCounts.assign(sessionCount, 0);
+		for (SessionID sessionID{ 0 }; sessionID < (SessionID)sessionCount; sessionID++)
+		{
+			ServerSessionWorker& worker{ GetSessionWorker(sessionID) };
+			m_Sessions[sessionID].Init(sessionID, this, &worker, &m_AllConnections);
+			worker.AddSession(sessionID);
+		}
+
+		// Start the worker threads
+		for (Scope<ServerSessionWorker>& worker : m_SessionWorkers)
+		{
+			if (!worker->Init(i_ServerConfig, this, &m_AllConnections, &m_Sessions))
+			{
+				TerminateSessions();
+				return false;
+			}
+		}
+
+		KG_INFO("Hosting {} server sessions across {} worker threads", sessionCount, workerCount);
+		return true;
+	}
+
+	void ServerNetworkThread::TerminateSessions()
+	{
+		// Stop the worker threads before their sessions are destroyed
+		for (Scope<ServerSessionWorker>& worker : m_SessionWorkers)
+		{
+			worker->Terminate();
+		}
+		m_SessionWorkers.clear();
+		m_WorkersToResume.clear();
+		m_Sessions.clear();
+		m_SessionClientCounts.clear();
+	}
+
+	SessionID ServerNetworkThread::FindJoinableSession() const
+	{
+		// Fill partially occupied sessions first, so clients are matched together
+		SessionID emptySession{ k_InvalidSessionID };
+		for (SessionID sessionID{ 0 }; sessionID < (SessionID)m_SessionClientCounts.size(); sessionID++)
+		{
+			size_t clientCount{ m_SessionClientCounts[sessionID] };
+			if (clientCount > 0 && clientCount < k_MaxSessionClients)
+			{
+				return sessionID;
+			}
+
+			if (clientCount == 0 && emptySession == k_InvalidSessionID)
+			{
+				emptySession = sessionID;
+			}
+		}
+		return emptySession;
+	}
+
+	ServerSessionWorker& ServerNetworkThread::GetSessionWorker(SessionID sessionID)
+	{
+		KG_ASSERT(!m_SessionWorkers.empty());
+		return *m_SessionWorkers[sessionID % m_SessionWorkers.size()];
+	}
+
+	void ServerNetworkThread::ProcessHandoff(SessionHandoff& handoff)
+	{
+		KG_ASSERT(handoff.m_Client < m_ClientSessions.size());
+		KG_ASSERT(handoff.m_SessionID < m_SessionClientCounts.size());
+
+		// The network thread owns the client's connection again
+		m_ClientSessions[handoff.m_Client] = k_InvalidSessionID;
+		KG_ASSERT(m_SessionClientCounts[handoff.m_SessionID] > 0);
+		m_SessionClientCounts[handoff.m_SessionID]--;
+
+		// Disconnect clients that timed out inside of their session
+		if (handoff.m_Type == SessionHandoffType::TimeoutClient)
+		{
+			m_AllConnections.RemoveConnection(handoff.m_Client);
+			OnClientDisconnect(handoff.m_Client);
+		}
 	}
 
 	void ServerNetworkThread::WaitOnThread()
@@ -856,9 +935,9 @@ namespace Kargono::Network
 		m_Thread.WaitOnThread();
 	}
 
-	void ServerNetworkThread::SubmitFunction(const std::function<void()>& workFunction)
+	void ServerNetworkThread::SubmitFunction(FunctionQueue::Function workFunction)
 	{
-		m_FunctionQueue.SubmitFunction(workFunction);
+		m_FunctionQueue.SubmitFunction(std::move(workFunction));
 
 		m_Thread.ResumeThread(false);
 	}
@@ -870,25 +949,32 @@ namespace Kargono::Network
 		m_Thread.ResumeThread(false);
 	}
 
-	void ServerNetworkThread::OnEvent(Events::Event* event)
+	void ServerNetworkThread::SubmitHandoff(SessionHandoff&& handoff)
 	{
-		if (event->GetEventType() == Events::EventType::StartSession)
+		// Returned clients cannot be dropped, so wait for the network thread to make room
+		//		(each client has at most one handoff in flight, so this should not spin in practice)
+		while (!m_HandoffQueue.TryPush(std::move(handoff)))
 		{
-			StartSession();
+			m_Thread.ResumeThread(false);
+			std::this_thread::yield();
 		}
+
+		m_Thread.ResumeThread(false);
 	}
 
-	bool ServerNetworkThread::SendToConnection(ClientIndex clientIndex, Message& msg)
+	void ServerNetworkThread::OnEvent([[maybe_unused]] Events::Event* event)
+	{
+		// (Sessions start gameplay on their own worker thread, so no server events are handled here)
+	}
+
+	void ServerNetworkThread::WritePacketHeader(ClientIndex clientIndex, MessageType type, uint8_t* headerBuffer)
 	{
 		KG_ASSERT(m_AllConnections.IsConnectionActive(clientIndex));
-		KG_ASSERT(msg.m_Header.m_PayloadSize < k_MaxPayloadSize);
 
 		// Get the connection
 		Connection& connection = m_AllConnections.GetConnection(clientIndex);
 
-		// Prepare the final data buffer
-		uint8_t buffer[k_MaxPacketSize];
-		uint8_t* headerIterator{ buffer };
+		uint8_t* headerIterator{ headerBuffer };
 
 		// Set the app ID
 		AppID& appIDLocation = *(AppID*)headerIterator;
@@ -897,7 +983,7 @@ namespace Kargono::Network
 
 		// Set the packet type
 		MessageType& MessageTypeLocation = *(MessageType*)headerIterator;
-		MessageTypeLocation = msg.m_Header.m_MessageType;
+		MessageTypeLocation = type;
 		headerIterator += sizeof(MessageType);
 
 		// Send the client connection Index
@@ -906,7 +992,7 @@ namespace Kargono::Network
 		headerIterator += sizeof(ClientIndex);
 
 		// Optionally insert reliability segment
-		if (!IsConnectionManagementPacket(msg.m_Header.m_MessageType))
+		if (!IsConnectionManagementPacket(type))
 		{
 			// Insert the sequence number + ack + ack_bitfield
 			connection.m_ReliabilityContext.InsertReliabilitySegmentIntoPacket(headerIterator);
@@ -915,38 +1001,455 @@ namespace Kargono::Network
 			// Use send packet notifier
 			m_ReliabilityNotifiers.m_SendPacketNotifier.Notify(clientIndex, sentPacketSeq);
 		}
+	}
+
+	bool ServerNetworkThread::SendToConnection(ClientIndex clientIndex, Message& msg)
+	{
+		KG_ASSERT(msg.m_Header.m_PayloadSize < k_MaxPayloadSize);
+
+		// Write the header in-place in front of the message's payload
+		WritePacketHeader(clientIndex, msg.m_Header.m_MessageType, msg.GetPacketPointer());
 
-		// Optionally insert the payload
-		if (msg.m_Header.m_PayloadSize > 0)
+		Connection& connection = m_AllConnections.GetConnection(clientIndex);
+		i_ServerSocket->Send(connection.m_Address, msg.GetPacketPointer(), (int)msg.GetPacketSize());
+
+		return true;
+	}
+
+	bool ServerNetworkThread::SendToConnections(Message& msg, const ClientIndex* clients, size_t clientCount)
+	{
+		KG_ASSERT(msg.m_Header.m_PayloadSize < k_MaxPayloadSize);
+
+		// Only the header differs between connections. Every datagram references the message's
+		//		payload directly, so it is serialized once regardless of the number of recipients.
+		uint8_t headers[k_MaxDatagramBatchSize][k_PacketHeaderSize];
+		SocketDatagram datagrams[k_MaxDatagramBatchSize];
+		size_t datagramCount{ 0 };
+
+		for (size_t index{ 0 }; index < clientCount; index++)
 		{
-			// Set the data
-			memcpy(&buffer[k_PacketHeaderSize], msg.m_PayloadData.data(), msg.m_Header.m_PayloadSize);
+			ClientIndex clientIndex{ clients[index] };
+
+			// Patch the connection specific header bytes (client index + reliability segment)
+			WritePacketHeader(clientIndex, msg.m_Header.m_MessageType, headers[datagramCount]);
+
+			SocketDatagram& datagram{ datagrams[datagramCount] };
+			datagram.m_Address = m_AllConnections.GetConnection(clientIndex).m_Address;
+			datagram.m_Data = headers[datagramCount];
+			datagram.m_Size = (int)k_PacketHeaderSize;
+			datagram.m_SharedPayload = msg.GetPayloadPointer();
+			datagram.m_SharedPayloadSize = (int)msg.m_Header.m_PayloadSize;
+			datagramCount++;
+
+			// Flush a full batch
+			if (datagramCount == k_MaxDatagramBatchSize)
+			{
+				i_ServerSocket->SendBatch(datagrams, datagramCount);
+				datagramCount = 0;
+			}
 		}
 
-		i_ServerSocket->Send(connection.m_Address, buffer, msg.m_Header.m_PayloadSize + k_PacketHeaderSize);
+		// Flush the remaining packets
+		if (datagramCount > 0)
+		{
+			i_ServerSocket->SendBatch(datagrams, datagramCount);
+		}
 
 		return true;
 	}
 
 	bool ServerNetworkThread::SendToAllConnections(Message& msg, ClientIndex ignoreClient)
 	{
-		// Loop through all of the connections
+		ClientIndex recipients[k_InvalidClientIndex];
+		size_t recipientCount{ 0 };
+
+		// Loop through all of the connections owned by the network thread
 		ClientIndex currentIndex{ 0 };
-		for (Connection& connection : m_AllConnections.GetAllConnections())
+		for ([[maybe_unused]] Connection& connection : m_AllConnections.GetAllConnections())
 		{
-			if (currentIndex == ignoreClient || !m_AllConnections.IsConnectionActive(currentIndex))
+			if (currentIndex != ignoreClient && m_AllConnections.IsConnectionActive(currentIndex) &&
+				m_ClientSessions[currentIndex] == k_InvalidSessionID)
 			{
-				currentIndex++;
-				continue;
+				recipients[recipientCount++] = currentIndex;
 			}
-
-			SendToConnection(currentIndex, msg);
 			currentIndex++;
 		}
 
+		return SendToConnections(msg, recipients, recipientCount);
+	}
+
+	bool ServerNetworkThread::SendToSessionClients(Session& session, Message& msg, ClientIndex ignoreClient)
+	{
+		ClientIndex recipients[k_MaxSessionClients];
+		size_t recipientCount{ 0 };
+
+		// Loop through all of the session's clients
+		for (ClientIndex sessionClient : session.GetSessionClients())
+		{
+			if (sessionClient != ignoreClient)
+			{
+				recipients[recipientCount++] = sessionClient;
+			}
+		}
+
+		return SendToConnections(msg, recipients, recipientCount);
+	}
+
+	bool ServerSessionWorker::Init(ServerConfig* serverConfig, ServerNetworkThread* networkThread, 
+		ConnectionList* connectionList, std::vector<Session>* sessions)
+	{
+		KG_ASSERT(serverConfig);
+		KG_ASSERT(networkThread);
+		KG_ASSERT(connectionList);
+		KG_ASSERT(sessions);
+
+		// Store dependencies
+		i_ServerConfig = serverConfig;
+		i_NetworkThread = networkThread;
+		i_ConnectionList = connectionList;
+		i_Sessions = sessions;
+
+		// Set up work queues
+		m_HandoffQueue.Init(1024);
+
+		// Init timers
+		m_ManageConnectionTimer.InitializeTimer();
+		m_ManageConnectionTimer.SetConstantFrameTime(
+			std::chrono::nanoseconds(i_ServerConfig->m_ServerActiveRefresh * 1'000'000));
+
+		// Start thread
+		m_Thread.StartThread(KG_BIND_CLASS_FN(RunThread));
+
 		return true;
 	}
 
+	void ServerSessionWorker::Terminate()
+	{
+		m_Thread.StopThread(false);
+		m_HandoffQueue.Terminate();
+	}
+
+	void ServerSessionWorker::AddSession(SessionID sessionID)
+	{
+		m_SessionIDs.push_back(sessionID);
+	}
+
+	bool ServerSessionWorker::SubmitHandoff(SessionHandoff&& handoff)
+	{
+		return m_HandoffQueue.TryPush(std::move(handoff));
+	}
+
+	void ServerSessionWorker::SubmitFunction(FunctionQueue::Function workFunction)
+	{
+		m_FunctionQueue.SubmitFunction(std::move(workFunction));
+
+		m_Thread.ResumeThread(false);
+	}
+
+	void ServerSessionWorker::ResumeThread(bool withinThread)
+	{
+		m_Thread.ResumeThread(withinThread);
+	}
+
+	void ServerSessionWorker::RunThread()
+	{
+		if (m_ManageConnectionTimer.CheckForMultipleUpdates() > 0)
+		{
+			// Handle the connection(s) of this worker's sessions
+			HandleConnectionKeepAlive();
+			HandleConnectionTimeouts(m_ManageConnectionTimer.GetConstantFrameTimeFloat());
+
+			// Resend snapshots until clients acknowledge the latest entity state
+			for (SessionID sessionID : m_SessionIDs)
+			{
+				SendUpdateSnapshotToAllMessage((*i_Sessions)[sessionID], true);
+			}
+		}
+
+		// Process queues
+		m_FunctionQueue.ProcessQueue();
+		while (std::optional<SessionHandoff> handoff = m_HandoffQueue.TryPop())
+		{
+			ProcessHandoff(*handoff);
+		}
+
+		// Relay entity changes from the processed packets in a single snapshot per client
+		for (SessionID sessionID : m_SessionIDs)
+		{
+			Session& session{ (*i_Sessions)[sessionID] };
+			if (session.PollReplicatedEntitiesChanged())
+			{
+				SendUpdateSnapshotToAllMessage(session, false);
+			}
+		}
+
+		// Sleep until the network thread forwards more work
+		m_Thread.SuspendThread(true);
+	}
+
+	void ServerSessionWorker::ProcessHandoff(SessionHandoff& handoff)
+	{
+		switch (handoff.m_Type)
+		{
+		case SessionHandoffType::ReceivePacket:
+		{
+			KG_ASSERT(handoff.m_Packet);
+			Session& session{ (*i_Sessions)[handoff.m_SessionID] };
+
+			// Ignore packets that were queued before the client left the session
+			if (session.ContainsClient(handoff.m_Client))
+			{
+				ProcessPacket(session, handoff.m_Client, *handoff.m_Packet);
+			}
+			break;
+		}
+		case SessionHandoffType::JoinSession:
+			m_ClientCount = handoff.m_ClientCount;
+			OnClientJoinSession((*i_Sessions)[handoff.m_SessionID], handoff.m_Client);
+			break;
+		case SessionHandoffType::UpdateClientCount:
+		{
+			m_ClientCount = handoff.m_ClientCount;
+
+			// Update the client count for all session clients (except the ignored one)
+			Message clientCountMessage;
+			clientCountMessage.m_Header.m_MessageType = MessageType::ServerQuery_ReceiveClientCount;
+			clientCountMessage << m_ClientCount;
+			for (SessionID sessionID : m_SessionIDs)
+			{
+				i_NetworkThread->SendToSessionClients((*i_Sessions)[sessionID], clientCountMessage, handoff.m_Client);
+			}
+			break;
+		}
+		default:
+			KG_ERROR("Invalid handoff type provided to session worker");
+			break;
+		}
+	}
+
+	void ServerSessionWorker::ProcessPacket(Session& session, ClientIndex client, Message& msg)
+	{
+		// Process packet reliability
+		uint8_t* reliabilitySegment{ msg.GetPacketPointer() + sizeof(AppID) + sizeof(MessageType) + sizeof(ClientIndex) };
+		if (!i_NetworkThread->ProcessReliabilitySegment(client, reliabilitySegment))
+		{
+			return;
+		}
+
+		OpenMessageFromClient(session, client, msg);
+	}
+
+	void ServerSessionWorker::OnClientJoinSession(Session& session, ClientIndex newClient)
+	{
+		// Add client to session and ensure slot is valid
+		SessionIndex clientSlot = session.AddClient(newClient);
+		if (clientSlot == k_InvalidSessionIndex)
+		{
+			i_NetworkThread->SendDenyClientJoinMessage(newClient);
+			ReturnClient(session, newClient, SessionHandoffType::LeaveSession);
+			return;
+		}
+
+		// Send approval message to the new client
+		i_NetworkThread->SendApproveClientJoinMessage(newClient, clientSlot);
+
+		// Send the session's current entity state to the new client
+		SendUpdateSnapshotMessage(session, newClient);
+
+		// Notify all other session clients that new client has been added
+		for (SessionIndex sessionIndex : session.GetSessionClients().GetActiveIndices())
+		{
+			ClientIndex sessionClient{ session.GetClient(sessionIndex) };
+
+			// Skip the current client (it already knows from approval)
+			if (newClient == sessionClient)
+			{
+				continue;
+			}
+
+			// Update existing client about new addition
+			i_NetworkThread->SendUpdateClientSlotMessage(sessionClient, clientSlot);
+
+			// Update new client about other session clients
+			i_NetworkThread->SendUpdateClientSlotMessage(newClient, sessionIndex);
+		}
+
+		// If enough clients are connected, start the session
+		if (session.GetClientCount() == k_MaxSessionClients)
+		{
+			// TODO: Probably should expose this to the scripts instead of automatically starting the session
+			session.CreateSession();
+		}
+	}
+
+	void ServerSessionWorker::ReturnClient(Session& session, ClientIndex client, SessionHandoffType type)
+	{
+		// Remove the client from the session
+		SessionIndex removedClientSlot = session.RemoveClient(client);
+		if (removedClientSlot != k_InvalidSessionIndex)
+		{
+			// Notify all other session clients which client was removed
+			i_NetworkThread->SendClientLeftMessageToAll(session, removedClientSlot);
+
+			// Notify the removed client it is removed 
+			// (note this is necessary since the client no longer exists in the session list)
+			if (type == SessionHandoffType::LeaveSession)
+			{
+				i_NetworkThread->SendClientLeftMessage(client, removedClientSlot);
+			}
+		}
+
+		// Reset the session once all clients have left
+		if (session.GetClientCount() == 0)
+		{
+			session.EndGameplay();
+		}
+
+		// The connection must not be accessed by this worker after this point
+		SessionHandoff handoff;
+		handoff.m_Type = type;
+		handoff.m_Client = client;
+		handoff.m_SessionID = session.GetSessionID();
+		i_NetworkThread->SubmitHandoff(std::move(handoff));
+	}
+
+	void ServerSessionWorker::HandleConnectionKeepAlive()
+	{
+		ClientIndex recipients[k_InvalidClientIndex];
+		size_t recipientCount{ 0 };
+		for (SessionID sessionID : m_SessionIDs)
+		{
+			for (ClientIndex sessionClient : (*i_Sessions)[sessionID].GetSessionClients())
+			{
+				recipients[recipientCount++] = sessionClient;
+			}
+		}
+
+		// Congested connections only receive every third keep-alive
+		i_NetworkThread->SendKeepAliveToAllMessage({ recipients, recipientCount }, m_CongestionCounter % 3 == 0);
+		m_CongestionCounter++;
+	}
+
+	void ServerSessionWorker::HandleConnectionTimeouts(float deltaTime)
+	{
+		for (SessionID sessionID : m_SessionIDs)
+		{
+			Session& session{ (*i_Sessions)[sessionID] };
+
+			// Add delta-time to last-packet-received time for all session connections
+			ClientIndex clientsToRemove[k_MaxSessionClients];
+			size_t removeCount{ 0 };
+			for (ClientIndex sessionClient : session.GetSessionClients())
+			{
+				if (i_NetworkThread->UpdateConnectionTimeout(sessionClient, deltaTime))
+				{
+					clientsToRemove[removeCount++] = sessionClient;
+				}
+			}
+
+			// Hand timed-out connections back to the network thread to be removed
+			for (size_t index{ 0 }; index < removeCount; index++)
+			{
+				ReturnClient(session, clientsToRemove[index], SessionHandoffType::TimeoutClient);
+			}
+		}
+	}
+
+	void ServerSessionWorker::OpenMessageFromClient(Session& session, ClientIndex client, Message& msg)
+	{
+		// Handle messages from session clients based on their type
+		switch (msg.m_Header.m_MessageType)
+		{
+		case MessageType::ManageSession_RequestClientJoin:
+			// Client is already inside of a session
+			i_NetworkThread->SendDenyClientJoinMessage(client);
+			break;
+		case MessageType::ServerQuery_RequestClientCount:
+			i_NetworkThread->SendReceiveClientCountMessage(client, m_ClientCount);
+			break;
+		case MessageType::ManageSession_NotifyAllLeave:
+			OpenNotifyAllLeaveMessage(session, client);
+			break;
+		case MessageType::ManageSession_StartReadyCheck:
+			session.StoreClientReady(client);
+			break;
+		case MessageType::ManageSession_EnableReadyCheck:
+			session.StartReadyCheck();
+			break;
+		case MessageType::ManageSceneEntity_SendAllClientsLocation:
+			// Forward entity location to all other clients (excluding the original client)
+			i_NetworkThread->SendUpdateLocationToAllMessage(session, client, msg);
+			break;
+		case MessageType::ManageSceneEntity_SendAllClientsPhysics:
+			// Forward entity Physics to all other clients (excluding the original client)
+			i_NetworkThread->SendUpdatePhysicsToAllMessage(session, client, msg);
+			break;
+		case MessageType::ScriptMessaging_SendAllClientsSignal:
+			// Forward signal to all other session clients (excluding the original client)
+			i_NetworkThread->SendSignalToAllMessage(session, client, msg);
+			break;
+		case MessageType::ManageSceneEntity_SendAllClientsSnapshot:
+			OpenSendAllClientsSnapshotMessage(session, client, msg);
+			break;
+		case MessageType::ManageConnection_KeepAlive:
+			break;
+		default:
+			KG_ERROR("Invalid message type sent to server");
+			break;
+		}
+	}
+
+	void ServerSessionWorker::OpenNotifyAllLeaveMessage(Session& session, ClientIndex client)
+	{
+		KG_INFO("[{}]: User Leaving Session {}", client, session.GetSessionID());
+
+		// Remove the client and hand it back to the network thread
+		ReturnClient(session, client, SessionHandoffType::LeaveSession);
+	}
+
+	void ServerSessionWorker::OpenSendAllClientsSnapshotMessage(Session& session, ClientIndex client, Message& msg)
+	{
+		// Decode the snapshot (always, so the receive history stays usable as a baseline)
+		Connection& connection = i_ConnectionList->GetConnection(client);
+		if (!connection.m_SnapshotReceiveContext.ReadSnapshot(msg, m_SnapshotEntities))
+		{
+			KG_WARN("[{}]: Failed to read entity snapshot", client);
+			return;
+		}
+
+		// Store the client's newest entity state. Snapshots are relayed to the other clients 
+		// once the worker's queued packets are processed.
+		session.UpdateClientEntities(client, connection.m_SnapshotReceiveContext.GetLatestEntities());
+	}
+
+	void ServerSessionWorker::SendUpdateSnapshotMessage(Session& session, ClientIndex receivingClient)
+	{
+		// Delta-encode all session entities not owned by the receiving client
+		Connection& connection = i_ConnectionList->GetConnection(receivingClient);
+		session.GetEntitiesForClient(receivingClient, m_SnapshotEntities);
+
+		Message snapshotMessage;
+		snapshotMessage.m_Header.m_MessageType = MessageType::ManageSceneEntity_UpdateSnapshot;
+		connection.m_SnapshotSendContext.WriteSnapshot(m_SnapshotEntities,
+			connection.m_ReliabilityContext.GetLocalSequence(), snapshotMessage);
+
+		// Send message quickly using UDP
+		i_NetworkThread->SendToConnection(receivingClient, snapshotMessage);
+	}
+
+	void ServerSessionWorker::SendUpdateSnapshotToAllMessage(Session& session, bool onlyPendingClients)
+	{
+		for (ClientIndex sessionClient : session.GetSessionClients())
+		{
+			Connection& connection = i_ConnectionList->GetConnection(sessionClient);
+			if (onlyPendingClients && !connection.m_SnapshotSendContext.HasPendingChanges())
+			{
+				continue;
+			}
+			SendUpdateSnapshotMessage(session, sessionClient);
+		}
+	}
+
 	bool ServerService::Init()
 	{
 		if (s_Server.m_ServerActive)
@@ -997,11 +1500,11 @@ namespace Kargono::Network
 	{
 		return s_Server;
 	}
-	void ServerService::SubmitToNetworkFunctionQueue(const std::function<void()>& func)
+	void ServerService::SubmitToNetworkFunctionQueue(FunctionQueue::Function func)
 	{
 		KG_ASSERT(s_Server.m_ServerActive);
 
-		s_Server.GetNetworkThread().SubmitFunction(func);	
+		s_Server.GetNetworkThread().SubmitFunction(std::move(func));	
 	}
 	void ServerService::SubmitToNetworkEventQueue(Ref<Events::Event> event)
 	{
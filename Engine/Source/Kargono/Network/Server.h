@@ -16,13 +16,45 @@
 #include "Kargono/Events/KeyEvent.h"
 #include "Kargono/Core/Notifier.h"
 #include "Kargono/Core/FunctionQueue.h"
+#include "Kargono/Core/DataStructures.h"
+
+#include <optional>
+#include <vector>
+#include <array>
+#include <span>
 
 namespace Kargono::Network
 {
 	// Forward declarations
 	class ServerEventThread;
+	class ServerSessionWorker;
 	class Session;
 
+	enum class SessionHandoffType : uint8_t
+	{
+		None = 0,
+		// Network thread -> session worker
+		ReceivePacket,
+		JoinSession,
+		UpdateClientCount,
+		// Session worker -> network thread
+		LeaveSession,
+		TimeoutClient
+	};
+
+	// Transfers packets and connection ownership between the network thread and the session workers.
+	//		A connection is only accessed by the thread that currently owns it: the network thread
+	//		while the client is outside of a session, otherwise the worker hosting the session.
+	struct SessionHandoff
+	{
+		SessionHandoffType m_Type{ SessionHandoffType::None };
+		ClientIndex m_Client{ k_InvalidClientIndex };
+		SessionID m_SessionID{ k_InvalidSessionID };
+		size_t m_ClientCount{ 0 };
+		// Only used for received packets
+		std::optional<Message> m_Packet{};
+	};
+
 	class ServerNotifiers
 	{
 	public:
@@ -109,9 +141,12 @@ namespace Kargono::Network
 		//==============================
 		// Job Queue
 		//==============================
-		void SubmitFunction(const std::function<void()>& workFunction);
+		void SubmitFunction(FunctionQueue::Function workFunction);
 		void SubmitEvent(Ref<Events::Event> event);
 
+		// Hand a client back from a session worker (safe to call from any thread)
+		void SubmitHandoff(SessionHandoff&& handoff);
+
 	private:
 		void OnEvent(Events::Event* event);
 
@@ -136,14 +171,21 @@ namespace Kargono::Network
 
 	private:
 		//==============================
-		// Manage Session
+		// Manage Sessions
 		//==============================
-		void StartSession();
+		bool InitSessions();
+		void TerminateSessions();
+		// Returns a session with an open slot, preferring partially filled sessions
+		SessionID FindJoinableSession() const;
+		ServerSessionWorker& GetSessionWorker(SessionID sessionID);
+		void ProcessHandoff(SessionHandoff& handoff);
 
 		//==============================
 		// Thread Work Functions
 		//==============================
 		void RunThread();
+		// Validate and dispatch a single received datagram
+		void ProcessPacket(const Address& sender, Message& msg, int bytesRead);
 
 		//==============================
 		// Manage Clients Connections
@@ -154,6 +196,12 @@ namespace Kargono::Network
 		void HandleConnectionKeepAlive();
 		void HandleNewConnectionPacket(MessageType type, Address address);
 		void HandleConnectionTimeouts(float deltaTime);
+		// Connection helpers that only access the indicated connection. Session workers use 
+		//		these for the connections they own.
+		// Update the connection's reliability state and return true if it timed out
+		bool UpdateConnectionTimeout(ClientIndex client, float deltaTime);
+		// Process a received packet's reliability segment and return true if the packet is accepted
+		bool ProcessReliabilitySegment(ClientIndex client, uint8_t* reliabilitySegment);
 
 	private:
 		//==============================
@@ -165,21 +213,22 @@ namespace Kargono::Network
 		void OpenRequestClientJoinMessage(ClientIndex client, Message& msg);
 		void OpenRequestClientCountMessage(ClientIndex client);
 		void OpenNotifyAllLeaveMessage(ClientIndex client);
-		void OpenStartReadyCheckMessage(ClientIndex client);
-		void OpenEnableReadyCheckMessage();
-		void OpenSendAllClientsLocationMessage(ClientIndex client, Message& msg);
-		void OpenSendAllClientsPhysicsMessage(ClientIndex client, Message& msg);
-		void OpenSendAllClientsSignalMessage(ClientIndex client, Message& msg);
 
 		//==============================
 		// Send Messages
 		//==============================
-		// Send message to client(s)
+		// Write the indicated client's packet header (k_PacketHeaderSize bytes) into headerBuffer
+		void WritePacketHeader(ClientIndex clientIndex, MessageType type, uint8_t* headerBuffer);
+		// Send message to client(s). These only access the receiving connections, so session 
+		//		workers may call them for the connections they own.
 		bool SendToConnection(ClientIndex clientIndex, Message& msg);
+		bool SendToConnections(Message& msg, const ClientIndex* clients, size_t clientCount);
+		// Send to all connections owned by the network thread (clients outside of a session)
 		bool SendToAllConnections(Message& msg, ClientIndex ignoreClient = k_InvalidClientIndex);
+		bool SendToSessionClients(Session& session, Message& msg, ClientIndex ignoreClient = k_InvalidClientIndex);
 
 		// Handle specific message types
-		void SendClientLeftMessageToAll(SessionIndex removedClientSlot);
+		void SendClientLeftMessageToAll(Session& session, SessionIndex removedClientSlot);
 		void SendServerPingMessage(ClientIndex client, Message& msg);
 		void SendDenyClientJoinMessage(ClientIndex receivingClient);
 		void SendApproveClientJoinMessage(ClientIndex receivingClient, SessionIndex clientSlot);
@@ -188,10 +237,12 @@ namespace Kargono::Network
 		void SendReceiveClientCountToAllMessage(ClientIndex receivingClient, size_t clientCount);
 		void SendClientLeftMessage(ClientIndex receivingClient, SessionIndex removedClientSlot);
 		void SendConfirmReadyCheckMessage(ClientIndex receivingClient, float waitTime);
-		void SendUpdateLocationMessage(ClientIndex receivingClient, Message& msg);
-		void SendUpdatePhysicsMessage(ClientIndex receivingClient, Message& msg);
-		void SendSignalMessage(ClientIndex receivingClient, Message& msg);
+		void SendUpdateLocationToAllMessage(Session& session, ClientIndex ignoredClient, Message& msg);
+		void SendUpdatePhysicsToAllMessage(Session& session, ClientIndex ignoredClient, Message& msg);
+		void SendSignalToAllMessage(Session& session, ClientIndex ignoredClient, Message& msg);
 		void SendKeepAliveMessage(ClientIndex receivingClient);
+		// Congested clients are skipped unless includeCongested is set
+		void SendKeepAliveToAllMessage(std::span<const ClientIndex> clients, bool includeCongested);
 		void SendAcceptConnectionMessage(ClientIndex receivingClient, size_t clientCount);
 		void SendSessionInitMessage(ClientIndex receivingClient);
 		void SendStartSessionMessage(ClientIndex receivingClient, float waitTime);
@@ -209,11 +260,22 @@ namespace Kargono::Network
 		ReliabilityContextNotifiers m_ReliabilityNotifiers{};
 		// Connections
 		ConnectionList m_AllConnections{};
+		// Session hosting each connection (k_InvalidSessionID if owned by the network thread)
+		std::array<SessionID, k_InvalidClientIndex> m_ClientSessions{};
+		// Pooled messages the socket is drained into
+		std::array<Message, k_MaxDatagramBatchSize> m_ReceiveMessages{};
+		// Reused buffer for decoding entity snapshots from clients outside of a session
+		std::vector<QuantizedEntityState> m_SnapshotEntities{};
 		// Timers
 		Utility::LoopTimer m_ManageConnectionTimer{};
 		uint32_t m_CongestionCounter{ 0 };
-		// Sessions
-		Session m_OnlySession{};
+		// Sessions (session N is hosted by worker N % worker count)
+		std::vector<Session> m_Sessions{};
+		std::vector<size_t> m_SessionClientCounts{};
+		std::vector<Scope<ServerSessionWorker>> m_SessionWorkers{};
+		std::vector<bool> m_WorkersToResume{};
+		// Clients handed back from the session workers
+		BoundedMPSCQueue<SessionHandoff> m_HandoffQueue{};
 		
 		//==============================
 		// Injected Dependencies
@@ -224,6 +286,107 @@ namespace Kargono::Network
 		ServerEventThread* i_EventThread{ nullptr };
 	private:
 		friend class Session;
+		friend class ServerSessionWorker;
+	};
+
+	class ServerSessionWorker
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		ServerSessionWorker() = default;
+		~ServerSessionWorker() = default;
+	public:
+		//==============================
+		// Lifecycle Functions
+		//==============================
+		bool Init
+		(
+			ServerConfig* serverConfig,
+			ServerNetworkThread* networkThread,
+			ConnectionList* connectionList,
+			std::vector<Session>* sessions
+		);
+		void Terminate();
+		// Assign a session to this worker (before Init)
+		void AddSession(SessionID sessionID);
+
+		//==============================
+		// Work Queues
+		//==============================
+		// Does not wake the worker. Returns false if the handoff queue is full.
+		bool SubmitHandoff(SessionHandoff&& handoff);
+		void SubmitFunction(FunctionQueue::Function workFunction);
+
+		//==============================
+		// Manage Thread
+		//==============================
+		void ResumeThread(bool withinThread);
+
+		//==============================
+		// Getters/Setters
+		//==============================
+		UpdateCount GetUpdateCount()
+		{
+			return m_ManageConnectionTimer.GetUpdateCount();
+		}
+	private:
+		//==============================
+		// Thread Work Functions
+		//==============================
+		void RunThread();
+		void ProcessHandoff(SessionHandoff& handoff);
+		void ProcessPacket(Session& session, ClientIndex client, Message& msg);
+
+		//==============================
+		// Manage Session Clients
+		//==============================
+		void OnClientJoinSession(Session& session, ClientIndex client);
+		// Remove the client from its session and hand its connection back to the network thread
+		void ReturnClient(Session& session, ClientIndex client, SessionHandoffType type);
+		void HandleConnectionKeepAlive();
+		void HandleConnectionTimeouts(float deltaTime);
+
+		//==============================
+		// Receive Messages
+		//==============================
+		void OpenMessageFromClient(Session& session, ClientIndex client, Message& msg);
+		void OpenNotifyAllLeaveMessage(Session& session, ClientIndex client);
+		void OpenSendAllClientsSnapshotMessage(Session& session, ClientIndex client, Message& msg);
+
+		//==============================
+		// Send Messages
+		//==============================
+		void SendUpdateSnapshotMessage(Session& session, ClientIndex receivingClient);
+		// Send entity snapshots to session clients (optionally only those with unacknowledged changes)
+		void SendUpdateSnapshotToAllMessage(Session& session, bool onlyPendingClients);
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		// Thread
+		KGThread m_Thread{};
+		// Thread queues
+		FunctionQueue m_FunctionQueue{};
+		BoundedMPSCQueue<SessionHandoff> m_HandoffQueue{};
+		// Timers
+		Utility::LoopTimer m_ManageConnectionTimer{};
+		uint32_t m_CongestionCounter{ 0 };
+		// Sessions hosted by this worker
+		std::vector<SessionID> m_SessionIDs{};
+		// Latest server-wide client count
+		size_t m_ClientCount{ 0 };
+		// Reused buffer for decoding/encoding entity snapshots
+		std::vector<QuantizedEntityState> m_SnapshotEntities{};
+
+		//==============================
+		// Injected Dependencies
+		//==============================
+		ServerConfig* i_ServerConfig{ nullptr };
+		ServerNetworkThread* i_NetworkThread{ nullptr };
+		ConnectionList* i_ConnectionList{ nullptr };
+		std::vector<Session>* i_Sessions{ nullptr };
 	};
 
 	class ServerEventThread
@@ -252,8 +415,8 @@ namespace Kargono::Network
 		// Thread context and queues
 		KGThread m_Thread{};
 		FunctionQueue m_WorkQueue{};
-		// OS handles
-		HANDLE m_NetworkEventHandle{};
+		// OS socket readiness/timer events
+		SocketEvent m_SocketEvent{};
 		// Config
 		size_t m_ActiveSyncPingFreq{ 1'000 /*1 sec*/};
 
@@ -337,7 +500,7 @@ namespace Kargono::Network
 		//==============================
 		// Submit Server Events 
 		//==============================
-		static void SubmitToNetworkFunctionQueue(const std::function<void()>& func);
+		static void SubmitToNetworkFunctionQueue(FunctionQueue::Function func);
 		static void SubmitToNetworkEventQueue(Ref<Events::Event> event);
 
 	private:
@@ -23,6 +23,9 @@ namespace Kargono::Network
 		size_t m_ServerActiveRefresh{ 50 /*50ms*/ };
 		size_t m_ServerPassiveRefresh{ 1'000 /*1s*/ };
 		float m_RequestConnectionFrequency{ 1.0f /*1s*/ };
+		// Sessions
+		size_t m_MaxSessions{ 32 };
+		size_t m_SessionWorkerCount{ 0 /*0 = Use available hardware threads*/ };
 		// Validation
 		Math::u64vec4 m_ValidationSecrets{ 0 };
 	};
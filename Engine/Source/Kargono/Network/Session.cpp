@@ -7,20 +7,25 @@
 
 namespace Kargono::Network
 {
-	void Session::Init(ServerNetworkThread* networkThread, ConnectionList* parentConnectionList)
+	void Session::Init(SessionID sessionID, ServerNetworkThread* networkThread, 
+		ServerSessionWorker* sessionWorker, ConnectionList* parentConnectionList)
 	{
+		KG_ASSERT(sessionID != k_InvalidSessionID);
 		KG_ASSERT(parentConnectionList);
 		KG_ASSERT(networkThread);
+		KG_ASSERT(sessionWorker);
 
 		// Set up dependencies
+		m_SessionID = sessionID;
 		i_ConnectionList = parentConnectionList;
 		i_NetworkThread = networkThread;
+		i_SessionWorker = sessionWorker;
 
 		m_Active = true;
 	}
 	void Session::CreateSession()
 	{
-		KG_INFO("[SERVER]: Initializing Session...");
+		KG_INFO("[SERVER]: Initializing Session {}...", m_SessionID);
 
 		// Notify clients that session initialization has started
 		for (ClientIndex sessionClient : m_ActiveClients)
@@ -42,11 +47,13 @@ namespace Kargono::Network
 			i_NetworkThread->SendStartSessionMessage(sessionClient, waitTime);
 		}
 
-		// Set up timer to start session gameplay
+		// Set up timer to start session gameplay on the worker hosting this session
 		Utility::AsyncBusyTimer::CreateTimer(longestRTT, [&]()
 		{
-			// Start Thread
-			ServerService::SubmitToNetworkEventQueue(CreateRef<Events::StartSession>());
+			i_SessionWorker->SubmitFunction([&]()
+			{
+				StartGameplay(i_SessionWorker->GetUpdateCount());
+			});
 		});
 	}
 
@@ -170,14 +177,71 @@ namespace Kargono::Network
 			}
 		}
 
-		// Remove the client if it was found
+		// Remove the client and its replicated entities if it was found
 		if (indexToRemove != k_InvalidSessionIndex)
 		{
 			m_ActiveClients.Remove(indexToRemove);
+			UpdateClientEntities(queryClient, {});
 		}
 
 		return indexToRemove;
 	}
+	bool Session::ContainsClient(ClientIndex queryClient)
+	{
+		for (ClientIndex sessionClient : m_ActiveClients)
+		{
+			if (sessionClient == queryClient)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	void Session::UpdateClientEntities(ClientIndex owner, std::span<const QuantizedEntityState> entities)
+	{
+		// Remove the owner's previous entities
+		size_t previousSize{ m_ReplicatedEntities.size() };
+		std::erase_if(m_ReplicatedEntities, [owner](const ReplicatedEntity& entity)
+		{
+			return entity.m_Owner == owner;
+		});
+
+		if (entities.empty() && previousSize == m_ReplicatedEntities.size())
+		{
+			return;
+		}
+
+		// Insert the new entities and restore the ID ordering
+		for (const QuantizedEntityState& state : entities)
+		{
+			m_ReplicatedEntities.push_back({ owner, state });
+		}
+		std::sort(m_ReplicatedEntities.begin(), m_ReplicatedEntities.end(), 
+			[](const ReplicatedEntity& a, const ReplicatedEntity& b)
+		{
+			return a.m_State.m_EntityID < b.m_State.m_EntityID;
+		});
+
+		m_ReplicatedEntitiesChanged = true;
+	}
+	void Session::GetEntitiesForClient(ClientIndex recipient, std::vector<QuantizedEntityState>& outEntities) const
+	{
+		outEntities.clear();
+		for (const ReplicatedEntity& entity : m_ReplicatedEntities)
+		{
+			// Clients are authoritative over their own entities
+			if (entity.m_Owner != recipient)
+			{
+				outEntities.push_back(entity.m_State);
+			}
+		}
+	}
+	bool Session::PollReplicatedEntitiesChanged()
+	{
+		bool changed{ m_ReplicatedEntitiesChanged };
+		m_ReplicatedEntitiesChanged = false;
+		return changed;
+	}
 	void ReadyCheckContext::Init(size_t requiredCount)
 	{
 		KG_ASSERT(requiredCount > 0);
@@ -6,13 +6,17 @@
 #include "Kargono/Utility/Timers.h"
 #include "Kargono/Core/DataStructures.h"
 #include "Kargono/Network/Connection.h"
+#include "Kargono/Network/Snapshot.h"
 
 #include <unordered_set>
+#include <vector>
+#include <span>
 
 
 namespace Kargono::Network
 {
 	class ServerNetworkThread;
+	class ServerSessionWorker;
 
 	class ReadyCheckContext
 	{
@@ -48,6 +52,13 @@ namespace Kargono::Network
 		std::unordered_set<ClientIndex> m_ReadyClients{};
 	};
 
+	struct ReplicatedEntity
+	{
+		// Client whose snapshots own this entity's state
+		ClientIndex m_Owner{ k_InvalidClientIndex };
+		QuantizedEntityState m_State{};
+	};
+
 	class Session
 	{
 	public:
@@ -56,7 +67,8 @@ namespace Kargono::Network
 		//==============================
 		// General session build-up/tear-down
 		void CreateSession();
-		void Init(ServerNetworkThread* networkThread, ConnectionList* parentConnectionList);
+		void Init(SessionID sessionID, ServerNetworkThread* networkThread, 
+			ServerSessionWorker* sessionWorker, ConnectionList* parentConnectionList);
 		void Terminate();
 	private:
 		// Helper functions
@@ -79,6 +91,17 @@ namespace Kargono::Network
 		//==============================
 		SessionIndex AddClient(ClientIndex newClient);
 		SessionIndex RemoveClient(ClientIndex clientID);
+		bool ContainsClient(ClientIndex queryClient);
+
+		//==============================
+		// Manage Replicated Entities
+		//==============================
+		// Replace all entities owned by the client with the provided entities (sorted by ID)
+		void UpdateClientEntities(ClientIndex owner, std::span<const QuantizedEntityState> entities);
+		// Fill outEntities with all entities (sorted by ID) not owned by the recipient
+		void GetEntitiesForClient(ClientIndex recipient, std::vector<QuantizedEntityState>& outEntities) const;
+		// Returns true (and clears the flag) if the replicated entities changed since the last call
+		bool PollReplicatedEntitiesChanged();
 
 		//==============================
 		// Getter/Setters
@@ -95,6 +118,10 @@ namespace Kargono::Network
 		{ 
 			return m_GameplayStartFrame; 
 		}
+		SessionID GetSessionID() const
+		{
+			return m_SessionID;
+		}
 		SparseArray<ClientIndex, SessionIndex>& GetSessionClients()
 		{
 			return m_ActiveClients;
@@ -106,17 +133,22 @@ namespace Kargono::Network
 		//==============================
 		// State data
 		bool m_Active{ false };
+		SessionID m_SessionID{ k_InvalidSessionID };
 		// Client data
 		SparseArray<ClientIndex, SessionIndex> m_ActiveClients{k_MaxSessionClients};
 		// Ready check data
 		ReadyCheckContext m_ReadyCheckContext{};
 		// Gameplay data
 		UpdateCount m_GameplayStartFrame{ 0 };
+		// Replicated entity data (sorted by entity ID)
+		std::vector<ReplicatedEntity> m_ReplicatedEntities{};
+		bool m_ReplicatedEntitiesChanged{ false };
 
 		//==============================
 		// Injected Dependencies
 		//==============================
 		ConnectionList* i_ConnectionList{ nullptr };
 		ServerNetworkThread* i_NetworkThread{ nullptr };
+		ServerSessionWorker* i_SessionWorker{ nullptr };
 	};
 }
@@ -0,0 +1,656 @@
+#include "kgpch.h"
+
+#include "Kargono/Network/Snapshot.h"
+
+namespace Kargono::Network
+{
+	//==============================
+	// Snapshot Layout
+	//==============================
+	// Payload (bit-packed, LSB first):
+	//		sequence(16) | hasBaseline(1) | [baselineSequence(16)]
+	//		for each baseline entity: present(1) | [changed(1) | [5 x component delta]]
+	//		newEntityCount(8) | new entities: entityID(64) | 3 x translation | 2 x velocity
+	// Component delta: unchanged(1 bit = 0) or 1 + sizeClass(2) + value. Size classes 0-2 hold a
+	//		zig-zag encoded delta of k_DeltaClassBits bits, class 3 holds the raw quantized value.
+	constexpr size_t k_ComponentCount{ 5 };
+	constexpr uint32_t k_DeltaClassBits[3]{ 4, 8, 12 };
+	constexpr uint32_t k_SequenceBits{ sizeof(PacketSequence) * 8 };
+	constexpr uint32_t k_NewEntityCountBits{ 8 };
+	constexpr uint32_t k_MaxNewEntities{ (1 << k_NewEntityCountBits) - 1 };
+	constexpr uint32_t k_NewEntityBits{ 64 + 3 * k_SnapshotTranslationBits + 2 * k_SnapshotVelocityBits };
+	constexpr size_t k_MaxPayloadBits{ k_MaxPayloadSize * 8 };
+
+	//==============================
+	// Bit Stream Helpers
+	//==============================
+	class SnapshotBitWriter
+	{
+	public:
+		SnapshotBitWriter(uint8_t* buffer) : m_Buffer(buffer) {}
+
+		void Write(uint32_t value, uint32_t bitCount)
+		{
+			KG_ASSERT(bitCount <= 32);
+			uint64_t mask = bitCount == 32 ? 0xFFFF'FFFF : ((uint64_t)1 << bitCount) - 1;
+
+			// Accumulate bits and flush whole bytes
+			m_Scratch |= ((uint64_t)value & mask) << m_ScratchBits;
+			m_ScratchBits += bitCount;
+			m_BitsWritten += bitCount;
+			while (m_ScratchBits >= 8)
+			{
+				m_Buffer[m_ByteIndex++] = (uint8_t)m_Scratch;
+				m_Scratch >>= 8;
+				m_ScratchBits -= 8;
+			}
+		}
+
+		void Write64(uint64_t value)
+		{
+			Write((uint32_t)value, 32);
+			Write((uint32_t)(value >> 32), 32);
+		}
+
+		// Flush the final partial byte and return the total bytes written
+		size_t Finish()
+		{
+			if (m_ScratchBits > 0)
+			{
+				m_Buffer[m_ByteIndex++] = (uint8_t)m_Scratch;
+				m_Scratch = 0;
+				m_ScratchBits = 0;
+			}
+			return m_ByteIndex;
+		}
+
+		size_t GetBitsWritten() const
+		{
+			return m_BitsWritten;
+		}
+	private:
+		uint8_t* m_Buffer{ nullptr };
+		size_t m_ByteIndex{ 0 };
+		size_t m_BitsWritten{ 0 };
+		uint64_t m_Scratch{ 0 };
+		uint32_t m_ScratchBits{ 0 };
+	};
+
+	class SnapshotBitReader
+	{
+	public:
+		SnapshotBitReader(const uint8_t* buffer, size_t size) : m_Buffer(buffer), m_TotalBits(size * 8) {}
+
+		bool Read(uint32_t& value, uint32_t bitCount)
+		{
+			KG_ASSERT(bitCount <= 32);
+
+			// Ensure the payload contains enough bits
+			if (m_BitsRead + bitCount > m_TotalBits)
+			{
+				return false;
+			}
+
+			// Pull in whole bytes until the request can be satisfied
+			while (m_ScratchBits < bitCount)
+			{
+				m_Scratch |= (uint64_t)m_Buffer[m_ByteIndex++] << m_ScratchBits;
+				m_ScratchBits += 8;
+			}
+
+			uint64_t mask = bitCount == 32 ? 0xFFFF'FFFF : ((uint64_t)1 << bitCount) - 1;
+			value = (uint32_t)(m_Scratch & mask);
+			m_Scratch >>= bitCount;
+			m_ScratchBits -= bitCount;
+			m_BitsRead += bitCount;
+			return true;
+		}
+
+		bool Read64(uint64_t& value)
+		{
+			uint32_t low{ 0 };
+			uint32_t high{ 0 };
+			if (!Read(low, 32) || !Read(high, 32))
+			{
+				return false;
+			}
+			value = (uint64_t)low | ((uint64_t)high << 32);
+			return true;
+		}
+	private:
+		const uint8_t* m_Buffer{ nullptr };
+		size_t m_TotalBits{ 0 };
+		size_t m_ByteIndex{ 0 };
+		size_t m_BitsRead{ 0 };
+		uint64_t m_Scratch{ 0 };
+		uint32_t m_ScratchBits{ 0 };
+	};
+
+	//==============================
+	// Component Helpers
+	//==============================
+	static uint32_t GetComponentBits(size_t component)
+	{
+		return component < 3 ? k_SnapshotTranslationBits : k_SnapshotVelocityBits;
+	}
+
+	static int32_t& GetComponent(QuantizedEntityState& state, size_t component)
+	{
+		return component < 3 ? state.m_Translation[component] : state.m_LinearVelocity[component - 3];
+	}
+
+	static int32_t GetComponent(const QuantizedEntityState& state, size_t component)
+	{
+		return component < 3 ? state.m_Translation[component] : state.m_LinearVelocity[component - 3];
+	}
+
+	static int32_t Quantize(float value, float precision, uint32_t bitCount)
+	{
+		const int32_t maxValue{ (1 << (bitCount - 1)) - 1 };
+		const int32_t minValue{ -(1 << (bitCount - 1)) };
+		return (int32_t)std::clamp(std::lround(value / precision), (long)minValue, (long)maxValue);
+	}
+
+	static int32_t SignExtend(uint32_t value, uint32_t bitCount)
+	{
+		uint32_t signBit{ (uint32_t)1 << (bitCount - 1) };
+		return (int32_t)((value ^ signBit) - signBit);
+	}
+
+	static uint32_t ZigZagEncode(int32_t value)
+	{
+		return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+	}
+
+	static int32_t ZigZagDecode(uint32_t value)
+	{
+		return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+	}
+
+	// Returns the size class of a delta (3 indicates a raw value is written instead)
+	static uint32_t GetDeltaClass(int32_t baseValue, int32_t newValue)
+	{
+		uint32_t zigZag{ ZigZagEncode(newValue - baseValue) };
+		for (uint32_t sizeClass{ 0 }; sizeClass < 3; sizeClass++)
+		{
+			if (zigZag < ((uint32_t)1 << k_DeltaClassBits[sizeClass]))
+			{
+				return sizeClass;
+			}
+		}
+		return 3;
+	}
+
+	static size_t GetEntityDeltaBits(const QuantizedEntityState& base, const QuantizedEntityState& current)
+	{
+		size_t bitCount{ 2 /*present + changed*/ };
+		for (size_t component{ 0 }; component < k_ComponentCount; component++)
+		{
+			int32_t baseValue{ GetComponent(base, component) };
+			int32_t newValue{ GetComponent(current, component) };
+			bitCount++;
+			if (baseValue == newValue)
+			{
+				continue;
+			}
+			uint32_t sizeClass{ GetDeltaClass(baseValue, newValue) };
+			bitCount += 2 + (sizeClass < 3 ? k_DeltaClassBits[sizeClass] : GetComponentBits(component));
+		}
+		return bitCount;
+	}
+
+	static void WriteEntityDelta(SnapshotBitWriter& writer, const QuantizedEntityState& base, const QuantizedEntityState& current)
+	{
+		for (size_t component{ 0 }; component < k_ComponentCount; component++)
+		{
+			int32_t baseValue{ GetComponent(base, component) };
+			int32_t newValue{ GetComponent(current, component) };
+			if (baseValue == newValue)
+			{
+				writer.Write(0, 1);
+				continue;
+			}
+
+			writer.Write(1, 1);
+			uint32_t sizeClass{ GetDeltaClass(baseValue, newValue) };
+			writer.Write(sizeClass, 2);
+			if (sizeClass < 3)
+			{
+				writer.Write(ZigZagEncode(newValue - baseValue), k_DeltaClassBits[sizeClass]);
+			}
+			else
+			{
+				writer.Write((uint32_t)newValue, GetComponentBits(component));
+			}
+		}
+	}
+
+	static bool ReadEntityDelta(SnapshotBitReader& reader, QuantizedEntityState& state)
+	{
+		for (size_t component{ 0 }; component < k_ComponentCount; component++)
+		{
+			uint32_t componentChanged{ 0 };
+			if (!reader.Read(componentChanged, 1))
+			{
+				return false;
+			}
+			if (!componentChanged)
+			{
+				continue;
+			}
+
+			uint32_t sizeClass{ 0 };
+			uint32_t value{ 0 };
+			if (!reader.Read(sizeClass, 2))
+			{
+				return false;
+			}
+			if (sizeClass < 3)
+			{
+				if (!reader.Read(value, k_DeltaClassBits[sizeClass]))
+				{
+					return false;
+				}
+				GetComponent(state, component) += ZigZagDecode(value);
+			}
+			else
+			{
+				if (!reader.Read(value, GetComponentBits(component)))
+				{
+					return false;
+				}
+				GetComponent(state, component) = SignExtend(value, GetComponentBits(component));
+			}
+		}
+		return true;
+	}
+
+	static void WriteFullEntity(SnapshotBitWriter& writer, const QuantizedEntityState& state)
+	{
+		writer.Write64(state.m_EntityID);
+		for (size_t component{ 0 }; component < k_ComponentCount; component++)
+		{
+			writer.Write((uint32_t)GetComponent(state, component), GetComponentBits(component));
+		}
+	}
+
+	static bool ReadFullEntity(SnapshotBitReader& reader, QuantizedEntityState& state)
+	{
+		if (!reader.Read64(state.m_EntityID))
+		{
+			return false;
+		}
+		for (size_t component{ 0 }; component < k_ComponentCount; component++)
+		{
+			uint32_t value{ 0 };
+			if (!reader.Read(value, GetComponentBits(component)))
+			{
+				return false;
+			}
+			GetComponent(state, component) = SignExtend(value, GetComponentBits(component));
+		}
+		return true;
+	}
+
+	static void SortEntities(std::vector<QuantizedEntityState>& entities)
+	{
+		std::sort(entities.begin(), entities.end(), [](const QuantizedEntityState& a, const QuantizedEntityState& b)
+		{
+			return a.m_EntityID < b.m_EntityID;
+		});
+	}
+
+	//==============================
+	// Quantization
+	//==============================
+	QuantizedEntityState QuantizeEntityState(const EntitySnapshotState& state)
+	{
+		QuantizedEntityState quantized;
+		quantized.m_EntityID = state.m_EntityID;
+		for (size_t i{ 0 }; i < 3; i++)
+		{
+			quantized.m_Translation[i] = Quantize(state.m_Translation[(int)i], k_SnapshotTranslationPrecision, k_SnapshotTranslationBits);
+		}
+		for (size_t i{ 0 }; i < 2; i++)
+		{
+			quantized.m_LinearVelocity[i] = Quantize(state.m_LinearVelocity[(int)i], k_SnapshotVelocityPrecision, k_SnapshotVelocityBits);
+		}
+		return quantized;
+	}
+
+	EntitySnapshotState DequantizeEntityState(const QuantizedEntityState& state)
+	{
+		EntitySnapshotState dequantized;
+		dequantized.m_EntityID = state.m_EntityID;
+		for (size_t i{ 0 }; i < 3; i++)
+		{
+			dequantized.m_Translation[(int)i] = (float)state.m_Translation[i] * k_SnapshotTranslationPrecision;
+		}
+		for (size_t i{ 0 }; i < 2; i++)
+		{
+			dequantized.m_LinearVelocity[(int)i] = (float)state.m_LinearVelocity[i] * k_SnapshotVelocityPrecision;
+		}
+		return dequantized;
+	}
+
+	//==============================
+	// Snapshot Send Context
+	//==============================
+	void SnapshotSendContext::WriteSnapshot(std::span<const QuantizedEntityState> entities, PacketSequence sequence, Message& msg)
+	{
+		const Snapshot* baseline = GetBaseline(sequence);
+
+		// Prepare the stored copy of this snapshot. It mirrors exactly what the receiver will
+		//		reconstruct, so deferred entities keep their baseline values.
+		Snapshot& sentSnapshot = m_SentSnapshots[sequence % k_AckBitFieldSize];
+		KG_ASSERT(&sentSnapshot != baseline);
+		sentSnapshot.m_Sequence = sequence;
+		sentSnapshot.m_Valid = true;
+		sentSnapshot.m_Entities.clear();
+		m_LatestSequence = sequence;
+		m_HasLatest = true;
+		m_HasDeferred = false;
+
+		SnapshotBitWriter writer{ (uint8_t*)msg.GetPayloadPointer() };
+
+		// Write the sequence and baseline
+		writer.Write(sequence, k_SequenceBits);
+		writer.Write(baseline ? 1 : 0, 1);
+		if (baseline)
+		{
+			writer.Write(baseline->m_Sequence, k_SequenceBits);
+		}
+
+		// Walk the baseline and current entities (both sorted by ID) side by side
+		size_t currentIndex{ 0 };
+		size_t newEntityCount{ 0 };
+		std::array<size_t, k_MaxNewEntities> newEntityIndices{};
+		std::span<const QuantizedEntityState> baseEntities{};
+		if (baseline)
+		{
+			baseEntities = baseline->m_Entities;
+		}
+
+		for (size_t baseIndex{ 0 }; baseIndex < baseEntities.size(); baseIndex++)
+		{
+			const QuantizedEntityState& baseEntity{ baseEntities[baseIndex] };
+
+			// Collect entities that are not part of the baseline
+			while (currentIndex < entities.size() && entities[currentIndex].m_EntityID < baseEntity.m_EntityID)
+			{
+				if (newEntityCount < k_MaxNewEntities)
+				{
+					newEntityIndices[newEntityCount++] = currentIndex;
+				}
+				else
+				{
+					m_HasDeferred = true;
+				}
+				currentIndex++;
+			}
+
+			// Entity was removed since the baseline
+			if (currentIndex >= entities.size() || entities[currentIndex].m_EntityID != baseEntity.m_EntityID)
+			{
+				writer.Write(0, 1);
+				continue;
+			}
+
+			const QuantizedEntityState& currentEntity{ entities[currentIndex] };
+			currentIndex++;
+			writer.Write(1, 1);
+
+			if (currentEntity == baseEntity)
+			{
+				writer.Write(0, 1);
+				sentSnapshot.m_Entities.push_back(baseEntity);
+				continue;
+			}
+
+			// Reserve room for the remaining baseline entries (present + unchanged) and the new entity count
+			size_t remainingBaseBits{ (baseEntities.size() - baseIndex - 1) * 2 + k_NewEntityCountBits };
+			size_t deltaBits{ GetEntityDeltaBits(baseEntity, currentEntity) - 1 /*present already written*/ };
+			if (writer.GetBitsWritten() + deltaBits + remainingBaseBits > k_MaxPayloadBits)
+			{
+				// Defer this entity's change to a following snapshot
+				writer.Write(0, 1);
+				sentSnapshot.m_Entities.push_back(baseEntity);
+				m_HasDeferred = true;
+				continue;
+			}
+
+			writer.Write(1, 1);
+			WriteEntityDelta(writer, baseEntity, currentEntity);
+			sentSnapshot.m_Entities.push_back(currentEntity);
+		}
+
+		// Any remaining current entities are new
+		for (; currentIndex < entities.size(); currentIndex++)
+		{
+			if (newEntityCount < k_MaxNewEntities)
+			{
+				newEntityIndices[newEntityCount++] = currentIndex;
+			}
+			else
+			{
+				m_HasDeferred = true;
+			}
+		}
+
+		// Write as many new entities as fit into the packet
+		size_t availableBits{ k_MaxPayloadBits - writer.GetBitsWritten() - k_NewEntityCountBits };
+		size_t writtenNewCount{ std::min(newEntityCount, availableBits / k_NewEntityBits) };
+		if (writtenNewCount < newEntityCount)
+		{
+			m_HasDeferred = true;
+		}
+		writer.Write((uint32_t)writtenNewCount, k_NewEntityCountBits);
+		for (size_t i{ 0 }; i < writtenNewCount; i++)
+		{
+			const QuantizedEntityState& newEntity{ entities[newEntityIndices[i]] };
+			WriteFullEntity(writer, newEntity);
+			sentSnapshot.m_Entities.push_back(newEntity);
+		}
+
+		// Keep the stored snapshot sorted for the next delta
+		SortEntities(sentSnapshot.m_Entities);
+
+		msg.m_Header.m_PayloadSize = writer.Finish();
+		KG_ASSERT(msg.m_Header.m_PayloadSize <= k_MaxPayloadSize);
+	}
+
+	void SnapshotSendContext::OnPacketAcked(PacketSequence sequence)
+	{
+		// Ignore acks for packets that did not carry a snapshot
+		const Snapshot& ackedSnapshot = m_SentSnapshots[sequence % k_AckBitFieldSize];
+		if (!ackedSnapshot.m_Valid || ackedSnapshot.m_Sequence != sequence)
+		{
+			return;
+		}
+
+		// Only move the baseline forward
+		if (!m_HasBaseline || SequenceGreaterThan(sequence, m_BaselineSequence))
+		{
+			m_BaselineSequence = sequence;
+			m_HasBaseline = true;
+		}
+	}
+
+	void SnapshotSendContext::Reset()
+	{
+		for (Snapshot& snapshot : m_SentSnapshots)
+		{
+			snapshot.m_Valid = false;
+			snapshot.m_Entities.clear();
+		}
+		m_HasBaseline = false;
+		m_HasLatest = false;
+		m_HasDeferred = false;
+	}
+
+	bool SnapshotSendContext::HasPendingChanges() const
+	{
+		if (!m_HasLatest)
+		{
+			return false;
+		}
+		return m_HasDeferred || !m_HasBaseline || m_BaselineSequence != m_LatestSequence;
+	}
+
+	const Snapshot* SnapshotSendContext::GetBaseline(PacketSequence sequence) const
+	{
+		if (!m_HasBaseline)
+		{
+			return nullptr;
+		}
+
+		// The receiver only retains the last k_AckBitFieldSize sequences
+		if ((PacketSequence)(sequence - m_BaselineSequence) >= k_AckBitFieldSize)
+		{
+			return nullptr;
+		}
+
+		const Snapshot& baseline = m_SentSnapshots[m_BaselineSequence % k_AckBitFieldSize];
+		if (!baseline.m_Valid || baseline.m_Sequence != m_BaselineSequence)
+		{
+			return nullptr;
+		}
+		return &baseline;
+	}
+
+	//==============================
+	// Snapshot Receive Context
+	//==============================
+	bool SnapshotReceiveContext::ReadSnapshot(Message& msg, std::vector<QuantizedEntityState>& outChanged)
+	{
+		outChanged.clear();
+		SnapshotBitReader reader{ (const uint8_t*)msg.GetPayloadPointer(), msg.m_Header.m_PayloadSize };
+
+		// Read the sequence and baseline
+		uint32_t sequence{ 0 };
+		uint32_t hasBaseline{ 0 };
+		uint32_t baselineSequence{ 0 };
+		if (!reader.Read(sequence, k_SequenceBits) || !reader.Read(hasBaseline, 1))
+		{
+			return false;
+		}
+		if (hasBaseline && !reader.Read(baselineSequence, k_SequenceBits))
+		{
+			return false;
+		}
+
+		// Locate the baseline and destination slots
+		Snapshot& newSnapshot = m_ReceivedSnapshots[sequence % k_AckBitFieldSize];
+		const Snapshot* baseline{ nullptr };
+		if (hasBaseline)
+		{
+			baseline = &m_ReceivedSnapshots[baselineSequence % k_AckBitFieldSize];
+			if (!baseline->m_Valid || baseline->m_Sequence != (PacketSequence)baselineSequence || baseline == &newSnapshot)
+			{
+				return false;
+			}
+		}
+
+		// Reconstruct into the destination slot
+		newSnapshot.m_Valid = false;
+		newSnapshot.m_Sequence = (PacketSequence)sequence;
+		newSnapshot.m_Entities.clear();
+
+		if (baseline)
+		{
+			for (const QuantizedEntityState& baseEntity : baseline->m_Entities)
+			{
+				uint32_t present{ 0 };
+				if (!reader.Read(present, 1))
+				{
+					return false;
+				}
+				if (!present)
+				{
+					continue;
+				}
+
+				uint32_t changed{ 0 };
+				if (!reader.Read(changed, 1))
+				{
+					return false;
+				}
+
+				QuantizedEntityState entity{ baseEntity };
+				if (changed && !ReadEntityDelta(reader, entity))
+				{
+					return false;
+				}
+				newSnapshot.m_Entities.push_back(entity);
+			}
+		}
+
+		uint32_t newEntityCount{ 0 };
+		if (!reader.Read(newEntityCount, k_NewEntityCountBits))
+		{
+			return false;
+		}
+		for (uint32_t i{ 0 }; i < newEntityCount; i++)
+		{
+			QuantizedEntityState entity{};
+			if (!ReadFullEntity(reader, entity))
+			{
+				return false;
+			}
+			newSnapshot.m_Entities.push_back(entity);
+		}
+
+		SortEntities(newSnapshot.m_Entities);
+		newSnapshot.m_Valid = true;
+
+		// Older snapshots can still serve as a baseline, but their state is stale
+		if (m_HasLatest && !SequenceGreaterThan(newSnapshot.m_Sequence, m_LatestSequence))
+		{
+			return true;
+		}
+
+		// Report entities that differ from the newest previously read snapshot
+		std::span<const QuantizedEntityState> previousEntities{ GetLatestEntities() };
+		size_t previousIndex{ 0 };
+		for (const QuantizedEntityState& entity : newSnapshot.m_Entities)
+		{
+			while (previousIndex < previousEntities.size() && previousEntities[previousIndex].m_EntityID < entity.m_EntityID)
+			{
+				previousIndex++;
+			}
+			if (previousIndex >= previousEntities.size() || !(previousEntities[previousIndex] == entity))
+			{
+				outChanged.push_back(entity);
+			}
+		}
+
+		m_LatestSequence = newSnapshot.m_Sequence;
+		m_HasLatest = true;
+		return true;
+	}
+
+	void SnapshotReceiveContext::Reset()
+	{
+		for (Snapshot& snapshot : m_ReceivedSnapshots)
+		{
+			snapshot.m_Valid = false;
+			snapshot.m_Entities.clear();
+		}
+		m_HasLatest = false;
+	}
+
+	std::span<const QuantizedEntityState> SnapshotReceiveContext::GetLatestEntities() const
+	{
+		if (!m_HasLatest)
+		{
+			return {};
+		}
+
+		const Snapshot& latest = m_ReceivedSnapshots[m_LatestSequence % k_AckBitFieldSize];
+		if (!latest.m_Valid || latest.m_Sequence != m_LatestSequence)
+		{
+			return {};
+		}
+		return latest.m_Entities;
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Kargono/Network/NetworkCommon.h"
+#include "Kargono/Math/MathAliases.h"
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <span>
+
+namespace Kargono::Network
+{
+	//==============================
+	// Quantization Settings
+	//==============================
+	// Translation: 1/1024 unit precision covering +/- 2048 units
+	constexpr float k_SnapshotTranslationPrecision{ 1.0f / 1024.0f };
+	constexpr uint32_t k_SnapshotTranslationBits{ 22 };
+	// Linear velocity: 1/256 unit/sec precision covering +/- 512 units/sec
+	constexpr float k_SnapshotVelocityPrecision{ 1.0f / 256.0f };
+	constexpr uint32_t k_SnapshotVelocityBits{ 18 };
+
+	//==============================
+	// Entity Snapshot State
+	//==============================
+	struct EntitySnapshotState
+	{
+		uint64_t m_EntityID{ 0 };
+		Math::vec3 m_Translation{ 0.0f };
+		Math::vec2 m_LinearVelocity{ 0.0f };
+	};
+
+	struct QuantizedEntityState
+	{
+		uint64_t m_EntityID{ 0 };
+		std::array<int32_t, 3> m_Translation{};
+		std::array<int32_t, 2> m_LinearVelocity{};
+
+		bool operator==(const QuantizedEntityState& other) const = default;
+	};
+
+	QuantizedEntityState QuantizeEntityState(const EntitySnapshotState& state);
+	EntitySnapshotState DequantizeEntityState(const QuantizedEntityState& state);
+
+	//==============================
+	// Snapshot
+	//==============================
+	struct Snapshot
+	{
+		// Packet sequence the snapshot was sent with
+		PacketSequence m_Sequence{ 0 };
+		bool m_Valid{ false };
+		// Entities sorted by ID
+		std::vector<QuantizedEntityState> m_Entities{};
+	};
+
+	//==============================
+	// Snapshot Send Context
+	//==============================
+	// Sender half of the snapshot channel for one remote peer. Every snapshot is delta-encoded
+	//		against the newest snapshot the peer acknowledged through the ReliabilityContext ack
+	//		bitfield. If no usable baseline exists, all entities are sent in full.
+	class SnapshotSendContext
+	{
+	public:
+		//==============================
+		// Manage Snapshots
+		//==============================
+		// Write the provided entities (sorted by ID) into the message payload. The sequence must be
+		//		the packet sequence the message will be sent with. Entities that do not fit into
+		//		k_MaxPayloadSize are deferred to a following snapshot.
+		void WriteSnapshot(std::span<const QuantizedEntityState> entities, PacketSequence sequence, Message& msg);
+		// Promote a sent snapshot to the delta baseline once its packet is acknowledged
+		void OnPacketAcked(PacketSequence sequence);
+		void Reset();
+
+		//==============================
+		// Query Context
+		//==============================
+		// Returns true if the latest snapshot is unacknowledged or entities were deferred. The
+		//		owner should keep writing snapshots until this returns false.
+		bool HasPendingChanges() const;
+	private:
+		//==============================
+		// Internal Functions
+		//==============================
+		const Snapshot* GetBaseline(PacketSequence sequence) const;
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		std::array<Snapshot, k_AckBitFieldSize> m_SentSnapshots{};
+		PacketSequence m_BaselineSequence{ 0 };
+		bool m_HasBaseline{ false };
+		PacketSequence m_LatestSequence{ 0 };
+		bool m_HasLatest{ false };
+		bool m_HasDeferred{ false };
+	};
+
+	//==============================
+	// Snapshot Receive Context
+	//==============================
+	// Receiver half of the snapshot channel for one remote peer. Stores recent snapshots so that
+	//		any baseline the sender may reference can be used to reconstruct the full state.
+	class SnapshotReceiveContext
+	{
+	public:
+		//==============================
+		// Manage Snapshots
+		//==============================
+		// Decode a snapshot from the message payload. Returns false if the payload is malformed or
+		//		its baseline is unavailable. On success, outChanged receives the new or modified
+		//		entities (empty if the snapshot is older than one already read).
+		bool ReadSnapshot(Message& msg, std::vector<QuantizedEntityState>& outChanged);
+		void Reset();
+
+		//==============================
+		// Getters/Setters
+		//==============================
+		// Full entity list of the newest snapshot read so far
+		std::span<const QuantizedEntityState> GetLatestEntities() const;
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		std::array<Snapshot, k_AckBitFieldSize> m_ReceivedSnapshots{};
+		PacketSequence m_LatestSequence{ 0 };
+		bool m_HasLatest{ false };
+	};
+}
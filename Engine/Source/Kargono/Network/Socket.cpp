@@ -6,17 +6,31 @@
 
 namespace Kargono::Network
 {
-	static SocketErrorCode GetSocketError(int windowsError)
+	static int GetLastSocketError()
 	{
-		switch (windowsError)
+#if defined(KG_PLATFORM_WINDOWS)
+		return GetLastSocketError();
+#else
+		return errno;
+#endif
+	}
+
+	static SocketErrorCode GetSocketError(int platformError)
+	{
+#if defined(KG_PLATFORM_WINDOWS)
+		constexpr int k_AddressInUseError{ 10'048 /*WSAEADDRINUSE*/ };
+#else
+		constexpr int k_AddressInUseError{ EADDRINUSE };
+#endif
+		if (platformError == 0)
 		{
-		case 0:
 			return SocketErrorCode::None;
-		case 10'048:
+		}
+		if (platformError == k_AddressInUseError)
+		{
 			return SocketErrorCode::AddressInUse;
-		default:
-			return SocketErrorCode::OtherFailure;
 		}
+		return SocketErrorCode::OtherFailure;
 	}
 
 	SocketErrorCode Socket::Open(unsigned short m_Port)
@@ -27,9 +41,8 @@ namespace Kargono::Network
 		// Ensure the socket is created
 		if (m_Handle == -1)
 		{
-			// TODO: This call is windows specific
-			KG_WARN("Failed to create a socket: {}", WSAGetLastError());
-			return GetSocketError(WSAGetLastError());
+			KG_WARN("Failed to create a socket: {}", GetLastSocketError());
+			return GetSocketError(GetLastSocketError());
 		}
 
 		// Create the socket's address
@@ -41,8 +54,8 @@ namespace Kargono::Network
 		// Bind the address to the socket
 		if (bind(m_Handle, (const sockaddr*)&m_Address, sizeof(sockaddr_in)) < 0)
 		{
-			KG_WARN("Failed to bind socket {}", WSAGetLastError());
-			return GetSocketError(WSAGetLastError());
+			KG_WARN("Failed to bind socket {}", GetLastSocketError());
+			return GetSocketError(GetLastSocketError());
 		}
 
 		// Set socket to non-blocking mode
@@ -50,15 +63,15 @@ namespace Kargono::Network
 		int nonBlocking = 1;
 		if (fcntl(m_Handle, F_SETFL, O_NONBLOCK, nonBlocking) == -1)
 		{
-			KG_WARN("Failed to set non-blocking {}", WSAGetLastError());
-			return GetSocketError(WSAGetLastError());
+			KG_WARN("Failed to set non-blocking {}", GetLastSocketError());
+			return GetSocketError(GetLastSocketError());
 		}
 #elif defined(KG_PLATFORM_WINDOWS)
 		DWORD nonBlocking = 1;
 		if (ioctlsocket(m_Handle, FIONBIO, &nonBlocking) != 0)
 		{
-			KG_WARN("Failed to set non-blocking {}", WSAGetLastError());
-			return GetSocketError(WSAGetLastError());
+			KG_WARN("Failed to set non-blocking {}", GetLastSocketError());
+			return GetSocketError(GetLastSocketError());
 		}
 #endif
 
@@ -129,6 +142,348 @@ namespace Kargono::Network
 		return bytes;
 	}
 
+	bool Socket::SendGathered(const SocketDatagram& datagram)
+	{
+		// Creating destination address
+		sockaddr_in destAddress;
+		destAddress.sin_family = AF_INET;
+		destAddress.sin_addr.s_addr = htonl(datagram.m_Address.GetAddress());
+		destAddress.sin_port = htons(datagram.m_Address.GetPort());
+
+		int totalSize{ datagram.m_Size + datagram.m_SharedPayloadSize };
+		int sentBytes{ 0 };
+#if defined(KG_PLATFORM_WINDOWS)
+		// Send the datagram's data followed by the shared payload
+		WSABUF dataBuffers[2];
+		dataBuffers[0].buf = (CHAR*)datagram.m_Data;
+		dataBuffers[0].len = (ULONG)datagram.m_Size;
+		dataBuffers[1].buf = (CHAR*)datagram.m_SharedPayload;
+		dataBuffers[1].len = (ULONG)datagram.m_SharedPayloadSize;
+		DWORD bytesSent{ 0 };
+		if (WSASendTo(m_Handle, dataBuffers, 2, &bytesSent, 0, (sockaddr*)&destAddress, sizeof(sockaddr_in), nullptr, nullptr) == 0)
+		{
+			sentBytes = (int)bytesSent;
+		}
+#else
+		// Send the datagram's data followed by the shared payload
+		iovec dataVectors[2];
+		dataVectors[0].iov_base = datagram.m_Data;
+		dataVectors[0].iov_len = (size_t)datagram.m_Size;
+		dataVectors[1].iov_base = (void*)datagram.m_SharedPayload;
+		dataVectors[1].iov_len = (size_t)datagram.m_SharedPayloadSize;
+		msghdr message{};
+		message.msg_name = &destAddress;
+		message.msg_namelen = sizeof(sockaddr_in);
+		message.msg_iov = dataVectors;
+		message.msg_iovlen = 2;
+		sentBytes = (int)sendmsg(m_Handle, &message, 0);
+#endif
+
+		if (sentBytes != totalSize)
+		{
+			KG_WARN("Failed to send packet");
+			return false;
+		}
+		return true;
+	}
+
+	size_t Socket::SendBatch(const SocketDatagram* datagrams, size_t count)
+	{
+		KG_ASSERT(datagrams);
+		count = std::min(count, k_MaxDatagramBatchSize);
+
+#if defined(KG_PLATFORM_LINUX)
+		// Describe every datagram for the kernel
+		sockaddr_in destAddresses[k_MaxDatagramBatchSize];
+		iovec dataVectors[k_MaxDatagramBatchSize][2];
+		mmsghdr messages[k_MaxDatagramBatchSize];
+		for (size_t index{ 0 }; index < count; index++)
+		{
+			const SocketDatagram& datagram{ datagrams[index] };
+			destAddresses[index] = {};
+			destAddresses[index].sin_family = AF_INET;
+			destAddresses[index].sin_addr.s_addr = htonl(datagram.m_Address.GetAddress());
+			destAddresses[index].sin_port = htons(datagram.m_Address.GetPort());
+
+			// Gather the per-datagram data followed by the optional shared payload
+			dataVectors[index][0].iov_base = datagram.m_Data;
+			dataVectors[index][0].iov_len = (size_t)datagram.m_Size;
+			dataVectors[index][1].iov_base = (void*)datagram.m_SharedPayload;
+			dataVectors[index][1].iov_len = (size_t)datagram.m_SharedPayloadSize;
+
+			messages[index] = {};
+			messages[index].msg_hdr.msg_name = &destAddresses[index];
+			messages[index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			messages[index].msg_hdr.msg_iov = dataVectors[index];
+			messages[index].msg_hdr.msg_iovlen = datagram.m_SharedPayloadSize > 0 ? 2 : 1;
+		}
+
+		// The kernel may accept only part of the batch, so continue with the remainder
+		size_t sentCount{ 0 };
+		while (sentCount < count)
+		{
+			int result = sendmmsg(m_Handle, &messages[sentCount], (unsigned int)(count - sentCount), 0);
+			if (result <= 0)
+			{
+				KG_WARN("Failed to send packet batch {}", GetLastSocketError());
+				break;
+			}
+			sentCount += (size_t)result;
+		}
+		return sentCount;
+#else
+		size_t sentCount{ 0 };
+		for (size_t index{ 0 }; index < count; index++)
+		{
+			const SocketDatagram& datagram{ datagrams[index] };
+			bool sendSuccess = datagram.m_SharedPayloadSize > 0 ?
+				SendGathered(datagram) :
+				Send(datagram.m_Address, datagram.m_Data, datagram.m_Size);
+			if (sendSuccess)
+			{
+				sentCount++;
+			}
+		}
+		return sentCount;
+#endif
+	}
+
+	size_t Socket::ReceiveBatch(SocketDatagram* datagrams, size_t count)
+	{
+		KG_ASSERT(datagrams);
+		count = std::min(count, k_MaxDatagramBatchSize);
+
+#if defined(KG_PLATFORM_LINUX)
+		// Point the kernel at every caller-provided buffer
+		sockaddr_in fromAddresses[k_MaxDatagramBatchSize];
+		iovec dataVectors[k_MaxDatagramBatchSize];
+		mmsghdr messages[k_MaxDatagramBatchSize];
+		for (size_t index{ 0 }; index < count; index++)
+		{
+			dataVectors[index].iov_base = datagrams[index].m_Data;
+			dataVectors[index].iov_len = (size_t)datagrams[index].m_Capacity;
+
+			messages[index] = {};
+			messages[index].msg_hdr.msg_name = &fromAddresses[index];
+			messages[index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			messages[index].msg_hdr.msg_iov = &dataVectors[index];
+			messages[index].msg_hdr.msg_iovlen = 1;
+		}
+
+		// Drain up to count datagrams without blocking
+		int result = recvmmsg(m_Handle, messages, (unsigned int)count, MSG_DONTWAIT, nullptr);
+		if (result <= 0)
+		{
+			return 0;
+		}
+
+		// Modify each sender's address/port and the received sizes
+		for (size_t index{ 0 }; index < (size_t)result; index++)
+		{
+			SocketDatagram& datagram{ datagrams[index] };
+			datagram.m_Size = (int)messages[index].msg_len;
+			datagram.m_Address.SetAddress(ntohl(fromAddresses[index].sin_addr.s_addr));
+			datagram.m_Address.SetNewPort(ntohs(fromAddresses[index].sin_port));
+		}
+		return (size_t)result;
+#else
+		size_t receivedCount{ 0 };
+		for (; receivedCount < count; receivedCount++)
+		{
+			SocketDatagram& datagram{ datagrams[receivedCount] };
+			datagram.m_Size = Receive(datagram.m_Address, datagram.m_Data, datagram.m_Capacity);
+			if (datagram.m_Size <= 0)
+			{
+				break;
+			}
+		}
+		return receivedCount;
+#endif
+	}
+
+	bool SocketEvent::Init(Socket* socket, size_t timerFrequency)
+	{
+		KG_ASSERT(socket);
+
+		// Store dependencies
+		i_Socket = socket;
+		m_TimerFrequency = timerFrequency;
+
+#if defined(KG_PLATFORM_WINDOWS)
+		// Create the event object and tie it to socket reads
+		m_EventHandle = WSACreateEvent();
+		if (m_EventHandle == WSA_INVALID_EVENT)
+		{
+			KG_WARN("Failed to create the network event handle {}", GetLastSocketError());
+			return false;
+		}
+		if (WSAEventSelect(i_Socket->GetHandle(), m_EventHandle, FD_READ) != 0)
+		{
+			KG_WARN("Failed to register the socket with the network event handle {}", GetLastSocketError());
+			Terminate();
+			return false;
+		}
+#elif defined(KG_PLATFORM_LINUX)
+		// Create the epoll set along with the timer and interrupt descriptors
+		m_EpollHandle = epoll_create1(EPOLL_CLOEXEC);
+		m_TimerHandle = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+		m_InterruptHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (m_EpollHandle == -1 || m_TimerHandle == -1 || m_InterruptHandle == -1)
+		{
+			KG_WARN("Failed to create the network event handles {}", GetLastSocketError());
+			Terminate();
+			return false;
+		}
+
+		// Register all descriptors. The socket is edge-triggered so a wake-up only occurs when
+		//		new datagrams arrive, rather than for every wait while the network thread drains it.
+		epoll_event socketEvent{};
+		socketEvent.events = EPOLLIN | EPOLLET;
+		socketEvent.data.fd = i_Socket->GetHandle();
+		epoll_event timerEvent{};
+		timerEvent.events = EPOLLIN;
+		timerEvent.data.fd = m_TimerHandle;
+		epoll_event interruptEvent{};
+		interruptEvent.events = EPOLLIN;
+		interruptEvent.data.fd = m_InterruptHandle;
+		if (epoll_ctl(m_EpollHandle, EPOLL_CTL_ADD, i_Socket->GetHandle(), &socketEvent) == -1 ||
+			epoll_ctl(m_EpollHandle, EPOLL_CTL_ADD, m_TimerHandle, &timerEvent) == -1 ||
+			epoll_ctl(m_EpollHandle, EPOLL_CTL_ADD, m_InterruptHandle, &interruptEvent) == -1)
+		{
+			KG_WARN("Failed to register the network event handles {}", GetLastSocketError());
+			Terminate();
+			return false;
+		}
+
+		// Arm the periodic timer
+		SetTimerFrequency(m_TimerFrequency);
+#endif
+		return true;
+	}
+
+	void SocketEvent::Terminate()
+	{
+#if defined(KG_PLATFORM_WINDOWS)
+		if (m_EventHandle != WSA_INVALID_EVENT)
+		{
+			WSACloseEvent(m_EventHandle);
+			m_EventHandle = WSA_INVALID_EVENT;
+		}
+#elif defined(KG_PLATFORM_LINUX)
+		for (int* handle : { &m_EpollHandle, &m_TimerHandle, &m_InterruptHandle })
+		{
+			if (*handle != -1)
+			{
+				close(*handle);
+				*handle = -1;
+			}
+		}
+#endif
+		i_Socket = nullptr;
+	}
+
+	SocketEventType SocketEvent::WaitForEvent()
+	{
+#if defined(KG_PLATFORM_WINDOWS)
+		DWORD waitResult = WaitForMultipleObjects
+		(
+			1, &m_EventHandle,
+			FALSE, (DWORD)m_TimerFrequency
+		);
+
+		if (waitResult == WAIT_TIMEOUT)
+		{
+			return SocketEventType::TimerExpired;
+		}
+		if (waitResult != WAIT_OBJECT_0)
+		{
+			return SocketEventType::Failure;
+		}
+
+		// Resets the event object and reports whether the socket caused the wake-up
+		WSANETWORKEVENTS netEvents;
+		WSAEnumNetworkEvents(i_Socket->GetHandle(), m_EventHandle, &netEvents);
+		if (netEvents.lNetworkEvents & FD_READ)
+		{
+			return SocketEventType::SocketReadable;
+		}
+		return SocketEventType::Interrupted;
+#elif defined(KG_PLATFORM_LINUX)
+		constexpr int k_MaxEvents{ 3 };
+		epoll_event events[k_MaxEvents];
+
+		int eventCount{ 0 };
+		do
+		{
+			eventCount = epoll_wait(m_EpollHandle, events, k_MaxEvents, -1);
+		} while (eventCount == -1 && errno == EINTR);
+
+		if (eventCount <= 0)
+		{
+			return SocketEventType::Failure;
+		}
+
+		// Socket reads take precedence, then timer expiration, then interrupts
+		SocketEventType result{ SocketEventType::None };
+		for (int index{ 0 }; index < eventCount; index++)
+		{
+			int handle{ events[index].data.fd };
+			uint64_t counter{ 0 };
+			if (handle == i_Socket->GetHandle())
+			{
+				result = SocketEventType::SocketReadable;
+			}
+			else if (handle == m_TimerHandle)
+			{
+				// Consume the expiration count to re-arm the level-triggered descriptor
+				[[maybe_unused]] ssize_t bytesRead = read(m_TimerHandle, &counter, sizeof(counter));
+				if (result != SocketEventType::SocketReadable)
+				{
+					result = SocketEventType::TimerExpired;
+				}
+			}
+			else if (handle == m_InterruptHandle)
+			{
+				[[maybe_unused]] ssize_t bytesRead = read(m_InterruptHandle, &counter, sizeof(counter));
+				if (result == SocketEventType::None)
+				{
+					result = SocketEventType::Interrupted;
+				}
+			}
+		}
+		return result;
+#else
+		return SocketEventType::Failure;
+#endif
+	}
+
+	void SocketEvent::Interrupt()
+	{
+#if defined(KG_PLATFORM_WINDOWS)
+		WSASetEvent(m_EventHandle);
+#elif defined(KG_PLATFORM_LINUX)
+		uint64_t increment{ 1 };
+		[[maybe_unused]] ssize_t bytesWritten = write(m_InterruptHandle, &increment, sizeof(increment));
+#endif
+	}
+
+	void SocketEvent::SetTimerFrequency(size_t frequency)
+	{
+		m_TimerFrequency = frequency;
+
+#if defined(KG_PLATFORM_LINUX)
+		// Periodic timer with the first expiration one period from now
+		itimerspec timerSpec{};
+		timerSpec.it_interval.tv_sec = (time_t)(frequency / 1'000);
+		timerSpec.it_interval.tv_nsec = (long)(frequency % 1'000) * 1'000'000;
+		timerSpec.it_value = timerSpec.it_interval;
+		if (timerfd_settime(m_TimerHandle, 0, &timerSpec, nullptr) == -1)
+		{
+			KG_WARN("Failed to set the network event timer frequency {}", GetLastSocketError());
+		}
+#endif
+	}
+
 	bool SocketContext::InitializeSockets()
 	{
 		if (s_SocketsUsageCount > 0)
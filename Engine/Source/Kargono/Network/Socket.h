@@ -11,6 +11,25 @@ namespace Kargono::Network
 		OtherFailure,
 	};
 
+	// Maximum number of datagrams moved by a single batched send/receive call
+	constexpr size_t k_MaxDatagramBatchSize{ 32 };
+
+	struct SocketDatagram
+	{
+		// Destination when sending and sender when receiving
+		Address m_Address{};
+		// Caller-owned packet buffer
+		void* m_Data{ nullptr };
+		// Bytes to send or bytes received
+		int m_Size{ 0 };
+		// Size of the buffer pointed to by m_Data (receive only)
+		int m_Capacity{ 0 };
+		// Optional payload sent directly after m_Data (send only). Lets many datagrams share one
+		//		serialized payload while only their leading bytes (m_Data) differ.
+		const void* m_SharedPayload{ nullptr };
+		int m_SharedPayloadSize{ 0 };
+	};
+
 	class Socket
 	{
 	public:
@@ -31,6 +50,10 @@ namespace Kargono::Network
 		//==============================
 		bool Send(const Address& destination, const void* data, int size);
 		int Receive(Address& sender, void* data, int size);
+		// Send/receive up to k_MaxDatagramBatchSize datagrams with a single system call where
+		//		the platform supports it (sendmmsg/recvmmsg). Both return the number of datagrams moved.
+		size_t SendBatch(const SocketDatagram* datagrams, size_t count);
+		size_t ReceiveBatch(SocketDatagram* datagrams, size_t count);
 
 		//==============================
 		// Query Socket State
@@ -41,6 +64,12 @@ namespace Kargono::Network
 		// Getters/Setters
 		//==============================
 		int GetHandle() const;
+	private:
+		//==============================
+		// Internal Functions
+		//==============================
+		// Send m_Data followed by m_SharedPayload as a single datagram
+		bool SendGathered(const SocketDatagram& datagram);
 	private:
 		//==============================
 		// Internal Fields
@@ -48,6 +77,68 @@ namespace Kargono::Network
 		int m_Handle{0};
 	};
 
+	//===========================
+	// Socket Event
+	//===========================
+
+	enum class SocketEventType
+	{
+		None = 0,
+		SocketReadable, // New datagram(s) arrived on the watched socket
+		TimerExpired, // The periodic timer fired
+		Interrupted, // Another thread called Interrupt()
+		Failure
+	};
+
+	// Blocks a thread until the watched socket becomes readable, the periodic timer
+	//		fires, or another thread interrupts the wait. Windows uses a WSA event object
+	//		while Linux uses an epoll set containing the socket, a timerfd, and an eventfd.
+	class SocketEvent
+	{
+	public:
+		//==============================
+		// Constructors/Destructors
+		//==============================
+		SocketEvent() = default;
+		~SocketEvent() = default;
+
+		//==============================
+		// Lifecycle Functions
+		//==============================
+		bool Init(Socket* socket, size_t timerFrequency /*ms*/);
+		void Terminate();
+
+		//==============================
+		// Wait on Events
+		//==============================
+		SocketEventType WaitForEvent();
+		// Wake a thread blocked in WaitForEvent() (thread-safe)
+		void Interrupt();
+
+		//==============================
+		// Getters/Setters
+		//==============================
+		// Should only be called from the thread that calls WaitForEvent()
+		void SetTimerFrequency(size_t frequency /*ms*/);
+	private:
+		//==============================
+		// Internal Fields
+		//==============================
+		size_t m_TimerFrequency{ 1'000 /*1 sec*/ };
+#if defined(KG_PLATFORM_WINDOWS)
+		HANDLE m_EventHandle{ WSA_INVALID_EVENT };
+#elif defined(KG_PLATFORM_LINUX)
+		int m_EpollHandle{ -1 };
+		int m_TimerHandle{ -1 };
+		int m_InterruptHandle{ -1 };
+#endif
+
+		//==============================
+		// Injected Dependencies
+		//==============================
+		Socket* i_Socket{ nullptr };
+	};
+
 	//===========================
 	// Socket Context
 	//===========================
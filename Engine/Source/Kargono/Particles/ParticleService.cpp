@@ -6,11 +6,13 @@
 #include "Kargono/Rendering/RenderingService.h"
 #include "Kargono/Assets/AssetService.h"
 #include "Kargono/Core/Engine.h"
+#include "Kargono/Core/JobSystem.h"
 #include "Kargono/Utility/Random.h"
 #include "Kargono/Scenes/Scene.h"
 #include "Kargono/ECS/Entity.h"
 #include "Kargono/ECS/EngineComponents.h"
 #include "Kargono/Math/Interpolation.h"
+#include "Kargono/Math/SIMD.h"
 #include "Kargono/Events/SceneEvent.h"
 
 namespace Kargono::Particles
@@ -19,8 +21,16 @@ namespace Kargono::Particles
     {
         // All emitters being managed
 		std::unordered_map<UUID, EmitterInstance> m_AllEmitters;
-        Rendering::RendererInputSpec m_ParticleRenderSpec;
 		Utility::PseudoGenerator m_RandomGenerator{ 37427394 };
+		// Emitters whose particles are simulated this update
+		std::vector<EmitterInstance*> m_UpdatedEmitters;
+		// Instanced rendering data
+		Ref<Rendering::Shader> m_ParticleShader{ nullptr };
+		std::vector<uint8_t> m_InstanceData;
+		uint32_t m_InstanceStride{ 0 };
+		size_t m_PositionOffset{ 0 };
+		size_t m_SizeOffset{ 0 };
+		size_t m_ColorOffset{ 0 };
     };
 
     static Ref<ParticleContext> s_ParticleContext {nullptr};
@@ -34,28 +44,17 @@ namespace Kargono::Particles
 
 		// Initialize rendering data for particles
 		{
-			s_ParticleContext->m_ParticleRenderSpec.ClearData();
-				// Create shader for UI background/quad rendering
-			Rendering::ShaderSpecification shaderSpec{ Rendering::ColorInputType::FlatColor, Rendering::TextureInputType::None, false, true, false, Rendering::RenderingType::DrawIndex, false };
+			// Create instanced shader. Each particle is one instance of a static quad.
+			Rendering::ShaderSpecification shaderSpec{ Rendering::ColorInputType::FlatColor, Rendering::TextureInputType::None, false, true, false, Rendering::RenderingType::DrawIndex, false, true };
 			auto [uuid, localShader] = Assets::AssetService::GetShader(shaderSpec);
-			Buffer localBuffer{ localShader->GetInputLayout().GetStride() };
-
-			// Default particle color is pure white
-			Rendering::Shader::SetDataAtInputLocation<Math::vec4>({ 1.0f, 1.0f, 1.0f, 1.0f }, 
-				Utility::FileSystem::CRCFromString("a_Color"), 
-				localBuffer, 
-				localShader);
-
-			// Create basic shape component for UI quad rendering
-			ECS::ShapeComponent* shapeComp = new ECS::ShapeComponent();
-			shapeComp->CurrentShape = Rendering::ShapeTypes::Quad;
-			shapeComp->Vertices = CreateRef<std::vector<Math::vec3>>(Rendering::Shape::s_Quad.GetIndexVertices());
-			shapeComp->Indices = CreateRef<std::vector<uint32_t>>(Rendering::Shape::s_Quad.GetIndices());
-
-
-			s_ParticleContext->m_ParticleRenderSpec.m_Shader = localShader;
-			s_ParticleContext->m_ParticleRenderSpec.m_Buffer = localBuffer;
-			s_ParticleContext->m_ParticleRenderSpec.m_ShapeComponent = shapeComp;
+			s_ParticleContext->m_ParticleShader = localShader;
+
+			// Cache the location of each particle attribute inside an instance
+			Rendering::InputBufferLayout& instanceLayout = localShader->GetInputLayout();
+			s_ParticleContext->m_InstanceStride = instanceLayout.GetStride();
+			s_ParticleContext->m_PositionOffset = instanceLayout.FindElementByName(Utility::FileSystem::CRCFromString("a_Position"))->Offset;
+			s_ParticleContext->m_SizeOffset = instanceLayout.FindElementByName(Utility::FileSystem::CRCFromString("a_Size"))->Offset;
+			s_ParticleContext->m_ColorOffset = instanceLayout.FindElementByName(Utility::FileSystem::CRCFromString("a_Color"))->Offset;
 		}
 		
 		KG_VERIFY(s_ParticleContext, "Particle System Init");
@@ -65,8 +64,8 @@ namespace Kargono::Particles
     {
 		KG_ASSERT(s_ParticleContext);
 
-		// Clear input spec data
-		s_ParticleContext->m_ParticleRenderSpec.ClearData();
+		// Clear rendering data
+		s_ParticleContext->m_ParticleShader.reset();
 
 		// Terminate Static Variables
 		s_ParticleContext.reset();
@@ -77,6 +76,171 @@ namespace Kargono::Particles
 
 
 
+	//==============================
+	// Particle Kernels
+	//==============================
+	// Add a constant to every value in the stream
+	static void AddConstantKernel(float* values, float constant, size_t count)
+	{
+		using namespace Math::SIMD;
+
+		size_t index{ 0 };
+		Float4 constant4{ Splat(constant) };
+		for (; index + k_FloatWidth <= count; index += k_FloatWidth)
+		{
+			Store(values + index, Load(values + index) + constant4);
+		}
+		for (; index < count; index++)
+		{
+			values[index] += constant;
+		}
+	}
+
+	// position += velocity * deltaTime
+	static void IntegrateKernel(float* position, const float* velocity, float deltaTime, size_t count)
+	{
+		using namespace Math::SIMD;
+
+		size_t index{ 0 };
+		Float4 deltaTime4{ Splat(deltaTime) };
+		for (; index + k_FloatWidth <= count; index += k_FloatWidth)
+		{
+			Store(position + index, Load(position + index) + Load(velocity + index) * deltaTime4);
+		}
+		for (; index < count; index++)
+		{
+			position[index] += velocity[index] * deltaTime;
+		}
+	}
+
+	// progress = (currentTime - startTime) / (endTime - startTime)
+	static void ProgressKernel(const float* startTime, const float* endTime, float currentTime, 
+		float* progress, size_t count)
+	{
+		using namespace Math::SIMD;
+
+		size_t index{ 0 };
+		Float4 currentTime4{ Splat(currentTime) };
+		for (; index + k_FloatWidth <= count; index += k_FloatWidth)
+		{
+			Float4 start4{ Load(startTime + index) };
+			Store(progress + index, (currentTime4 - start4) / (Load(endTime + index) - start4));
+		}
+		for (; index < count; index++)
+		{
+			progress[index] = (currentTime - startTime[index]) / (endTime[index] - startTime[index]);
+		}
+	}
+
+	// Interpolate up to four channels (ex: r,g,b,a) between their begin/end values. All easing types 
+	//		are a linear interpolation of an eased progress value, so only the easing runs per particle.
+	template<size_t k_ChannelCount>
+	static void InterpolateKernel(const float* progress, size_t count, Math::EaseFloatFunction easeFunc,
+		const float* beginValues, const float* endValues, std::array<float*, k_ChannelCount> outputs)
+	{
+		using namespace Math::SIMD;
+
+		// Treat linear interpolation (and no interpolation) as an un-eased progress value
+		if (easeFunc == (Math::EaseFloatFunction)Math::Interpolation::Linear)
+		{
+			easeFunc = nullptr;
+		}
+
+		std::array<Float4, k_ChannelCount> begin4;
+		std::array<Float4, k_ChannelCount> range4;
+		for (size_t channel{ 0 }; channel < k_ChannelCount; channel++)
+		{
+			begin4[channel] = Splat(beginValues[channel]);
+			range4[channel] = Splat(endValues[channel] - beginValues[channel]);
+		}
+
+		size_t index{ 0 };
+		for (; index + k_FloatWidth <= count; index += k_FloatWidth)
+		{
+			// Apply the easing curve
+			Float4 progress4;
+			if (easeFunc)
+			{
+				float easedProgress[k_FloatWidth];
+				for (size_t lane{ 0 }; lane < k_FloatWidth; lane++)
+				{
+					easedProgress[lane] = easeFunc(0.0f, 1.0f, progress[index + lane]);
+				}
+				progress4 = Load(easedProgress);
+			}
+			else
+			{
+				progress4 = Load(progress + index);
+			}
+
+			for (size_t channel{ 0 }; channel < k_ChannelCount; channel++)
+			{
+				Store(outputs[channel] + index, begin4[channel] + range4[channel] * progress4);
+			}
+		}
+		for (; index < count; index++)
+		{
+			float easedProgress{ easeFunc ? easeFunc(0.0f, 1.0f, progress[index]) : progress[index] };
+			for (size_t channel{ 0 }; channel < k_ChannelCount; channel++)
+			{
+				outputs[channel][index] = beginValues[channel] + 
+					(endValues[channel] - beginValues[channel]) * easedProgress;
+			}
+		}
+	}
+
+	//==============================
+	// Particle Buffer Functions
+	//==============================
+	void ParticleBuffer::Resize(size_t capacity)
+	{
+		for (std::vector<float>* stream : 
+			{ &m_PositionX, &m_PositionY, &m_PositionZ, &m_VelocityX, &m_VelocityY, &m_VelocityZ,
+			&m_SizeX, &m_SizeY, &m_SizeZ, &m_ColorR, &m_ColorG, &m_ColorB, &m_ColorA,
+			&m_StartTime, &m_EndTime, &m_Progress })
+		{
+			stream->resize(capacity);
+		}
+
+		m_Capacity = capacity;
+		m_ActiveCount = 0;
+		m_NextRecycledIndex = 0;
+	}
+
+	size_t ParticleBuffer::Spawn()
+	{
+		KG_ASSERT(m_Capacity > 0);
+
+		// Append to the live particles if possible
+		if (m_ActiveCount < m_Capacity)
+		{
+			return m_ActiveCount++;
+		}
+
+		// Recycle an existing particle
+		size_t recycledIndex{ m_NextRecycledIndex };
+		m_NextRecycledIndex = (m_NextRecycledIndex + 1) % m_Capacity;
+		return recycledIndex;
+	}
+
+	void ParticleBuffer::Remove(size_t index)
+	{
+		KG_ASSERT(index < m_ActiveCount);
+
+		// Move the last live particle into the removed slot (size/color/progress are recalculated every tick)
+		size_t lastIndex{ m_ActiveCount - 1 };
+		for (std::vector<float>* stream : 
+			{ &m_PositionX, &m_PositionY, &m_PositionZ, &m_VelocityX, &m_VelocityY, &m_VelocityZ, 
+			&m_StartTime, &m_EndTime })
+		{
+			(*stream)[index] = (*stream)[lastIndex];
+		}
+		m_ActiveCount--;
+	}
+
+	//==============================
+	// Particle Service Functions
+	//==============================
     void ParticleService::OnUpdate(Timestep ts)
     {
 		KG_ASSERT(s_ParticleContext);
@@ -84,7 +248,9 @@ namespace Kargono::Particles
 		// Get current time
 		float currentTime{ EngineService::GetActiveEngine().GetInApplicationTime() };
 
-		size_t iteration{ 0 };
+		// Spawn particles (serially, since spawning shares the random generator)
+		std::vector<EmitterInstance*>& updatedEmitters{ s_ParticleContext->m_UpdatedEmitters };
+		updatedEmitters.clear();
 		for (auto& [uuid, emitter] : s_ParticleContext->m_AllEmitters)
 		{
 			// TODO: If a parent entity exists, maybe just set to inactive
@@ -129,6 +295,7 @@ namespace Kargono::Particles
 			}
 
 			// Spawn more particles
+			ParticleBuffer& particles{ emitter.m_Particles };
 			float spawnThreshold{ 1.0f / (float)emitter.m_Config->m_SpawnRatePerSec };
 			emitter.m_ParticleSpawnAccumulator += ts;
 			while (emitter.m_ParticleSpawnAccumulator > spawnThreshold)
@@ -137,73 +304,92 @@ namespace Kargono::Particles
 				emitter.m_ParticleSpawnAccumulator -= spawnThreshold;
 
 				// Spawn a particle
-				Particle& currentParticle = emitter.m_Particles[emitter.m_ParticleIndex];
-				currentParticle.m_Active = true;
+				size_t particleIndex{ particles.Spawn() };
 
 				// Set x,y,z position based on the bounds provide in the emitter's config
-				currentParticle.m_Position.x = emitter.m_Position.x + Utility::PseudoRandomService::GenerateFloatBounds
+				particles.m_PositionX[particleIndex] = emitter.m_Position.x + Utility::PseudoRandomService::GenerateFloatBounds
 				(
 					s_ParticleContext->m_RandomGenerator, 
 					emitter.m_Config->m_SpawningBounds[0].x,
 					emitter.m_Config->m_SpawningBounds[1].x
 				);
-				currentParticle.m_Position.y = emitter.m_Position.y + Utility::PseudoRandomService::GenerateFloatBounds
+				particles.m_PositionY[particleIndex] = emitter.m_Position.y + Utility::PseudoRandomService::GenerateFloatBounds
 				(
 					s_ParticleContext->m_RandomGenerator,
 					emitter.m_Config->m_SpawningBounds[0].y,
 					emitter.m_Config->m_SpawningBounds[1].y
 				);
-				currentParticle.m_Position.z = emitter.m_Position.z + Utility::PseudoRandomService::GenerateFloatBounds
+				particles.m_PositionZ[particleIndex] = emitter.m_Position.z + Utility::PseudoRandomService::GenerateFloatBounds
 				(
 					s_ParticleContext->m_RandomGenerator,
 					emitter.m_Config->m_SpawningBounds[0].z,
 					emitter.m_Config->m_SpawningBounds[1].z
 				);
 
-				currentParticle.m_StartTime = currentTime;
-				currentParticle.m_EndTime = currentTime + emitter.m_Config->m_ParticleLifetime;
-				currentParticle.m_Size = emitter.m_Config->m_SizeBegin;
+				particles.m_StartTime[particleIndex] = currentTime;
+				particles.m_EndTime[particleIndex] = currentTime + emitter.m_Config->m_ParticleLifetime;
 
 				//TODO: Generate random velocity TODO: CHANGE THIS
-				currentParticle.m_Velocity.x = Utility::PseudoRandomService::GenerateFloatBounds(s_ParticleContext->m_RandomGenerator, -1.0f, 1.0f);
-				currentParticle.m_Velocity.y = Utility::PseudoRandomService::GenerateFloatBounds(s_ParticleContext->m_RandomGenerator, -1.0f, 1.0f);
-				currentParticle.m_Velocity.z = 0.0f;
-
-				// Move iterator down
-				emitter.m_ParticleIndex = --emitter.m_ParticleIndex % emitter.m_Particles.size();
+				particles.m_VelocityX[particleIndex] = Utility::PseudoRandomService::GenerateFloatBounds(s_ParticleContext->m_RandomGenerator, -1.0f, 1.0f);
+				particles.m_VelocityY[particleIndex] = Utility::PseudoRandomService::GenerateFloatBounds(s_ParticleContext->m_RandomGenerator, -1.0f, 1.0f);
+				particles.m_VelocityZ[particleIndex] = 0.0f;
 			}
 
-			// Manage particles
-			for (Particles::Particle& particle : emitter.m_Particles)
-			{
-				// Check if particle is active
-				if (!particle.m_Active)
-				{
-					continue;
-				}
+			updatedEmitters.push_back(&emitter);
+		}
 
-				// Check particle lifetime
-				if (currentTime > particle.m_EndTime)
-				{
-					particle.m_Active = false;
-					continue;
-				}
+		// Manage particles. Emitters are independent, so they are simulated across the job workers.
+		JobService::ParallelFor(updatedEmitters.size(), 1, [&](size_t begin, size_t end)
+		{
+			for (size_t emitterIndex{ begin }; emitterIndex < end; emitterIndex++)
+			{
+				SimulateEmitter(*updatedEmitters[emitterIndex], currentTime, ts);
+			}
+		});
+    }
 
-				// Adjust velocity based on gravity if being used
-				if (emitter.m_Config->m_UseGravity)
-				{
-					particle.m_Velocity += emitter.m_Config->m_GravityAcceleration;
-				}
+	void ParticleService::SimulateEmitter(EmitterInstance& emitter, float currentTime, float deltaTime)
+	{
+		ParticleBuffer& particles{ emitter.m_Particles };
+		EmitterConfig& config{ *emitter.m_Config };
 
-				// Move particle based on velocity
-				particle.m_Position += particle.m_Velocity * (float)ts;
+		// Remove particles past their lifetime, keeping the live particles densely packed
+		for (size_t index{ 0 }; index < particles.m_ActiveCount;)
+		{
+			if (currentTime > particles.m_EndTime[index])
+			{
+				particles.Remove(index);
+				continue;
 			}
+			index++;
+		}
+		size_t count{ particles.m_ActiveCount };
 
-			iteration++;
-
+		// Adjust velocity based on gravity if being used
+		if (config.m_UseGravity)
+		{
+			AddConstantKernel(particles.m_VelocityX.data(), config.m_GravityAcceleration.x, count);
+			AddConstantKernel(particles.m_VelocityY.data(), config.m_GravityAcceleration.y, count);
+			AddConstantKernel(particles.m_VelocityZ.data(), config.m_GravityAcceleration.z, count);
 		}
 
-    }
+		// Move particles based on velocity
+		IntegrateKernel(particles.m_PositionX.data(), particles.m_VelocityX.data(), deltaTime, count);
+		IntegrateKernel(particles.m_PositionY.data(), particles.m_VelocityY.data(), deltaTime, count);
+		IntegrateKernel(particles.m_PositionZ.data(), particles.m_VelocityZ.data(), deltaTime, count);
+
+		// Calculate size/color interpolation
+		ProgressKernel(particles.m_StartTime.data(), particles.m_EndTime.data(), currentTime, 
+			particles.m_Progress.data(), count);
+		InterpolateKernel<3>(particles.m_Progress.data(), count, 
+			Math::Interpolation::GetEasingFunctionFloat(config.m_SizeInterpolationType),
+			&config.m_SizeBegin.x, &config.m_SizeEnd.x, 
+			{ particles.m_SizeX.data(), particles.m_SizeY.data(), particles.m_SizeZ.data() });
+		InterpolateKernel<4>(particles.m_Progress.data(), count,
+			Math::Interpolation::GetEasingFunctionFloat(config.m_ColorInterpolationType),
+			&config.m_ColorBegin.x, &config.m_ColorEnd.x,
+			{ particles.m_ColorR.data(), particles.m_ColorG.data(), particles.m_ColorB.data(), particles.m_ColorA.data() });
+	}
 
 	void ParticleService::OnRender(const Math::mat4& viewProjection)
 	{
@@ -212,67 +398,40 @@ namespace Kargono::Particles
 		// Start rendering context
 		Rendering::RenderingService::BeginScene(viewProjection);
 
-		// Get current time
-		float currentTime{ EngineService::GetActiveEngine().GetInApplicationTime() };
-
+		std::vector<uint8_t>& instanceData{ s_ParticleContext->m_InstanceData };
+		uint32_t instanceStride{ s_ParticleContext->m_InstanceStride };
 		for (auto& [uuid, emitter] : s_ParticleContext->m_AllEmitters)
 		{
-			// Get color/size interpolation functions
-			Math::EaseVec3Function sizeEaseFunc
+			// Only live particles are stored in the active range
+			ParticleBuffer& particles{ emitter.m_Particles };
+			size_t particleCount{ particles.GetActiveCount() };
+			if (particleCount == 0)
 			{
-				Math::Interpolation::GetEasingFunctionVec3(emitter.m_Config->m_SizeInterpolationType)
-			};
-
-			Math::EaseVec4Function colorEaseFunc
-			{
-				Math::Interpolation::GetEasingFunctionVec4(emitter.m_Config->m_ColorInterpolationType)
-			};
+				continue;
+			}
 
-			for (Particles::Particle& particle : emitter.m_Particles)
+			// Interleave the particle streams into one instance per particle
+			instanceData.resize(particleCount * instanceStride);
+			for (size_t index{ 0 }; index < particleCount; index++)
 			{
-				// Check if particle is active
-				if (!particle.m_Active)
-				{
-					continue;
-				}
-
-				// Calculate lerp progress value
-				float progress{ (currentTime - particle.m_StartTime) / (particle.m_EndTime - particle.m_StartTime) };
-
-				// Calculate size interpolation
-				Math::vec3 size = sizeEaseFunc
-				(
-					emitter.m_Config->m_SizeBegin, 
-					emitter.m_Config->m_SizeEnd, progress
-				);
-
-				// Create background rendering data
-				s_ParticleContext->m_ParticleRenderSpec.m_TransformMatrix = 
-					glm::translate(Math::mat4(1.0f), particle.m_Position) * 
-					glm::scale(glm::mat4(1.0f), { size.x, size.y, size.z });
-
-				// Submit a color based on the current interpolation
-				Rendering::Shader::SetDataAtInputLocation<Math::vec4>
-				(
-					colorEaseFunc
-					(
-						emitter.m_Config->m_ColorBegin, 
-						emitter.m_Config->m_ColorEnd, 
-						progress
-					),
-					Utility::FileSystem::CRCFromString("a_Color"),
-					s_ParticleContext->m_ParticleRenderSpec.m_Buffer, 
-					s_ParticleContext->m_ParticleRenderSpec.m_Shader
-				);
-
-				// Render the particle
-				Rendering::RenderingService::SubmitDataToRenderer(s_ParticleContext->m_ParticleRenderSpec);
+				uint8_t* instance{ instanceData.data() + index * instanceStride };
+				Math::vec3 position{ particles.m_PositionX[index], particles.m_PositionY[index], particles.m_PositionZ[index] };
+				Math::vec3 size{ particles.m_SizeX[index], particles.m_SizeY[index], particles.m_SizeZ[index] };
+				Math::vec4 color{ particles.m_ColorR[index], particles.m_ColorG[index], particles.m_ColorB[index], particles.m_ColorA[index] };
+				memcpy(instance + s_ParticleContext->m_PositionOffset, &position, sizeof(Math::vec3));
+				memcpy(instance + s_ParticleContext->m_SizeOffset, &size, sizeof(Math::vec3));
+				memcpy(instance + s_ParticleContext->m_ColorOffset, &color, sizeof(Math::vec4));
 			}
+
+			// Upload and draw all of the emitter's particles at once
+			Rendering::RenderingService::SubmitInstancesToRenderer(s_ParticleContext->m_ParticleShader, 
+				instanceData.data(), (uint32_t)particleCount);
 		}
 
-		// End rendering context and submit rendering data to GPU
+		// End rendering context
 		Rendering::RenderingService::EndScene();
 	}
+
 	bool ParticleService::OnSceneEvent(Events::Event* event)
 	{
 		if (event->GetEventType() == Events::EventType::ManageEntity)
@@ -327,9 +486,8 @@ namespace Kargono::Particles
 		UUID returnID{};
 		EmitterInstance newEmitterInstance;
 		newEmitterInstance.m_Config = config;
-		newEmitterInstance.m_Particles.resize(config->m_BufferSize);
+		newEmitterInstance.m_Particles.Resize(config->m_BufferSize);
 		newEmitterInstance.m_Position = position;
-		newEmitterInstance.m_ParticleIndex = config->m_BufferSize - 1;
 		newEmitterInstance.m_StartTime = currentTime;
 		newEmitterInstance.m_EndTime = currentTime + config->m_EmitterLifetime;
 
@@ -371,10 +529,9 @@ namespace Kargono::Particles
 		UUID returnID{};
 		EmitterInstance newEmitterInstance;
 		newEmitterInstance.m_Config = config;
-		newEmitterInstance.m_Particles.resize(config->m_BufferSize);
+		newEmitterInstance.m_Particles.Resize(config->m_BufferSize);
 		newEmitterInstance.m_ParentScene = parentScene;
 		newEmitterInstance.m_ParentEntityID = entityID;
-		newEmitterInstance.m_ParticleIndex = config->m_BufferSize - 1;
 		newEmitterInstance.m_StartTime = currentTime;
 		newEmitterInstance.m_EndTime = currentTime + config->m_EmitterLifetime;
 
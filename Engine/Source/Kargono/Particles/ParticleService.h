@@ -50,25 +50,65 @@ namespace Kargono::Particles
 		Math::vec3 m_SizeEnd{ 1.0f };
 	};
 
-    struct Particle
-    {
+	// Structure-of-arrays particle storage. Live particles are kept densely packed in
+	//		[0, GetActiveCount()), so updates run straight through the arrays without checking
+	//		per-particle active flags.
+	struct ParticleBuffer
+	{
 	public:
-        // Particle transform 
-        Math::vec3 m_Position;
-		Math::vec3 m_Size;
-		Math::vec3 m_Rotation;
+		//==============================
+		// Manage Particles
+		//==============================
+		void Resize(size_t capacity);
+		// Returns the index of a newly activated particle. Once the buffer is full, existing 
+		//		particles are recycled in round-robin order.
+		size_t Spawn();
+		// Remove the particle by moving the last live particle into its slot
+		void Remove(size_t index);
 
-		// Particle physics information
-		Math::vec3 m_Velocity;
+		//==============================
+		// Getters/Setters
+		//==============================
+		size_t GetActiveCount() const
+		{
+			return m_ActiveCount;
+		}
+		size_t GetCapacity() const
+		{
+			return m_Capacity;
+		}
+	public:
+		// Particle transform
+		std::vector<float> m_PositionX;
+		std::vector<float> m_PositionY;
+		std::vector<float> m_PositionZ;
 
-		bool m_Active{ false };
+		// Particle physics information
+		std::vector<float> m_VelocityX;
+		std::vector<float> m_VelocityY;
+		std::vector<float> m_VelocityZ;
+
+		// Interpolated size/color (updated every tick)
+		std::vector<float> m_SizeX;
+		std::vector<float> m_SizeY;
+		std::vector<float> m_SizeZ;
+		std::vector<float> m_ColorR;
+		std::vector<float> m_ColorG;
+		std::vector<float> m_ColorB;
+		std::vector<float> m_ColorA;
 	private:
-        // Particle lifetime information
-		float m_StartTime;
-		float m_EndTime;
+		// Particle lifetime information
+		std::vector<float> m_StartTime;
+		std::vector<float> m_EndTime;
+		// Lifetime progress [0, 1] (scratch data for interpolation)
+		std::vector<float> m_Progress;
+
+		size_t m_ActiveCount{ 0 };
+		size_t m_Capacity{ 0 };
+		size_t m_NextRecycledIndex{ 0 };
 	private:
 		friend class ParticleService;
-    };
+	};
 
 	struct EmitterInstance
 	{
@@ -77,8 +117,7 @@ namespace Kargono::Particles
 		Scenes::Scene* m_ParentScene{ nullptr };
 		UUID m_ParentEntityID{ k_EmptyUUID };
 		EmitterConfig* m_Config;
-		std::vector<Particle> m_Particles;
-		size_t m_ParticleIndex;
+		ParticleBuffer m_Particles;
 		float m_ParticleSpawnAccumulator{ 0.0f };
 
 		// Emitter lifetime information
@@ -114,6 +153,9 @@ namespace Kargono::Particles
 		static std::unordered_map<UUID, EmitterInstance>& GetAllEmitters();
 
 		static void LoadSceneEmitters(Ref<Scenes::Scene> scene);
+	private:
+		// Remove expired particles, then integrate and interpolate the live particles
+		static void SimulateEmitter(EmitterInstance& emitter, float currentTime, float deltaTime);
     };
 }
 
@@ -380,6 +380,16 @@ namespace Kargono::Projects
 		project->m_ServerConfig.m_ServerAddress.SetNewPort(static_cast<uint16_t>(rootNode["ServerPort"].as<uint32_t>()));
 		project->m_ServerConfig.m_ServerLocation = Utility::StringToServerLocation(rootNode["ServerLocation"].as<std::string>());
 
+		// Session hosting (optional for older config files)
+		if (rootNode["MaxSessions"])
+		{
+			project->m_ServerConfig.m_MaxSessions = rootNode["MaxSessions"].as<size_t>();
+		}
+		if (rootNode["SessionWorkers"])
+		{
+			project->m_ServerConfig.m_SessionWorkerCount = rootNode["SessionWorkers"].as<size_t>();
+		}
+
 		project->m_ServerConfig.m_ValidationSecrets.x = rootNode["SecretOne"].as<uint64_t>();
 		project->m_ServerConfig.m_ValidationSecrets.y = rootNode["SecretTwo"].as<uint64_t>();
 		project->m_ServerConfig.m_ValidationSecrets.z = rootNode["SecretThree"].as<uint64_t>();
@@ -478,6 +488,9 @@ namespace Kargono::Projects
 				out << YAML::Key << "ScriptDLLPath" << YAML::Value << project->ScriptDLLPath.string();
 				out << YAML::Key << "DefaultFullscreen" << YAML::Value << project->DefaultFullscreen;
 				out << YAML::Key << "TargetResolution" << YAML::Value << Utility::ScreenResolutionToString(project->TargetResolution);
+				out << YAML::Key << "TextureMemoryBudget" << YAML::Value << project->TextureMemoryBudget;
+				out << YAML::Key << "AudioMemoryBudget" << YAML::Value << project->AudioMemoryBudget;
+				out << YAML::Key << "FontMemoryBudget" << YAML::Value << project->FontMemoryBudget;
 				out << YAML::Key << "OnRuntimeStart" << YAML::Value << static_cast<uint64_t>(project->OnRuntimeStart);
 				out << YAML::Key << "OnUpdateUserCount" << YAML::Value << static_cast<uint64_t>(project->OnUpdateUserCount);
 				out << YAML::Key << "OnApproveJoinSession" << YAML::Value << static_cast<uint64_t>(project->OnApproveJoinSession);
@@ -538,6 +551,10 @@ namespace Kargono::Projects
 		project->ScriptDLLPath = projectNode["ScriptDLLPath"].as<std::string>();
 		project->DefaultFullscreen = projectNode["DefaultFullscreen"].as<bool>();
 		project->TargetResolution = Utility::StringToScreenResolution(projectNode["TargetResolution"].as<std::string>());
+		// Memory budgets are optional, since older projects do not have them
+		project->TextureMemoryBudget = projectNode["TextureMemoryBudget"] ? projectNode["TextureMemoryBudget"].as<uint64_t>() : 0;
+		project->AudioMemoryBudget = projectNode["AudioMemoryBudget"] ? projectNode["AudioMemoryBudget"].as<uint64_t>() : 0;
+		project->FontMemoryBudget = projectNode["FontMemoryBudget"] ? projectNode["FontMemoryBudget"].as<uint64_t>() : 0;
 		project->OnRuntimeStart = static_cast<Assets::AssetHandle>(projectNode["OnRuntimeStart"].as<uint64_t>());
 		project->OnUpdateUserCount = static_cast<Assets::AssetHandle>(projectNode["OnUpdateUserCount"].as<uint64_t>());
 		project->OnApproveJoinSession = static_cast<Assets::AssetHandle>(projectNode["OnApproveJoinSession"].as<uint64_t>());
@@ -57,6 +57,11 @@ namespace Kargono::Projects
 		// TargetResolution describes the screen resolution the application will attempt
 		//		to display when starting the runtime application.
 		ScreenResolution TargetResolution{ ScreenResolution::MatchDevice };
+		// These budgets limit the bytes held by the texture, audio, and font asset caches. Assets
+		//		that are no longer referenced are evicted once a budget is exceeded. Zero disables the limit.
+		uint64_t TextureMemoryBudget{ 0 };
+		uint64_t AudioMemoryBudget{ 0 };
+		uint64_t FontMemoryBudget{ 0 };
 		// OnRuntimeStartFunction holds the name of the custom call that is run when
 		//		the application is started.
 		Assets::AssetHandle OnRuntimeStart {Assets::EmptyHandle};
@@ -220,6 +225,23 @@ namespace Kargono::Projects
 			KG_ASSERT(s_ActiveProject);
 			s_ActiveProject->TargetResolution = option;
 		}
+		// These functions return the asset cache memory budgets of the current project
+		//		in s_ActiveProject.
+		static uint64_t GetActiveTextureMemoryBudget()
+		{
+			KG_ASSERT(s_ActiveProject);
+			return s_ActiveProject->TextureMemoryBudget;
+		}
+		static uint64_t GetActiveAudioMemoryBudget()
+		{
+			KG_ASSERT(s_ActiveProject);
+			return s_ActiveProject->AudioMemoryBudget;
+		}
+		static uint64_t GetActiveFontMemoryBudget()
+		{
+			KG_ASSERT(s_ActiveProject);
+			return s_ActiveProject->FontMemoryBudget;
+		}
 		// This function sets the starting scene of the current project in s_ActiveProject.
 		static void SetActiveStartingSceneHandle(Assets::AssetHandle handle)
 		{
@@ -22,6 +22,13 @@ namespace Kargono::Rendering
 #endif
 	}
 
+	Ref<VertexBuffer> VertexBuffer::CreateStreaming(uint32_t regionSize)
+	{
+#ifdef KG_RENDERER_OPENGL
+		return CreateRef<API::RenderingAPI::OpenGLStreamingVertexBuffer>(regionSize);
+#endif
+	}
+
 	Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count)
 	{
 #ifdef KG_RENDERER_OPENGL
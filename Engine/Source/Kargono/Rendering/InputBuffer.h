@@ -195,9 +195,22 @@ namespace Kargono::Rendering
 		virtual const InputBufferLayout& GetLayout() const = 0;
 		virtual void SetLayout(const InputBufferLayout& layout) = 0;
 
+		// Streaming buffers are persistently mapped, so vertices are written straight into GPU visible
+		//		memory instead of being uploaded with SetData(). Returns a pointer to a range of the provided
+		//		size whose byte offset in the buffer is a multiple of the alignment, or nullptr if every
+		//		region has been written since the last call to FenceStreamRanges().
+		virtual uint8_t* AllocateStreamRange(uint32_t size, uint32_t alignment, uint32_t& offset) { return nullptr; }
+		// Marks every range allocated so far as read by the draw calls submitted so far. The ranges are
+		//		reused once the GPU finishes those draw calls.
+		virtual void FenceStreamRanges() {}
 
 		static Ref<VertexBuffer> Create(uint32_t size);
 		static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
+		// Creates a streaming buffer split into k_StreamRegionCount regions of the provided size
+		static Ref<VertexBuffer> CreateStreaming(uint32_t regionSize);
+	public:
+		// Number of regions in a streaming buffer. The CPU writes one region while the GPU reads the others.
+		static constexpr uint32_t k_StreamRegionCount{ 3 };
 	};
 	// Currently Kargono only supports 32-bit index buffers
 	class IndexBuffer
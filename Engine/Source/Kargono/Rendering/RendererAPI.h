@@ -30,10 +30,13 @@ namespace Kargono::Rendering
 		static void Clear();
 
 		static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0);
-		static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t* indexPointer, uint32_t indexCount);
-		static void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount);
-		static void DrawPoints(const Ref<VertexArray>& vertexArray, uint32_t vertexCount);
-		static void DrawTriangles(const Ref<VertexArray>& vertexArray, uint32_t vertexCount);
+		// The base vertex is added to every index, and the first vertex offsets the drawn range. Both allow
+		//		drawing a range of a streaming vertex buffer.
+		static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t* indexPointer, uint32_t indexCount, uint32_t baseVertex = 0);
+		static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount);
+		static void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0);
+		static void DrawPoints(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0);
+		static void DrawTriangles(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0);
 		static void SetLineWidth(float width);
 		static void SetPointWidth(float size);
 	};
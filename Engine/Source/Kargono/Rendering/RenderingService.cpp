@@ -3,6 +3,7 @@
 #include "Kargono/Rendering/RenderingService.h"
 #include "Kargono/Rendering/Shader.h"
 #include "Kargono/Rendering/Texture.h"
+#include "Kargono/Rendering/TextureResidency.h"
 #include "Kargono/Rendering/VertexArray.h"
 #include "Kargono/Rendering/UniformBuffer.h"
 #include "Kargono/Projects/Project.h"
@@ -10,6 +11,13 @@
 
 namespace Kargono::Rendering
 {
+	// Entry of the render queue that orders a DrawCallBuffer by its sort key
+	struct DrawPacket
+	{
+		uint64_t m_SortKey{ 0 };
+		uint32_t m_DrawCallIndex{ 0 };
+	};
+
 	struct RendererData
 	{
 		static const uint32_t MaxQuads = 20000;
@@ -33,10 +41,90 @@ namespace Kargono::Rendering
 		static const uint32_t MaxTextureSlots = 32;
 		static const uint32_t MaxIndicesBuffer = 1000;
 		std::vector<Ref<DrawCallBuffer>> DrawCalls;
+		uint8_t RenderLayer{ 0 };
+
+		// Render Queue
+		std::vector<DrawPacket> DrawPackets;
+		std::vector<DrawPacket> SortScratch;
+		// GL state issued during the current flush, used to skip redundant binds
+		Shader* BoundShader{ nullptr };
+		std::array<uint32_t, MaxTextureSlots> BoundTextures{};
 	};
 
 	static RendererData s_Data;
 
+	//==============================
+	// Draw Packet Sort Keys
+	//==============================
+	// Keys are ordered by, from the most significant bits:
+	//		[63..56] render layer
+	//		[55]     translucency, so translucent draws follow every opaque draw of their layer
+	//		opaque:      [54..40] shader, [39..24] texture set, [23..0] submission order
+	//		translucent: [23..0] submission order, which keeps them in painter's order
+	static constexpr uint32_t k_SortKeyLayerShift{ 56 };
+	static constexpr uint32_t k_SortKeyTranslucentShift{ 55 };
+	static constexpr uint32_t k_SortKeyShaderShift{ 40 };
+	static constexpr uint32_t k_SortKeyTextureSetShift{ 24 };
+	static constexpr uint64_t k_SortKeyShaderMask{ (1 << 15) - 1 };
+	static constexpr uint64_t k_SortKeyTextureSetMask{ (1 << 16) - 1 };
+	static constexpr uint64_t k_SortKeySequenceMask{ (1 << 24) - 1 };
+
+	static bool IsShaderTranslucent(const ShaderSpecification& specification)
+	{
+		// Text glyphs, circles, and outlines rely on alpha blended edges
+		return specification.TextureInput == TextureInputType::TextTexture ||
+			specification.AddCircleShape || specification.DrawOutline;
+	}
+
+	static uint64_t GetTextureSetID(const DrawCallBuffer& buffer)
+	{
+		// Collisions only affect how buffers are grouped, since texture binds are tracked per slot
+		uint64_t hash{ 14695981039346656037ull };
+		for (const Ref<Texture2D>& texture : buffer.m_Textures)
+		{
+			hash = (hash ^ reinterpret_cast<uintptr_t>(texture.get())) * 1099511628211ull;
+		}
+		for (uint32_t arrayIndex : buffer.m_TextureArrays)
+		{
+			hash = (hash ^ arrayIndex) * 1099511628211ull;
+		}
+		return (hash ^ (hash >> 16) ^ (hash >> 32) ^ (hash >> 48)) & k_SortKeyTextureSetMask;
+	}
+
+	static void RadixSortDrawPackets(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch)
+	{
+		// Least significant digit radix sort over the bytes of the sort key. The sort is stable,
+		//		so packets with equal keys keep their submission order.
+		scratch.resize(packets.size());
+		for (uint32_t shift{ 0 }; shift < 64; shift += 8)
+		{
+			std::array<size_t, 256> offsets{};
+			for (const DrawPacket& packet : packets)
+			{
+				offsets[(packet.m_SortKey >> shift) & 0xFF]++;
+			}
+
+			// Skip passes where every key shares the same byte
+			if (offsets[(packets.front().m_SortKey >> shift) & 0xFF] == packets.size())
+			{
+				continue;
+			}
+
+			size_t total{ 0 };
+			for (size_t& offset : offsets)
+			{
+				size_t count = offset;
+				offset = total;
+				total += count;
+			}
+			for (const DrawPacket& packet : packets)
+			{
+				scratch[offsets[(packet.m_SortKey >> shift) & 0xFF]++] = packet;
+			}
+			packets.swap(scratch);
+		}
+	}
+
 
 
 	void RenderingService::OnWindowResize(uint32_t width, uint32_t height)
@@ -49,9 +137,11 @@ namespace Kargono::Rendering
 		KG_ASSERT(Projects::ProjectService::GetActive(), "No valid project is active while trying to initialize shaders!");
 		s_Data.CameraUniformBuffer = UniformBuffer::Create(sizeof(RendererData::CameraData), 0);
 		KG_VERIFY(s_Data.CameraUniformBuffer, "Renderer Init")
+		TextureResidencyService::Init();
 	}
 	void RenderingService::Shutdown()
 	{
+		TextureResidencyService::Terminate();
 		s_Data.CameraUniformBuffer.reset();
 		s_Data.DrawCalls.clear();
 	}
@@ -86,6 +176,15 @@ namespace Kargono::Rendering
 		s_Data.LineWidth = width;
 	}
 
+	uint8_t RenderingService::GetRenderLayer()
+	{
+		return s_Data.RenderLayer;
+	}
+	void RenderingService::SetRenderLayer(uint8_t layer)
+	{
+		s_Data.RenderLayer = layer;
+	}
+
 	void RenderingService::ResetStats()
 	{
 		memset(&s_Data.Stats, 0, sizeof(Statistics));
@@ -97,33 +196,43 @@ namespace Kargono::Rendering
 
 	void RenderingService::FillTextureIndex(RendererInputSpec& inputSpec)
 	{
-		//if (s_Data.QuadIndexCount >= RendererData::MaxIndices) { NextBatch(); }
 		KG_ASSERT(inputSpec.m_ShapeComponent->Texture, "Texture shader added, however, no texture is available in ShapeComponent.");
-		auto& m_Textures = inputSpec.m_CurrentDrawBuffer->m_Textures;
-		float textureIndex = -1.0f;
 
-		uint32_t iteration = 0;
-		for (auto& texture : m_Textures)
+		// Textures are sampled from the layer of a resident texture array. Negative indices sample nothing.
+		TextureResidency residency{};
+		if (!TextureResidencyService::GetResidency(inputSpec.m_ShapeComponent->Texture, residency))
 		{
-			if (texture == inputSpec.m_ShapeComponent->Texture)
-			{
-				textureIndex = (float)iteration;
-				break;
-			}
-			iteration++;
+			Shader::SetDataAtInputLocation<float>(-1.0f,
+				Utility::FileSystem::CRCFromString("a_TexIndex"),
+				inputSpec.m_Buffer, inputSpec.m_Shader);
+			return;
 		}
-		if (static_cast<int32_t>(textureIndex) == -1)
+
+		// Find the slot of the texture's array inside the current draw call, starting a new draw call
+		//		if every slot is taken
+		std::vector<uint32_t>* textureArrays = &inputSpec.m_CurrentDrawBuffer->m_TextureArrays;
+		auto arrayLocation = std::find(textureArrays->begin(), textureArrays->end(), residency.m_ArrayIndex);
+		if (arrayLocation == textureArrays->end())
 		{
-			if (m_Textures.size() >= RendererData::MaxTextureSlots)
+			if (textureArrays->size() >= RendererData::MaxTextureSlots)
 			{
-				textureIndex = 0.0f;
-				// TODO: NextBatch, Create a new DrawCallBuffer for the current shader and update Textures Ref
+				Ref<DrawCallBuffer> newDrawCallBuffer = CreateDrawCallBuffer(inputSpec.m_Shader);
+				if (!newDrawCallBuffer)
+				{
+					return;
+				}
+				inputSpec.m_CurrentDrawBuffer = newDrawCallBuffer;
+				textureArrays = &newDrawCallBuffer->m_TextureArrays;
 			}
-			m_Textures.push_back(inputSpec.m_ShapeComponent->Texture);
-			textureIndex = static_cast<float>(m_Textures.size() - 1);
+			textureArrays->push_back(residency.m_ArrayIndex);
+			arrayLocation = textureArrays->end() - 1;
 		}
+		uint32_t textureSlot = static_cast<uint32_t>(arrayLocation - textureArrays->begin());
 
-		Shader::SetDataAtInputLocation<float>(textureIndex, 
+		// Pack the slot, layer, and minimum mip level into a single index. See AddTextureOutput() in ShaderBuilder.
+		uint32_t textureIndex = (textureSlot * TextureResidencyService::k_MaxLayerCount + residency.m_Layer) * 
+			TextureResidencyService::k_MaxMipCount + residency.m_MinLevel;
+		Shader::SetDataAtInputLocation<float>(static_cast<float>(textureIndex), 
 			Utility::FileSystem::CRCFromString("a_TexIndex"),
 			inputSpec.m_Buffer, inputSpec.m_Shader);
 	}
@@ -137,56 +246,115 @@ namespace Kargono::Rendering
 		m_Textures.emplace_back(inputSpec.m_ShapeComponent->Texture);
 	}
 
-	void RenderingService::FillTextureCoordinate(RendererInputSpec& inputSpec, uint32_t iteration)
+	// Writes whole vertex runs for a single input layout. Every combination of per-vertex inputs is
+	//		instantiated, so the inner loop has no per-vertex dispatch or input lookups.
+	template<bool k_TransformPosition, bool k_TextureCoordinate, bool k_VertexColor, bool k_LocalPosition>
+	static void FillVertices(const RendererInputSpec& inputSpec, const VertexFillOffsets& offsets, uint8_t* destination)
 	{
-		const Math::vec2& coordinates = inputSpec.m_ShapeComponent->TextureCoordinates->at(iteration);
-		Shader::SetDataAtInputLocation<Math::vec2>(coordinates, 
-			Utility::FileSystem::CRCFromString("a_TexCoord"),
-			inputSpec.m_Buffer, 
-			inputSpec.m_Shader);
-	}
+		const std::vector<Math::vec3>& vertices = *inputSpec.m_ShapeComponent->Vertices;
+		const std::size_t stride = inputSpec.m_Buffer.Size;
+		const Math::mat4 transform = inputSpec.m_TransformMatrix;
+		const Math::vec2* textureCoordinates{ nullptr };
+		const Math::vec4* colors{ nullptr };
+		if constexpr (k_TextureCoordinate)
+		{
+			KG_ASSERT(inputSpec.m_ShapeComponent->TextureCoordinates->size() >= vertices.size(), "Shape has fewer texture coordinates than vertices");
+			textureCoordinates = inputSpec.m_ShapeComponent->TextureCoordinates->data();
+		}
+		if constexpr (k_VertexColor)
+		{
+			KG_ASSERT(inputSpec.m_ShapeComponent->VertexColors->size() >= vertices.size(), "Shape has fewer vertex colors than vertices");
+			colors = inputSpec.m_ShapeComponent->VertexColors->data();
+		}
 
-	void RenderingService::FillLocalPosition(RendererInputSpec& inputSpec, uint32_t iteration)
-	{
-		const Math::vec3& localPosition = inputSpec.m_ShapeComponent->Vertices->at(iteration) * 2.0f;
-		Shader::SetDataAtInputLocation<Math::vec3>(localPosition, 
-			Utility::FileSystem::CRCFromString("a_LocalPosition"),
-			inputSpec.m_Buffer, inputSpec.m_Shader);
-	}
+		for (std::size_t iteration{ 0 }; iteration < vertices.size(); iteration++)
+		{
+			// Per-object inputs, such as the entity ID and texture index, are shared by every vertex
+			memcpy(destination, inputSpec.m_Buffer.Data, stride);
 
-	void RenderingService::FillWorldPosition(RendererInputSpec& inputSpec, uint32_t iteration)
-	{
-		const Math::vec3& localPosition = inputSpec.m_ShapeComponent->Vertices->at(iteration);
-		Math::vec3 worldPosition = inputSpec.m_TransformMatrix * Math::vec4(localPosition, 1.0f);
-		Shader::SetDataAtInputLocation<Math::vec3>(worldPosition, 
-			Utility::FileSystem::CRCFromString("a_Position"),
-			inputSpec.m_Buffer, inputSpec.m_Shader);
+			const Math::vec3& localPosition = vertices[iteration];
+			if constexpr (k_TransformPosition)
+			{
+				Math::vec3 worldPosition = transform * Math::vec4(localPosition, 1.0f);
+				memcpy(destination + offsets.m_Position, &worldPosition, sizeof(Math::vec3));
+			}
+			else
+			{
+				memcpy(destination + offsets.m_Position, &localPosition, sizeof(Math::vec3));
+			}
+			if constexpr (k_TextureCoordinate)
+			{
+				memcpy(destination + offsets.m_TextureCoordinate, &textureCoordinates[iteration], sizeof(Math::vec2));
+			}
+			if constexpr (k_VertexColor)
+			{
+				memcpy(destination + offsets.m_Color, &colors[iteration], sizeof(Math::vec4));
+			}
+			if constexpr (k_LocalPosition)
+			{
+				Math::vec3 circlePosition = localPosition * 2.0f;
+				memcpy(destination + offsets.m_LocalPosition, &circlePosition, sizeof(Math::vec3));
+			}
+			destination += stride;
+		}
 	}
 
-
-	void RenderingService::FillWorldPositionNoTransform(RendererInputSpec& inputSpec, uint32_t iteration)
+	// Fill functions indexed by a bit mask of their per-vertex inputs
+	template<std::size_t... k_Masks>
+	static constexpr std::array<VertexFillFunction, sizeof...(k_Masks)> CreateVertexFillFunctions(std::index_sequence<k_Masks...>)
 	{
-		const Math::vec3& localPosition = inputSpec.m_ShapeComponent->Vertices->at(iteration);
-
-		Shader::SetDataAtInputLocation<Math::vec3>(localPosition, 
-			Utility::FileSystem::CRCFromString("a_Position"),
-			inputSpec.m_Buffer, inputSpec.m_Shader);
+		return { &FillVertices<(k_Masks & 1) != 0, (k_Masks & 2) != 0, (k_Masks & 4) != 0, (k_Masks & 8) != 0>... };
 	}
+	static constexpr std::array<VertexFillFunction, 16> s_VertexFillFunctions = CreateVertexFillFunctions(std::make_index_sequence<16>());
 
-	void RenderingService::FillVertexColor(RendererInputSpec& inputSpec, uint32_t iteration)
+	VertexFillFunction RenderingService::SelectVertexFillFunction(const ShaderSpecification& specification, 
+		InputBufferLayout& layout, VertexFillOffsets& offsets)
 	{
-		auto& colorVector = inputSpec.m_ShapeComponent->VertexColors;
-		KG_ASSERT(iteration < static_cast<uint32_t>(colorVector->size()), "Invalid iteration inside FillVertexColor function");
-		Shader::SetDataAtInputLocation<Math::vec4>(colorVector->at(iteration), 
-			Utility::FileSystem::CRCFromString("a_Color"),
-			inputSpec.m_Buffer, inputSpec.m_Shader);
+		// Locates an input in the layout. Inputs the layout does not contain are skipped.
+		auto findInput = [&](const char* inputName, uint32_t& offset) -> bool
+		{
+			InputBufferElement* element = layout.FindElementByName(Utility::FileSystem::CRCFromString(inputName));
+			if (!element)
+			{
+				return false;
+			}
+			offset = static_cast<uint32_t>(element->Offset);
+			return true;
+		};
+
+		offsets = {};
+		std::size_t mask{ 0 };
+		if (!findInput("a_Position", offsets.m_Position))
+		{
+			KG_WARN("Shader input layout does not contain a position input");
+			return nullptr;
+		}
+		if (specification.RenderType != RenderingType::DrawLine &&
+			specification.RenderType != RenderingType::DrawPoint &&
+			specification.TextureInput != TextureInputType::TextTexture)
+		{
+			mask |= 1;
+		}
+		if (specification.TextureInput != TextureInputType::None && findInput("a_TexCoord", offsets.m_TextureCoordinate))
+		{
+			mask |= 2;
+		}
+		if (specification.ColorInput == ColorInputType::VertexColor && findInput("a_Color", offsets.m_Color))
+		{
+			mask |= 4;
+		}
+		if (specification.AddCircleShape && findInput("a_LocalPosition", offsets.m_LocalPosition))
+		{
+			mask |= 8;
+		}
+		return s_VertexFillFunctions[mask];
 	}
 
 	void RenderingService::FillIndicesData(RendererInputSpec& inputSpec)
 	{
 		// Upload Indices
 		Ref<DrawCallBuffer> drawCallBuffer = inputSpec.m_Shader->GetCurrentDrawCallBuffer();
-		std::size_t currentBufferSize = (drawCallBuffer->m_VertexBufferIterator - drawCallBuffer->m_VertexBuffer.Data) / inputSpec.m_Shader->GetInputLayout().GetStride();
+		std::size_t currentBufferSize = (drawCallBuffer->m_VertexBufferIterator - drawCallBuffer->m_VertexBufferStart) / inputSpec.m_Shader->GetInputLayout().GetStride();
 		for (auto& index : *(inputSpec.m_ShapeComponent->Indices))
 		{
 			drawCallBuffer->m_IndexBuffer.push_back(static_cast<uint32_t>(currentBufferSize) + index);
@@ -200,116 +368,229 @@ namespace Kargono::Rendering
 			inputSpec.m_Buffer, inputSpec.m_Shader);
 	}
 
+	void RenderingService::SubmitInstancesToRenderer(Ref<Shader> shader, const uint8_t* instanceData, uint32_t instanceCount)
+	{
+		KG_ASSERT(shader->GetSpecification().DrawInstanced, "Attempt to submit instances with a shader that is not instanced");
+		if (instanceCount == 0) { return; }
+
+		Ref<VertexArray> vertexArray = shader->GetVertexArray();
+		Ref<VertexBuffer> instanceBuffer = vertexArray->GetVertexBuffers().at(1);
+		uint32_t indexCount = vertexArray->GetIndexBuffer()->GetCount();
+		uint32_t instanceStride = shader->GetInputLayout().GetStride();
+		uint32_t maxInstancesPerDraw = s_MaxInstanceBufferSize / instanceStride;
+
+		shader->Bind();
+
+		// Upload and draw the instances, splitting them if they exceed the instance buffer
+		for (uint32_t firstInstance{ 0 }; firstInstance < instanceCount; firstInstance += maxInstancesPerDraw)
+		{
+			uint32_t drawCount = std::min(instanceCount - firstInstance, maxInstancesPerDraw);
+			instanceBuffer->SetData(instanceData + (size_t)firstInstance * instanceStride, drawCount * instanceStride);
+			RendererAPI::DrawIndexedInstanced(vertexArray, indexCount, drawCount);
+			s_Data.Stats.DrawCalls++;
+			s_Data.Stats.VertexCount += drawCount * (uint32_t)Shape::s_Quad.GetIndexVertices().size();
+		}
+	}
+
 	void RenderingService::SubmitDataToRenderer(RendererInputSpec& inputSpec)
 	{
 		if (!inputSpec.m_ShapeComponent->Vertices || inputSpec.m_Shader->GetSpecification().RenderType == RenderingType::None) { return; }
+		KG_ASSERT(!inputSpec.m_Shader->GetSpecification().DrawInstanced, "Instanced shaders must be submitted through SubmitInstancesToRenderer");
 
 		Ref<DrawCallBuffer> drawCallBuffer = inputSpec.m_Shader->GetCurrentDrawCallBuffer();
 
-		// Create new DrawCallBuffer if one is not associated with active shader
-		if (!drawCallBuffer)
+		// Create new DrawCallBuffer if one is not associated with active shader, the current buffer overflows,
+		//		or the current buffer belongs to another render layer
+		std::size_t sizeOfNewVertices = inputSpec.m_Buffer.Size * inputSpec.m_ShapeComponent->Vertices->size();
+		if (!drawCallBuffer || drawCallBuffer->m_VertexBufferIterator + sizeOfNewVertices > drawCallBuffer->m_VertexBufferEnd ||
+			drawCallBuffer->m_RenderLayer != s_Data.RenderLayer)
 		{
-			drawCallBuffer = CreateRef<DrawCallBuffer>();
-			drawCallBuffer->m_VertexBuffer.Allocate(s_MaxVertexBufferSize);
-			drawCallBuffer->m_VertexBufferIterator = drawCallBuffer->m_VertexBuffer.Data;
-			if (inputSpec.m_Shader->GetSpecification().RenderType == RenderingType::DrawIndex)
+			drawCallBuffer = CreateDrawCallBuffer(inputSpec.m_Shader);
+			if (!drawCallBuffer)
 			{
-				drawCallBuffer->m_IndexBuffer.reserve(s_Data.MaxIndicesBuffer);
+				return;
 			}
-			drawCallBuffer->m_Textures.reserve(s_Data.MaxTextureSlots);
-			drawCallBuffer->m_Shader = inputSpec.m_Shader.get();
-			s_Data.DrawCalls.emplace_back(drawCallBuffer);
-			inputSpec.m_Shader->SetCurrentDrawCallBuffer(drawCallBuffer);
 		}
 
-		std::size_t currentBufferSize = drawCallBuffer->m_VertexBufferIterator - drawCallBuffer->m_VertexBuffer.Data;
-		std::size_t sizeOfNewDrawCallBuffer = inputSpec.m_Buffer.Size * inputSpec.m_ShapeComponent->Vertices->size() + currentBufferSize;
-		// Create new DrawCallBuffer if current buffer overflows
-		if (sizeOfNewDrawCallBuffer >= s_MaxVertexBufferSize)
+		inputSpec.m_CurrentDrawBuffer = drawCallBuffer;
+
+		for (ObjectFillFunction perObjectFunction : inputSpec.m_Shader->GetFillDataObject())
 		{
-			drawCallBuffer = CreateRef<DrawCallBuffer>();
-			drawCallBuffer->m_VertexBuffer.Allocate(s_MaxVertexBufferSize);
-			drawCallBuffer->m_VertexBufferIterator = drawCallBuffer->m_VertexBuffer.Data;
-			if (inputSpec.m_Shader->GetSpecification().RenderType == RenderingType::DrawIndex)
-			{
-				drawCallBuffer->m_IndexBuffer.reserve(s_Data.MaxIndicesBuffer);
-			}
-			drawCallBuffer->m_Textures.reserve(s_Data.MaxTextureSlots);
-			drawCallBuffer->m_Shader = inputSpec.m_Shader.get();
-			s_Data.DrawCalls.emplace_back(drawCallBuffer);
-			inputSpec.m_Shader->SetCurrentDrawCallBuffer(drawCallBuffer);
+			perObjectFunction(inputSpec);
 		}
 
-		inputSpec.m_CurrentDrawBuffer = drawCallBuffer;
-
-		for (const auto& PerObjectFunction : inputSpec.m_Shader->GetFillDataObject())
+		// Write all vertices of the shape with the shader's specialized fill function
+		VertexFillFunction fillVertices = inputSpec.m_Shader->GetFillDataVertex();
+		if (!fillVertices)
 		{
-			PerObjectFunction(inputSpec);
+			return;
 		}
+		std::size_t vertexCount = inputSpec.m_ShapeComponent->Vertices->size();
+		fillVertices(inputSpec, inputSpec.m_Shader->GetFillDataVertexOffsets(), inputSpec.m_CurrentDrawBuffer->m_VertexBufferIterator);
+		inputSpec.m_CurrentDrawBuffer->m_VertexBufferIterator += inputSpec.m_Buffer.Size * vertexCount;
+		s_Data.Stats.VertexCount += static_cast<uint32_t>(vertexCount);
+	}
 
-		for (uint32_t iteration {0}; iteration < inputSpec.m_ShapeComponent->Vertices->size(); iteration++)
+	Ref<DrawCallBuffer> RenderingService::CreateDrawCallBuffer(Ref<Shader> shader)
+	{
+		Ref<VertexBuffer> vertexBuffer = shader->GetVertexArray()->GetVertexBuffers().at(0);
+		uint32_t stride = shader->GetInputLayout().GetStride();
+
+		// Ranges start on a vertex boundary, so draw calls can address them by vertex index
+		uint32_t rangeOffset{ 0 };
+		uint8_t* range = vertexBuffer->AllocateStreamRange(s_MaxVertexBufferSize, stride, rangeOffset);
+		if (!range)
 		{
-			for (const auto& PerVertexFunction : inputSpec.m_Shader->GetFillDataVertex())
+			// Every region was written since the last flush. Submit the pending draw calls, so their
+			//		regions are fenced and can be reused.
+			FlushBuffers();
+			range = vertexBuffer->AllocateStreamRange(s_MaxVertexBufferSize, stride, rangeOffset);
+			if (!range)
 			{
-				PerVertexFunction(inputSpec, iteration);
+				KG_ERROR("Failed to allocate a range of the streaming vertex buffer");
+				return nullptr;
 			}
-			memcpy(inputSpec.m_CurrentDrawBuffer->m_VertexBufferIterator, inputSpec.m_Buffer.Data, inputSpec.m_Buffer.Size);
-			inputSpec.m_CurrentDrawBuffer->m_VertexBufferIterator += inputSpec.m_Buffer.Size;
-			s_Data.Stats.VertexCount++;
 		}
 
-		
+		Ref<DrawCallBuffer> drawCallBuffer = CreateRef<DrawCallBuffer>();
+		drawCallBuffer->m_VertexBufferStart = range;
+		drawCallBuffer->m_VertexBufferIterator = range;
+		drawCallBuffer->m_VertexBufferEnd = range + s_MaxVertexBufferSize;
+		drawCallBuffer->m_FirstVertex = rangeOffset / stride;
+		drawCallBuffer->m_RenderLayer = s_Data.RenderLayer;
+		if (shader->GetSpecification().RenderType == RenderingType::DrawIndex)
+		{
+			drawCallBuffer->m_IndexBuffer.reserve(s_Data.MaxIndicesBuffer);
+		}
+		if (shader->GetSpecification().TextureInput == TextureInputType::ColorTexture)
+		{
+			drawCallBuffer->m_TextureArrays.reserve(s_Data.MaxTextureSlots);
+		}
+		else
+		{
+			drawCallBuffer->m_Textures.reserve(s_Data.MaxTextureSlots);
+		}
+		drawCallBuffer->m_Shader = shader.get();
+		s_Data.DrawCalls.emplace_back(drawCallBuffer);
+		shader->SetCurrentDrawCallBuffer(drawCallBuffer);
+		return drawCallBuffer;
 	}
 
 	void RenderingService::FillTextureUniform(Ref<DrawCallBuffer> buffer)
 	{
-		for (uint32_t i = 0; i < buffer->m_Textures.size(); i++) 
+		for (uint32_t i = 0; i < buffer->m_Textures.size() && i < s_Data.MaxTextureSlots; i++) 
 		{ 
-			buffer->m_Textures[i]->Bind(i); 
+			// Skip slots that already hold the texture from a previous draw call of this flush
+			const Ref<Texture2D>& texture = buffer->m_Textures[i];
+			if (s_Data.BoundTextures[i] == texture->GetRendererID())
+			{
+				continue;
+			}
+			texture->Bind(i); 
+			s_Data.BoundTextures[i] = texture->GetRendererID();
+			s_Data.Stats.TextureBinds++;
+		}
+	}
+
+	void RenderingService::FillTextureArrayUniform(Ref<DrawCallBuffer> buffer)
+	{
+		for (uint32_t i = 0; i < buffer->m_TextureArrays.size(); i++)
+		{
+			// Arrays are looked up when drawn, since a growing array is replaced by a larger one
+			Texture2DArray* textureArray = TextureResidencyService::GetTextureArray(buffer->m_TextureArrays[i]);
+			if (s_Data.BoundTextures[i] == textureArray->GetRendererID())
+			{
+				continue;
+			}
+			textureArray->Bind(i);
+			s_Data.BoundTextures[i] = textureArray->GetRendererID();
+			s_Data.Stats.TextureBinds++;
 		}
 	}
 
 	void RenderingService::DrawBufferIndices(Ref<DrawCallBuffer> buffer)
 	{
-		RendererAPI::DrawIndexed(buffer->m_Shader->GetVertexArray(), buffer->m_IndexBuffer.data(), static_cast<uint32_t>(buffer->m_IndexBuffer.size()));
+		RendererAPI::DrawIndexed(buffer->m_Shader->GetVertexArray(), buffer->m_IndexBuffer.data(), static_cast<uint32_t>(buffer->m_IndexBuffer.size()), buffer->m_FirstVertex);
 		s_Data.Stats.DrawCalls++;
 	}
 
 	void RenderingService::DrawBufferPoints(Ref<DrawCallBuffer> buffer)
 	{
 		RendererAPI::SetPointWidth(s_Data.PointWidth);
-		RendererAPI::DrawPoints(buffer->m_Shader->GetVertexArray(), static_cast<std::uint32_t>(buffer->m_VertexBufferIterator - buffer->m_VertexBuffer.Data) / buffer->m_Shader->GetInputLayout().GetStride());
+		RendererAPI::DrawPoints(buffer->m_Shader->GetVertexArray(), static_cast<std::uint32_t>(buffer->m_VertexBufferIterator - buffer->m_VertexBufferStart) / buffer->m_Shader->GetInputLayout().GetStride(), buffer->m_FirstVertex);
 		s_Data.Stats.DrawCalls++;
 	}
 
 	void RenderingService::DrawBufferLine(Ref<DrawCallBuffer> buffer)
 	{
 		RendererAPI::SetLineWidth(s_Data.LineWidth);
-		RendererAPI::DrawLines(buffer->m_Shader->GetVertexArray(), static_cast<std::uint32_t>(buffer->m_VertexBufferIterator - buffer->m_VertexBuffer.Data) / buffer->m_Shader->GetInputLayout().GetStride());
+		RendererAPI::DrawLines(buffer->m_Shader->GetVertexArray(), static_cast<std::uint32_t>(buffer->m_VertexBufferIterator - buffer->m_VertexBufferStart) / buffer->m_Shader->GetInputLayout().GetStride(), buffer->m_FirstVertex);
 		s_Data.Stats.DrawCalls++;
 	}
 
 	void RenderingService::DrawBufferTriangles(Ref<DrawCallBuffer> buffer)
 	{
-		RendererAPI::DrawTriangles(buffer->m_Shader->GetVertexArray(), static_cast<std::uint32_t>(buffer->m_VertexBufferIterator - buffer->m_VertexBuffer.Data) / buffer->m_Shader->GetInputLayout().GetStride());
+		RendererAPI::DrawTriangles(buffer->m_Shader->GetVertexArray(), static_cast<std::uint32_t>(buffer->m_VertexBufferIterator - buffer->m_VertexBufferStart) / buffer->m_Shader->GetInputLayout().GetStride(), buffer->m_FirstVertex);
 		s_Data.Stats.DrawCalls++;
 	}
 
 	void RenderingService::FlushBuffers()
 	{
 		auto& allBuffers = s_Data.DrawCalls;
+		if (allBuffers.empty())
+		{
+			return;
+		}
 
-		// Submit all Buffers to DrawCalls!
-		for (auto buffer : allBuffers)
+		// Record a draw packet for every buffer. Shaders are numbered in the order they are first
+		//		seen, so opaque draws keep grouping shaders in their first-seen order.
+		std::vector<DrawPacket>& packets = s_Data.DrawPackets;
+		packets.clear();
+		std::vector<Shader*> seenShaders;
+		for (uint32_t bufferIndex{ 0 }; bufferIndex < allBuffers.size(); bufferIndex++)
 		{
+			const DrawCallBuffer& buffer = *allBuffers[bufferIndex];
+			uint64_t sortKey = (uint64_t)buffer.m_RenderLayer << k_SortKeyLayerShift;
+			if (IsShaderTranslucent(buffer.m_Shader->GetSpecification()))
+			{
+				sortKey |= 1ull << k_SortKeyTranslucentShift;
+			}
+			else
+			{
+				auto shaderLocation = std::find(seenShaders.begin(), seenShaders.end(), buffer.m_Shader);
+				uint64_t shaderID = shaderLocation - seenShaders.begin();
+				if (shaderLocation == seenShaders.end())
+				{
+					seenShaders.push_back(buffer.m_Shader);
+				}
+				sortKey |= (shaderID & k_SortKeyShaderMask) << k_SortKeyShaderShift;
+				sortKey |= GetTextureSetID(buffer) << k_SortKeyTextureSetShift;
+			}
+			sortKey |= bufferIndex & k_SortKeySequenceMask;
+			packets.push_back({ sortKey, bufferIndex });
+		}
+		RadixSortDrawPackets(packets, s_Data.SortScratch);
+
+		// Other systems may bind shaders and textures between flushes
+		s_Data.BoundShader = nullptr;
+		s_Data.BoundTextures.fill(0);
+
+		// Submit all Buffers to DrawCalls in sorted order!
+		for (const DrawPacket& packet : packets)
+		{
+			Ref<DrawCallBuffer> buffer = allBuffers[packet.m_DrawCallIndex];
 			for (const auto& preDrawFunction : buffer->m_Shader->GetPreDrawBuffer())
 			{
 				preDrawFunction(buffer);
 			}
 
-			buffer->m_Shader->Bind();
-			uint32_t dataSize = static_cast<uint32_t>(buffer->m_VertexBufferIterator - buffer->m_VertexBuffer.Data);
-			buffer->m_Shader->GetVertexArray()->GetVertexBuffers().at(0)->SetData(buffer->m_VertexBuffer.Data, dataSize);
+			// Vertices were written directly into the shader's streaming vertex buffer
+			if (s_Data.BoundShader != buffer->m_Shader)
+			{
+				buffer->m_Shader->Bind();
+				s_Data.BoundShader = buffer->m_Shader;
+				s_Data.Stats.ShaderBinds++;
+			}
 
 			// Submit Per Buffer Uniforms
 			for (const auto& uniformFunction : buffer->m_Shader->GetSubmitUniforms())
@@ -330,23 +611,16 @@ namespace Kargono::Rendering
 			
 		}
 
-		// Clear current Buffers inside each shader!
+		// Fence the written ranges now that every draw call reading them is submitted, and clear
+		//		current Buffers inside each shader!
 		for (auto& buffer : allBuffers)
 		{
 			if (buffer->m_Shader->GetCurrentDrawCallBuffer())
 			{
+				buffer->m_Shader->GetVertexArray()->GetVertexBuffers().at(0)->FenceStreamRanges();
 				buffer->m_Shader->ClearCurrentDrawCallBuffer();
 			}
 		}
-
-		// Clear current Buffers in Renderer
-		for (auto& buffer : allBuffers)
-		{
-			if (buffer->m_VertexBuffer)
-			{
-				buffer->m_VertexBuffer.Release();
-			}
-		}
 		allBuffers.clear();
 	}
 	
@@ -29,9 +29,14 @@ namespace Kargono::Rendering
 		static void BeginScene(const EditorPerspectiveCamera& camera);
 		static void BeginScene(const Math::mat4 viewProjection);
 		static void SubmitDataToRenderer(RendererInputSpec& inputSpec);
+		// Draws the shader's static quad once per instance. The instance data must match the shader's input layout.
+		//		Instances are uploaded and drawn immediately rather than batched until EndScene().
+		static void SubmitInstancesToRenderer(Ref<Shader> shader, const uint8_t* instanceData, uint32_t instanceCount);
 		static void EndScene();
 	private:
 		static void FlushBuffers();
+		// Creates a DrawCallBuffer that writes into a new range of the shader's streaming vertex buffer
+		static Ref<DrawCallBuffer> CreateDrawCallBuffer(Ref<Shader> shader);
 	public:
 
 		//============================================================
@@ -40,6 +45,14 @@ namespace Kargono::Rendering
 		static float GetLineWidth();
 		static void SetLineWidth(float width);
 
+		//============================================================
+		// Render Layer
+		//============================================================
+		// Objects submitted after setting a layer are drawn after every object of a lower layer
+		//		within the same EndScene(), regardless of submission order
+		static uint8_t GetRenderLayer();
+		static void SetRenderLayer(uint8_t layer);
+
 
 	private:
 
@@ -58,18 +71,18 @@ namespace Kargono::Rendering
 		static void FillEntityID(Rendering::RendererInputSpec& inputSpec);
 
 		//============================================================
-		// Per Vertex Function Pointers for Filling Input Data
+		// Per Vertex Fill Function Selection
 		//============================================================
-		static void FillTextureCoordinate(RendererInputSpec& inputSpec, uint32_t iteration);
-		static void FillLocalPosition(RendererInputSpec& inputSpec, uint32_t iteration);
-		static void FillWorldPosition(RendererInputSpec& inputSpec, uint32_t iteration);
-		static void FillWorldPositionNoTransform(RendererInputSpec& inputSpec, uint32_t iteration);
-		static void FillVertexColor(RendererInputSpec& inputSpec, uint32_t iteration);
+		// Returns the vertex fill function specialized for the inputs of the provided shader and
+		//		resolves the byte offset of each input it writes
+		static VertexFillFunction SelectVertexFillFunction(const ShaderSpecification& specification, 
+			InputBufferLayout& layout, VertexFillOffsets& offsets);
 		
 		//============================================================
 		// Per DrawCallBuffer Function Pointers to fill Uniform Data
 		//============================================================
 		static void FillTextureUniform(Ref<DrawCallBuffer> buffer);
+		static void FillTextureArrayUniform(Ref<DrawCallBuffer> buffer);
 
 		//============================================================
 		// Pre Batch Render Functions
@@ -93,6 +106,10 @@ namespace Kargono::Rendering
 
 		// Specifies maximum size in bytes of DrawCallBuffers
 		static const uint32_t s_MaxVertexBufferSize = 10000;
+		// Specifies size in bytes of each region of a shader's streaming vertex buffer
+		static const uint32_t s_StreamRegionSize = 1 << 18;
+		// Specifies maximum size in bytes of the per-instance buffer used by instanced shaders
+		static const uint32_t s_MaxInstanceBufferSize = 1 << 20;
 	public:
 
 		//============================================================
@@ -102,6 +119,8 @@ namespace Kargono::Rendering
 		{
 			uint32_t DrawCalls = 0;
 			uint32_t VertexCount = 0;
+			uint32_t ShaderBinds = 0;
+			uint32_t TextureBinds = 0;
 		};
 		static void ResetStats();
 		static Statistics GetStats();
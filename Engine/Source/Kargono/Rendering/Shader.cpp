@@ -39,15 +39,42 @@ namespace Kargono::Rendering
 		m_InputBufferLayout = shaderInputLayout;
 		m_VertexArray = VertexArray::Create();
 
-		auto quadVertexBuffer = VertexBuffer::Create(RenderingService::s_MaxVertexBufferSize);
+		if (m_ShaderSpecification.DrawInstanced)
+		{
+			// Static quad shared by every instance
+			std::vector<Math::vec3> quadVertices = Shape::s_Quad.GetIndexVertices();
+			std::vector<uint32_t> quadIndices = Shape::s_Quad.GetIndices();
+			auto quadVertexBuffer = VertexBuffer::Create((float*)quadVertices.data(), 
+				static_cast<uint32_t>(quadVertices.size() * sizeof(Math::vec3)));
+			quadVertexBuffer->SetLayout({ { InputDataType::Float3, "a_QuadVertex" } });
+			m_VertexArray->AddVertexBuffer(quadVertexBuffer);
+			m_VertexArray->SetIndexBuffer(IndexBuffer::Create(quadIndices.data(), static_cast<uint32_t>(quadIndices.size())));
+
+			// Per-instance data is described by the shader's input layout
+			auto instanceBuffer = VertexBuffer::Create(RenderingService::s_MaxInstanceBufferSize);
+			instanceBuffer->SetLayout(m_InputBufferLayout);
+			m_VertexArray->AddInstanceBuffer(instanceBuffer);
+			return;
+		}
+
+		auto quadVertexBuffer = VertexBuffer::CreateStreaming(RenderingService::s_StreamRegionSize);
 		quadVertexBuffer->SetLayout(m_InputBufferLayout);
 		m_VertexArray->AddVertexBuffer(quadVertexBuffer);
+
+		// Select the vertex fill function that matches this layout
+		m_FillDataVertices = RenderingService::SelectVertexFillFunction(m_ShaderSpecification, m_InputBufferLayout, m_FillDataVertexOffsets);
 	}
 
 
 
 	void Shader::FillRenderFunctionList()
 	{
+		// Instanced shaders are drawn directly and do not use the batched fill/draw functions
+		if (m_ShaderSpecification.DrawInstanced)
+		{
+			return;
+		}
+
 		if (m_ShaderSpecification.RenderType == RenderingType::DrawLine)
 		{
 			m_DrawFunctions.push_back(RenderingService::DrawBufferLine);
@@ -57,17 +84,6 @@ namespace Kargono::Rendering
 			m_DrawFunctions.push_back(RenderingService::DrawBufferPoints);
 		}
 
-		if (m_ShaderSpecification.RenderType == RenderingType::DrawLine ||
-			m_ShaderSpecification.RenderType == RenderingType::DrawPoint ||
-			m_ShaderSpecification.TextureInput == TextureInputType::TextTexture)
-		{
-			m_FillDataPerVertex.push_back(RenderingService::FillWorldPositionNoTransform);
-		}
-		else
-		{
-			m_FillDataPerVertex.push_back(RenderingService::FillWorldPosition);
-		}
-
 		if (m_ShaderSpecification.AddEntityID)
 		{
 			m_FillDataInScene.push_back(RenderingService::FillEntityID);
@@ -76,28 +92,16 @@ namespace Kargono::Rendering
 		if (m_ShaderSpecification.TextureInput == TextureInputType::ColorTexture)
 		{
 			m_FillDataPerObject.push_back(RenderingService::FillTextureIndex);
-			m_FillDataPerVertex.push_back(RenderingService::FillTextureCoordinate);
-			m_SubmitUniforms.push_back(RenderingService::FillTextureUniform);
+			m_SubmitUniforms.push_back(RenderingService::FillTextureArrayUniform);
 		}
 
 		if (m_ShaderSpecification.TextureInput == TextureInputType::TextTexture)
 		{
 
 			m_FillDataPerObject.push_back(RenderingService::FillTextureAtlas);
-			m_FillDataPerVertex.push_back(RenderingService::FillTextureCoordinate);
 			m_SubmitUniforms.push_back(RenderingService::FillTextureUniform);
 		}
 
-		if (m_ShaderSpecification.ColorInput == ColorInputType::VertexColor)
-		{
-			m_FillDataPerVertex.push_back(RenderingService::FillVertexColor);
-		}
-
-		if (m_ShaderSpecification.AddCircleShape)
-		{
-			m_FillDataPerVertex.push_back(RenderingService::FillLocalPosition);
-		}
-
 		if (m_ShaderSpecification.RenderType == RenderingType::DrawIndex)
 		{
 			m_FillDataPerObject.push_back(RenderingService::FillIndicesData);
@@ -30,10 +30,18 @@ namespace Kargono::Rendering
 
 	struct DrawCallBuffer
 	{
-		Buffer m_VertexBuffer{};
-		uint8_t* m_VertexBufferIterator{ m_VertexBuffer.Data };
+		// Range of the shader's streaming vertex buffer written by this draw call
+		uint8_t* m_VertexBufferStart{ nullptr };
+		uint8_t* m_VertexBufferIterator{ nullptr };
+		uint8_t* m_VertexBufferEnd{ nullptr };
+		// Index of the range's first vertex inside the streaming vertex buffer
+		uint32_t m_FirstVertex{ 0 };
+		// Render layer active when the buffer was created. Layers are drawn in ascending order.
+		uint8_t m_RenderLayer{ 0 };
 		std::vector<uint32_t> m_IndexBuffer {};
 		std::vector<Ref<Texture2D>> m_Textures {};
+		// Resident texture arrays bound to each texture slot
+		std::vector<uint32_t> m_TextureArrays {};
 		Shader* m_Shader = nullptr;
 	};
 
@@ -54,6 +62,20 @@ namespace Kargono::Rendering
 		void ClearData();
 	};
 
+	// Byte offsets of the per-vertex inputs written by a vertex fill function
+	struct VertexFillOffsets
+	{
+		uint32_t m_Position{ 0 };
+		uint32_t m_TextureCoordinate{ 0 };
+		uint32_t m_Color{ 0 };
+		uint32_t m_LocalPosition{ 0 };
+	};
+
+	// Writes every vertex of the input spec's shape to the destination. The per-object data in the
+	//		input spec's buffer is copied into each vertex before the per-vertex inputs are written.
+	typedef void (*VertexFillFunction)(const RendererInputSpec& inputSpec, const VertexFillOffsets& offsets, uint8_t* destination);
+	typedef void (*ObjectFillFunction)(RendererInputSpec& inputSpec);
+
 	// This struct specifies the type of color input used by a shader
 	// For example, flat color only sends one color for each object while vertex color
 	// sends a color for each vertex.
@@ -88,14 +110,16 @@ namespace Kargono::Rendering
 		// Rendering Options
 		RenderingType RenderType = RenderingType::None;
 		bool DrawOutline = false;
+		// Draw a static quad once per instance. The input layout describes the per-instance data.
+		bool DrawInstanced = false;
 
 		// Generates default relational operations for comparing the same class! https://en.cppreference.com/w/cpp/language/default_comparisons
 		auto operator<=>(const ShaderSpecification&) const = default;
 		// Default Copy Constructor
 		ShaderSpecification(const ShaderSpecification&) = default;
 		ShaderSpecification() = default;
-		ShaderSpecification(ColorInputType colorInput, TextureInputType textureInput, bool addCircle, bool addProjection, bool addEntityID, RenderingType renderType, bool drawOutline)
-			: ColorInput(colorInput), TextureInput(textureInput), AddCircleShape(addCircle), AddProjectionMatrix(addProjection), AddEntityID(addEntityID), RenderType(renderType), DrawOutline(drawOutline)
+		ShaderSpecification(ColorInputType colorInput, TextureInputType textureInput, bool addCircle, bool addProjection, bool addEntityID, RenderingType renderType, bool drawOutline, bool drawInstanced = false)
+			: ColorInput(colorInput), TextureInput(textureInput), AddCircleShape(addCircle), AddProjectionMatrix(addProjection), AddEntityID(addEntityID), RenderType(renderType), DrawOutline(drawOutline), DrawInstanced(drawInstanced)
 		{}
 	};
 
@@ -153,9 +177,10 @@ namespace Kargono::Rendering
 		const ShaderSpecification& GetSpecification() const { return m_ShaderSpecification; }
 		InputBufferLayout& GetInputLayout() { return m_InputBufferLayout; }
 		const UniformBufferList& GetUniformList() const { return m_UniformBufferList; }
-		const std::vector<std::function<void(RendererInputSpec& spec)>>& GetFillDataObject() const { return m_FillDataPerObject; }
-		const std::vector<std::function<void(RendererInputSpec& spec, uint32_t iteration)>>& GetFillDataVertex() const { return m_FillDataPerVertex; }
-		const std::vector<std::function<void(RendererInputSpec& spec)>>& GetFillDataObjectScene() const { return m_FillDataInScene; }
+		const std::vector<ObjectFillFunction>& GetFillDataObject() const { return m_FillDataPerObject; }
+		VertexFillFunction GetFillDataVertex() const { return m_FillDataVertices; }
+		const VertexFillOffsets& GetFillDataVertexOffsets() const { return m_FillDataVertexOffsets; }
+		const std::vector<ObjectFillFunction>& GetFillDataObjectScene() const { return m_FillDataInScene; }
 		const std::vector<std::function<void(Ref<DrawCallBuffer> buffer)>>& GetDrawFunctions() const { return m_DrawFunctions; }
 		const std::vector<std::function<void(Ref<DrawCallBuffer> buffer)>>& GetSubmitUniforms() const { return m_SubmitUniforms; }
 
@@ -181,9 +206,11 @@ namespace Kargono::Rendering
 		void FillRenderFunctionList();
 
 		// Renderer Specific Functionality
-		std::vector<std::function<void(RendererInputSpec& spec)>> m_FillDataPerObject {};
-		std::vector<std::function<void(RendererInputSpec& spec, uint32_t iteration)>> m_FillDataPerVertex {};
-		std::vector<std::function<void(RendererInputSpec& spec)>> m_FillDataInScene {};
+		std::vector<ObjectFillFunction> m_FillDataPerObject {};
+		// Specialized for the shader's input layout when the layout is set
+		VertexFillFunction m_FillDataVertices { nullptr };
+		VertexFillOffsets m_FillDataVertexOffsets {};
+		std::vector<ObjectFillFunction> m_FillDataInScene {};
 		std::vector<std::function<void(Ref<DrawCallBuffer> buffer)>> m_SubmitUniforms {};
 		std::vector<std::function<void(Ref<DrawCallBuffer> buffer)>> m_DrawFunctions {};
 
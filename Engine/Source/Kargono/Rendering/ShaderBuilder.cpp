@@ -1,5 +1,6 @@
 #include "kgpch.h"
 #include "Kargono/Rendering/ShaderBuilder.h"
+#include "Kargono/Rendering/TextureResidency.h"
 
 namespace Kargono::Rendering
 {
@@ -192,6 +193,36 @@ namespace Kargono::Rendering
 			});
 	}
 
+	static void AddInstancedQuadOutput()
+	{
+		// The static quad is stored in its own vertex buffer, so it is not part of the input layout
+		InsertMap(s_VertexInput, 0, [&](uint16_t count)
+			{
+				s_OutputStream << "layout(location = " << count << ") in vec3 a_QuadVertex;\r\n";
+			});
+
+		InsertMap(s_VertexInput, 50, [&](uint16_t count)
+			{
+				const std::string name = "a_Position";
+				const std::string type = "vec3";
+				s_OutputStream << "layout(location = " << count << ") in " << type << " " << name << ";\r\n";
+				UpdateInputBuffer(name, type);
+			});
+
+		InsertMap(s_VertexInput, 50, [&](uint16_t count)
+			{
+				const std::string name = "a_Size";
+				const std::string type = "vec3";
+				s_OutputStream << "layout(location = " << count << ") in " << type << " " << name << ";\r\n";
+				UpdateInputBuffer(name, type);
+			});
+
+		InsertMap(s_VertexMain, 10, [&]()
+			{
+				s_OutputStream << "\tgl_Position = vec4(a_Position + a_QuadVertex * a_Size, 1.0);\r\n";
+			});
+	}
+
 	static void AddSimpleFragmentOutput()
 	{
 		InsertMap(s_FragmentOutput, 50, [&](uint16_t count)
@@ -285,49 +316,46 @@ namespace Kargono::Rendering
 		InsertMap(s_FragmentUniforms, 40, [&](uint16_t count)
 			{
 				const std::string name = "u_Textures";
-				const std::string type = "sampler2D";
+				const std::string type = "sampler2DArray";
 				s_OutputStream << "layout(binding = " << count << ") uniform " << type << " " << name << "[32];\r\n";
 				UpdateUniformBuffer(name, type);
 			});
 		InsertMap(s_FragmentFunctions, 30, [&]()
 			{
+				// Textures are layers of resident texture arrays. The mip level is chosen manually, so levels
+				//		of a layer that are still streaming in are never sampled.
+				s_OutputStream << "vec4 SampleTextureLayer(sampler2DArray textureArray, vec2 texCoordinate, vec2 texCoordinateDx, vec2 texCoordinateDy, float layer, float minLevel)\r\n";
+				s_OutputStream << "{\r\n";
+				s_OutputStream << "\tvec2 layerSize = vec2(textureSize(textureArray, 0).xy);\r\n";
+				s_OutputStream << "\tvec2 texelDx = texCoordinateDx * layerSize;\r\n";
+				s_OutputStream << "\tvec2 texelDy = texCoordinateDy * layerSize;\r\n";
+				s_OutputStream << "\tfloat level = max(0.5 * log2(max(dot(texelDx, texelDx), dot(texelDy, texelDy))), minLevel);\r\n";
+				s_OutputStream << "\treturn textureLod(textureArray, vec3(texCoordinate, layer), level);\r\n";
+				s_OutputStream << "}\r\n";
+
+				// v_TexIndex packs the texture slot, the array layer, and the minimum mip level. See
+				//		RenderingService::FillTextureIndex().
+				const uint32_t mipCount = TextureResidencyService::k_MaxMipCount;
+				const uint32_t layerCount = TextureResidencyService::k_MaxLayerCount;
 				s_OutputStream << "vec4 GetTextureColor(vec2 texCoordinate)\r\n";
 				s_OutputStream << "{\r\n";
-				s_OutputStream << "\tvec4 texColor;\r\n";
-				s_OutputStream << "\tswitch (int(v_TexIndex))\r\n";
+				s_OutputStream << "\tvec4 texColor = vec4(0.0);\r\n";
+				s_OutputStream << "\tvec2 texCoordinateDx = dFdx(texCoordinate);\r\n";
+				s_OutputStream << "\tvec2 texCoordinateDy = dFdy(texCoordinate);\r\n";
+				s_OutputStream << "\tif (v_TexIndex < 0.0)\r\n";
+				s_OutputStream << "\t{\r\n";
+				s_OutputStream << "\t\treturn texColor;\r\n";
+				s_OutputStream << "\t}\r\n";
+				s_OutputStream << "\tint texIndex = int(v_TexIndex);\r\n";
+				s_OutputStream << "\tfloat minLevel = float(texIndex % " << mipCount << ");\r\n";
+				s_OutputStream << "\tfloat layer = float((texIndex / " << mipCount << ") % " << layerCount << ");\r\n";
+				s_OutputStream << "\tswitch (texIndex / " << mipCount * layerCount << ")\r\n";
 				s_OutputStream << "\t{\r\n";
-				s_OutputStream << "\t\tcase  0: texColor = texture(u_Textures[0], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  1: texColor = texture(u_Textures[1], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  2: texColor = texture(u_Textures[2], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  3: texColor = texture(u_Textures[3], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  4: texColor = texture(u_Textures[4], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  5: texColor = texture(u_Textures[5], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  6: texColor = texture(u_Textures[6], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  7: texColor = texture(u_Textures[7], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  8: texColor = texture(u_Textures[8], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase  9: texColor = texture(u_Textures[9], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 10: texColor = texture(u_Textures[10], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 11: texColor = texture(u_Textures[11], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 12: texColor = texture(u_Textures[12], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 13: texColor = texture(u_Textures[13], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 14: texColor = texture(u_Textures[14], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 15: texColor = texture(u_Textures[15], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 16: texColor = texture(u_Textures[16], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 17: texColor = texture(u_Textures[17], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 18: texColor = texture(u_Textures[18], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 19: texColor = texture(u_Textures[19], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 20: texColor = texture(u_Textures[20], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 21: texColor = texture(u_Textures[21], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 22: texColor = texture(u_Textures[22], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 23: texColor = texture(u_Textures[23], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 24: texColor = texture(u_Textures[24], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 25: texColor = texture(u_Textures[25], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 26: texColor = texture(u_Textures[26], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 27: texColor = texture(u_Textures[27], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 28: texColor = texture(u_Textures[28], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 29: texColor = texture(u_Textures[29], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 30: texColor = texture(u_Textures[30], texCoordinate); break;\r\n";
-				s_OutputStream << "\t\tcase 31: texColor = texture(u_Textures[31], texCoordinate); break;\r\n";
+				for (uint32_t slot{ 0 }; slot < 32; slot++)
+				{
+					s_OutputStream << "\t\tcase " << slot << ": texColor = SampleTextureLayer(u_Textures[" << slot << 
+						"], texCoordinate, texCoordinateDx, texCoordinateDy, layer, minLevel); break;\r\n";
+				}
 				s_OutputStream << "\t}\r\n";
 				s_OutputStream << "\treturn texColor;\r\n";
 				s_OutputStream << "}\r\n";
@@ -569,7 +597,8 @@ namespace Kargono::Rendering
 		//=================
 
 		// Core
-		AddSimpleVertexOutput();
+		if (shaderSpec.DrawInstanced) { AddInstancedQuadOutput(); }
+		else { AddSimpleVertexOutput(); }
 		AddSimpleFragmentOutput();
 
 		if (shaderSpec.ColorInput == ColorInputType::FlatColor || shaderSpec.ColorInput == ColorInputType::VertexColor)
@@ -590,6 +619,7 @@ namespace Kargono::Rendering
 		s_OutputStream << "// Rendering Type: " << Utility::RenderingTypeToString(shaderSpec.RenderType) << "\r\n";
 		s_OutputStream << "// Color Type: " << Utility::ColorInputTypeToString(shaderSpec.ColorInput) << "\r\n";
 		s_OutputStream << "// Draw Outline: " << (shaderSpec.DrawOutline ? "true" : "false") << "\r\n";
+		if (shaderSpec.DrawInstanced) { s_OutputStream << "// Draw Instanced: true\r\n"; }
 		BeginShader("vertex");
 		// Structs/Classes
 		RunFunctions(s_VertexStructs);
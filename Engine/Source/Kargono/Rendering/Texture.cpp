@@ -2,11 +2,42 @@
 
 #include "Kargono/Rendering/RenderingService.h"
 #include "Kargono/Rendering/Texture.h"
+#include "Kargono/Rendering/TextureCompression.h"
+#include "Kargono/Core/Engine.h"
 
 #include "API/RenderingAPI/OpenGLTexture.h"
 
 namespace Kargono::Rendering
 {
+	// Levels at or below this size are uploaded as soon as a texture is created
+	static constexpr uint32_t k_ImmediateMipDimension{ 256 };
+
+	// Holds the levels of a texture that are still waiting to be uploaded
+	struct TextureMipStream
+	{
+		Ref<Texture2D> m_Texture{ nullptr };
+		Buffer m_Data{};
+		std::vector<TextureMipLevel> m_Layout{};
+		uint32_t m_NextLevel{ 0 };
+	};
+
+	// Uploads the next pending level and schedules the one after it for the following frame
+	static void StreamTextureMip(Ref<TextureMipStream> stream)
+	{
+		const TextureMipLevel& mipLevel = stream->m_Layout.at(stream->m_NextLevel);
+		stream->m_Texture->SetMipData(stream->m_NextLevel, stream->m_Data.Data + mipLevel.m_Offset, mipLevel.m_Size);
+		if (stream->m_NextLevel == 0)
+		{
+			stream->m_Data.Release();
+			return;
+		}
+		stream->m_NextLevel--;
+		EngineService::SubmitToMainThread([stream]()
+		{
+			StreamTextureMip(stream);
+		});
+	}
+
 	Ref<Texture2D> Texture2D::Create(const TextureSpecification& spec)
 	{
 #ifdef KG_RENDERER_OPENGL
@@ -20,9 +51,52 @@ namespace Kargono::Rendering
 #endif
 	}
 	Ref<Texture2D> Texture2D::Create(Buffer buffer, const Assets::TextureMetaData& metadata)
+	{
+		KG_ASSERT(buffer.Data, "Buffer does not have any valid data to input into Texture2D!");
+#ifdef KG_RENDERER_OPENGL
+		Ref<Texture2D> newTexture = CreateRef<API::RenderingAPI::OpenGLTexture2D>(metadata);
+#endif
+		std::vector<TextureMipLevel> layout = Utility::GetTextureMipLayout(metadata);
+		KG_ASSERT(buffer.Size >= layout.at(0).m_Offset + layout.at(0).m_Size, "Texture intermediate is smaller than its mip chain!");
+
+		// Upload the smallest levels now, so the texture is usable immediately
+		uint32_t level{ metadata.MipCount };
+		while (level > 0)
+		{
+			const TextureMipLevel& mipLevel = layout.at(level - 1);
+			if (EngineService::IsEngineActive() && std::max(mipLevel.m_Width, mipLevel.m_Height) > k_ImmediateMipDimension)
+			{
+				break;
+			}
+			newTexture->SetMipData(level - 1, buffer.Data + mipLevel.m_Offset, mipLevel.m_Size);
+			level--;
+		}
+
+		// Always upload at least one level, then stream the larger levels in one per frame
+		if (level == metadata.MipCount)
+		{
+			const TextureMipLevel& mipLevel = layout.at(level - 1);
+			newTexture->SetMipData(level - 1, buffer.Data + mipLevel.m_Offset, mipLevel.m_Size);
+			level--;
+		}
+		if (level > 0)
+		{
+			Ref<TextureMipStream> stream = CreateRef<TextureMipStream>();
+			stream->m_Texture = newTexture;
+			stream->m_Data = Buffer::Copy(buffer);
+			stream->m_Layout = std::move(layout);
+			stream->m_NextLevel = level - 1;
+			EngineService::SubmitToMainThread([stream]()
+			{
+				StreamTextureMip(stream);
+			});
+		}
+		return newTexture;
+	}
+	Ref<Texture2DArray> Texture2DArray::Create(const TextureArrayFormat& format, uint32_t layerCount)
 	{
 #ifdef KG_RENDERER_OPENGL
-		return CreateRef<API::RenderingAPI::OpenGLTexture2D>(buffer, metadata);
+		return CreateRef<API::RenderingAPI::OpenGLTexture2DArray>(format, layerCount);
 #endif
 	}
 	Ref<Texture2D> Texture2D::CreateEditorTexture(const std::filesystem::path& path)
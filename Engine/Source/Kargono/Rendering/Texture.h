@@ -29,6 +29,22 @@ namespace Kargono::Rendering
 
 	};
 
+	// Describes the storage shared by every layer of a texture array. The storage format is the
+	//		rendering API's internal format, so textures with different compression never share an array.
+	struct TextureArrayFormat
+	{
+		uint32_t m_StorageFormat{ 0 };
+		uint32_t m_Width{ 0 };
+		uint32_t m_Height{ 0 };
+		uint32_t m_MipCount{ 1 };
+
+		bool operator==(const TextureArrayFormat& other) const
+		{
+			return m_StorageFormat == other.m_StorageFormat && m_Width == other.m_Width &&
+				m_Height == other.m_Height && m_MipCount == other.m_MipCount;
+		}
+	};
+
 	class Texture
 	{
 	public:
@@ -38,6 +54,8 @@ namespace Kargono::Rendering
 		virtual uint32_t GetRendererID() const = 0;
 
 		virtual void SetData(void* data, uint32_t size) = 0;
+		// Uploads a single mip level of a texture created from an intermediate
+		virtual void SetMipData(uint32_t level, const void* data, uint64_t size) = 0;
 
 		virtual void Bind(uint32_t slot = 0) const = 0;
 
@@ -50,13 +68,44 @@ namespace Kargono::Rendering
 		static Ref<Texture2D> Create(const TextureSpecification& spec);
 		static Ref<Texture2D> Create(uint32_t rendererID, uint32_t width, uint32_t height);
 
-		// Create Texture using intermediate format
+		// Create Texture using intermediate format. The smallest mip levels are uploaded immediately
+		//		and the remaining levels are streamed in over the following frames.
 		static Ref<Texture2D> Create(Buffer buffer, const Assets::TextureMetaData& metadata);
 
 		// Create unmanaged texture outside of AssetManager. Used for Editor Textures only.
 		// Runtime related textures should use AssetManager.
 		static Ref<Texture2D> CreateEditorTexture(const std::filesystem::path& path);
 
+		// Storage description used to pack the texture into a texture array layer
+		virtual TextureArrayFormat GetArrayFormat() const = 0;
+		// Largest mip level that currently holds data
+		virtual uint32_t GetBaseMipLevel() const = 0;
+		// Incremented whenever any level receives new data
+		virtual uint32_t GetDataVersion() const = 0;
+	};
+
+	//==============================
+	// Texture 2D Array Class
+	//==============================
+	// A set of equally sized texture layers that share a single format, allowing one draw call to
+	//		sample from many textures by layer index
+	class Texture2DArray
+	{
+	public:
+		virtual ~Texture2DArray() = default;
+
+		static Ref<Texture2DArray> Create(const TextureArrayFormat& format, uint32_t layerCount);
+
+		// Copies the mip levels from firstLevel to the smallest level of the source into a layer
+		virtual void CopyLayerFromTexture(const Texture2D& source, uint32_t layer, uint32_t firstLevel) = 0;
+		// Copies every level of the first layerCount layers of another array with the same format
+		virtual void CopyLayersFromArray(const Texture2DArray& source, uint32_t layerCount) = 0;
+
+		virtual void Bind(uint32_t slot = 0) const = 0;
+
+		virtual const TextureArrayFormat& GetFormat() const = 0;
+		virtual uint32_t GetLayerCount() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
 	};
 }
 
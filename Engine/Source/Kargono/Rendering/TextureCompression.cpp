@@ -0,0 +1,453 @@
+#include "kgpch.h"
+
+#include "Kargono/Rendering/TextureCompression.h"
+#include "Kargono/Core/JobSystem.h"
+
+namespace Kargono::Utility
+{
+	// Every supported compression format encodes 4x4 pixel blocks
+	static constexpr uint32_t k_BlockDimension{ 4 };
+	static constexpr uint32_t k_BlockPixelCount{ k_BlockDimension * k_BlockDimension };
+	// Interpolation weights of BC7 4-bit indices
+	static constexpr int32_t k_BC7Weights[16]{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	static uint32_t GetBlockSize(Assets::TextureCompression compression)
+	{
+		switch (compression)
+		{
+		case Assets::TextureCompression::BC1: return 8;
+		case Assets::TextureCompression::BC7: return 16;
+		case Assets::TextureCompression::None:
+		default:
+			KG_ERROR("Invalid compression format provided to GetBlockSize");
+			return 0;
+		}
+	}
+
+	//==============================
+	// Build Mip Chain
+	//==============================
+	// Halves an RGBA8 image with a box filter. Odd dimensions repeat the last row/column.
+	static std::vector<uint8_t> DownsampleImage(const std::vector<uint8_t>& source, uint32_t width, uint32_t height)
+	{
+		uint32_t newWidth{ std::max(width / 2, 1u) };
+		uint32_t newHeight{ std::max(height / 2, 1u) };
+		std::vector<uint8_t> result((size_t)newWidth * newHeight * 4);
+		for (uint32_t y{ 0 }; y < newHeight; y++)
+		{
+			uint32_t y0{ std::min(y * 2, height - 1) };
+			uint32_t y1{ std::min(y * 2 + 1, height - 1) };
+			for (uint32_t x{ 0 }; x < newWidth; x++)
+			{
+				uint32_t x0{ std::min(x * 2, width - 1) };
+				uint32_t x1{ std::min(x * 2 + 1, width - 1) };
+				for (uint32_t channel{ 0 }; channel < 4; channel++)
+				{
+					uint32_t sum = source[((size_t)y0 * width + x0) * 4 + channel] + source[((size_t)y0 * width + x1) * 4 + channel] +
+						source[((size_t)y1 * width + x0) * 4 + channel] + source[((size_t)y1 * width + x1) * 4 + channel];
+					result[((size_t)y * newWidth + x) * 4 + channel] = (uint8_t)((sum + 2) / 4);
+				}
+			}
+		}
+		return result;
+	}
+
+	// Copies a 4x4 block out of an RGBA8 image. Pixels past the edge repeat the last row/column.
+	static void FetchBlock(const uint8_t* image, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t* block)
+	{
+		for (uint32_t y{ 0 }; y < k_BlockDimension; y++)
+		{
+			uint32_t imageY{ std::min(blockY * k_BlockDimension + y, height - 1) };
+			for (uint32_t x{ 0 }; x < k_BlockDimension; x++)
+			{
+				uint32_t imageX{ std::min(blockX * k_BlockDimension + x, width - 1) };
+				memcpy(block + (y * k_BlockDimension + x) * 4, image + ((size_t)imageY * width + imageX) * 4, 4);
+			}
+		}
+	}
+
+	//==============================
+	// Block Encoding
+	//==============================
+	// Finds two endpoints that span the block's colors along their principal axis. Only the first
+	//		channelCount channels are considered.
+	static void FindBlockEndpoints(const uint8_t* block, uint32_t channelCount, float minEndpoint[4], float maxEndpoint[4])
+	{
+		float mean[4]{};
+		float minimum[4]{ 255.0f, 255.0f, 255.0f, 255.0f };
+		float maximum[4]{};
+		for (uint32_t pixel{ 0 }; pixel < k_BlockPixelCount; pixel++)
+		{
+			for (uint32_t channel{ 0 }; channel < channelCount; channel++)
+			{
+				float value{ (float)block[pixel * 4 + channel] };
+				mean[channel] += value;
+				minimum[channel] = std::min(minimum[channel], value);
+				maximum[channel] = std::max(maximum[channel], value);
+			}
+		}
+		for (uint32_t channel{ 0 }; channel < channelCount; channel++)
+		{
+			mean[channel] /= (float)k_BlockPixelCount;
+		}
+
+		float covariance[4][4]{};
+		for (uint32_t pixel{ 0 }; pixel < k_BlockPixelCount; pixel++)
+		{
+			for (uint32_t row{ 0 }; row < channelCount; row++)
+			{
+				for (uint32_t column{ 0 }; column < channelCount; column++)
+				{
+					covariance[row][column] += ((float)block[pixel * 4 + row] - mean[row]) * ((float)block[pixel * 4 + column] - mean[column]);
+				}
+			}
+		}
+
+		// Power iteration, starting from the bounding box diagonal
+		float axis[4]{};
+		for (uint32_t channel{ 0 }; channel < channelCount; channel++)
+		{
+			axis[channel] = maximum[channel] - minimum[channel];
+		}
+		for (uint32_t iteration{ 0 }; iteration < 8; iteration++)
+		{
+			float nextAxis[4]{};
+			float lengthSquared{ 0.0f };
+			for (uint32_t row{ 0 }; row < channelCount; row++)
+			{
+				for (uint32_t column{ 0 }; column < channelCount; column++)
+				{
+					nextAxis[row] += covariance[row][column] * axis[column];
+				}
+				lengthSquared += nextAxis[row] * nextAxis[row];
+			}
+			if (lengthSquared < 1e-6f)
+			{
+				break;
+			}
+			float inverseLength{ 1.0f / std::sqrt(lengthSquared) };
+			for (uint32_t channel{ 0 }; channel < channelCount; channel++)
+			{
+				axis[channel] = nextAxis[channel] * inverseLength;
+			}
+		}
+
+		// Project the pixels onto the axis to find the extents
+		float minProjection{ 0.0f };
+		float maxProjection{ 0.0f };
+		for (uint32_t pixel{ 0 }; pixel < k_BlockPixelCount; pixel++)
+		{
+			float projection{ 0.0f };
+			for (uint32_t channel{ 0 }; channel < channelCount; channel++)
+			{
+				projection += ((float)block[pixel * 4 + channel] - mean[channel]) * axis[channel];
+			}
+			minProjection = std::min(minProjection, projection);
+			maxProjection = std::max(maxProjection, projection);
+		}
+		for (uint32_t channel{ 0 }; channel < 4; channel++)
+		{
+			minEndpoint[channel] = std::clamp(mean[channel] + axis[channel] * minProjection, 0.0f, 255.0f);
+			maxEndpoint[channel] = std::clamp(mean[channel] + axis[channel] * maxProjection, 0.0f, 255.0f);
+		}
+	}
+
+	template<uint32_t k_ChannelCount, uint32_t k_PaletteSize>
+	static uint32_t FindClosestPaletteEntry(const uint8_t* pixel, const int32_t (&palette)[k_PaletteSize][4])
+	{
+		uint32_t bestEntry{ 0 };
+		int32_t bestDistance{ INT32_MAX };
+		for (uint32_t entry{ 0 }; entry < k_PaletteSize; entry++)
+		{
+			int32_t distance{ 0 };
+			for (uint32_t channel{ 0 }; channel < k_ChannelCount; channel++)
+			{
+				int32_t difference{ (int32_t)pixel[channel] - palette[entry][channel] };
+				distance += difference * difference;
+			}
+			if (distance < bestDistance)
+			{
+				bestDistance = distance;
+				bestEntry = entry;
+			}
+		}
+		return bestEntry;
+	}
+
+	static uint16_t PackRGB565(const float color[4])
+	{
+		uint32_t red{ (uint32_t)(color[0] * 31.0f / 255.0f + 0.5f) };
+		uint32_t green{ (uint32_t)(color[1] * 63.0f / 255.0f + 0.5f) };
+		uint32_t blue{ (uint32_t)(color[2] * 31.0f / 255.0f + 0.5f) };
+		return (uint16_t)((red << 11) | (green << 5) | blue);
+	}
+
+	static void UnpackRGB565(uint16_t packed, int32_t color[4])
+	{
+		int32_t red{ (packed >> 11) & 31 };
+		int32_t green{ (packed >> 5) & 63 };
+		int32_t blue{ packed & 31 };
+		color[0] = (red << 3) | (red >> 2);
+		color[1] = (green << 2) | (green >> 4);
+		color[2] = (blue << 3) | (blue >> 2);
+		color[3] = 255;
+	}
+
+	static void EncodeBC1Block(const uint8_t* block, uint8_t* output)
+	{
+		float minEndpoint[4];
+		float maxEndpoint[4];
+		FindBlockEndpoints(block, 3, minEndpoint, maxEndpoint);
+
+		// The four color mode requires the first color to be larger
+		uint16_t color0{ PackRGB565(maxEndpoint) };
+		uint16_t color1{ PackRGB565(minEndpoint) };
+		if (color0 < color1)
+		{
+			std::swap(color0, color1);
+		}
+
+		uint32_t indices{ 0 };
+		if (color0 != color1)
+		{
+			int32_t palette[4][4];
+			UnpackRGB565(color0, palette[0]);
+			UnpackRGB565(color1, palette[1]);
+			for (uint32_t channel{ 0 }; channel < 3; channel++)
+			{
+				palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+				palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+			}
+			for (uint32_t pixel{ 0 }; pixel < k_BlockPixelCount; pixel++)
+			{
+				indices |= FindClosestPaletteEntry<3>(block + pixel * 4, palette) << (pixel * 2);
+			}
+		}
+
+		output[0] = (uint8_t)(color0 & 0xFF);
+		output[1] = (uint8_t)(color0 >> 8);
+		output[2] = (uint8_t)(color1 & 0xFF);
+		output[3] = (uint8_t)(color1 >> 8);
+		memcpy(output + 4, &indices, sizeof(uint32_t));
+	}
+
+	// Quantizes an endpoint to 7 bits per channel and a p-bit, which BC7 mode 6 shares across channels
+	static void QuantizeBC7Endpoint(const float endpoint[4], uint8_t quantized[4], uint8_t& pBit)
+	{
+		float bestError{ FLT_MAX };
+		for (uint8_t candidatePBit{ 0 }; candidatePBit < 2; candidatePBit++)
+		{
+			uint8_t candidate[4];
+			float error{ 0.0f };
+			for (uint32_t channel{ 0 }; channel < 4; channel++)
+			{
+				candidate[channel] = (uint8_t)std::clamp((int32_t)((endpoint[channel] - candidatePBit) / 2.0f + 0.5f), 0, 127);
+				float difference{ (float)((candidate[channel] << 1) | candidatePBit) - endpoint[channel] };
+				error += difference * difference;
+			}
+			if (error < bestError)
+			{
+				bestError = error;
+				memcpy(quantized, candidate, 4);
+				pBit = candidatePBit;
+			}
+		}
+	}
+
+	static void WriteBlockBits(uint8_t* output, uint32_t& bitOffset, uint32_t value, uint32_t bitCount)
+	{
+		for (uint32_t bit{ 0 }; bit < bitCount; bit++, bitOffset++)
+		{
+			if ((value >> bit) & 1)
+			{
+				output[bitOffset / 8] |= (uint8_t)(1 << (bitOffset % 8));
+			}
+		}
+	}
+
+	// Encodes a block with BC7 mode 6, which uses a single RGBA line with 16 interpolation steps
+	static void EncodeBC7Block(const uint8_t* block, uint8_t* output)
+	{
+		float minEndpoint[4];
+		float maxEndpoint[4];
+		FindBlockEndpoints(block, 4, minEndpoint, maxEndpoint);
+
+		uint8_t endpoints[2][4];
+		uint8_t pBits[2];
+		QuantizeBC7Endpoint(minEndpoint, endpoints[0], pBits[0]);
+		QuantizeBC7Endpoint(maxEndpoint, endpoints[1], pBits[1]);
+
+		int32_t palette[16][4];
+		for (uint32_t entry{ 0 }; entry < 16; entry++)
+		{
+			for (uint32_t channel{ 0 }; channel < 4; channel++)
+			{
+				int32_t start{ (endpoints[0][channel] << 1) | pBits[0] };
+				int32_t end{ (endpoints[1][channel] << 1) | pBits[1] };
+				palette[entry][channel] = ((64 - k_BC7Weights[entry]) * start + k_BC7Weights[entry] * end + 32) >> 6;
+			}
+		}
+
+		uint8_t indices[k_BlockPixelCount];
+		for (uint32_t pixel{ 0 }; pixel < k_BlockPixelCount; pixel++)
+		{
+			indices[pixel] = (uint8_t)FindClosestPaletteEntry<4>(block + pixel * 4, palette);
+		}
+
+		// The first index is stored without its high bit, so swap the endpoints if it is set
+		if (indices[0] >= 8)
+		{
+			std::swap(endpoints[0], endpoints[1]);
+			std::swap(pBits[0], pBits[1]);
+			for (uint8_t& index : indices)
+			{
+				index = 15 - index;
+			}
+		}
+
+		memset(output, 0, 16);
+		uint32_t bitOffset{ 0 };
+		WriteBlockBits(output, bitOffset, 1 << 6, 7);
+		for (uint32_t channel{ 0 }; channel < 4; channel++)
+		{
+			WriteBlockBits(output, bitOffset, endpoints[0][channel], 7);
+			WriteBlockBits(output, bitOffset, endpoints[1][channel], 7);
+		}
+		WriteBlockBits(output, bitOffset, pBits[0], 1);
+		WriteBlockBits(output, bitOffset, pBits[1], 1);
+		WriteBlockBits(output, bitOffset, indices[0], 3);
+		for (uint32_t pixel{ 1 }; pixel < k_BlockPixelCount; pixel++)
+		{
+			WriteBlockBits(output, bitOffset, indices[pixel], 4);
+		}
+		KG_ASSERT(bitOffset == 128);
+	}
+
+	// Writes a single RGBA8 level in the requested format
+	static void EncodeTextureLevel(const uint8_t* image, uint32_t width, uint32_t height,
+		const Assets::TextureMetaData& metadata, uint8_t* output)
+	{
+		if (metadata.Compression == Assets::TextureCompression::None)
+		{
+			for (size_t pixel{ 0 }; pixel < (size_t)width * height; pixel++)
+			{
+				memcpy(output + pixel * metadata.Channels, image + pixel * 4, metadata.Channels);
+			}
+			return;
+		}
+
+		uint32_t blockSize{ GetBlockSize(metadata.Compression) };
+		uint32_t blocksWide{ (width + k_BlockDimension - 1) / k_BlockDimension };
+		uint32_t blocksHigh{ (height + k_BlockDimension - 1) / k_BlockDimension };
+		JobService::ParallelFor(blocksHigh, 4, [&](size_t beginRow, size_t endRow)
+		{
+			uint8_t block[k_BlockPixelCount * 4];
+			for (size_t blockY{ beginRow }; blockY < endRow; blockY++)
+			{
+				for (uint32_t blockX{ 0 }; blockX < blocksWide; blockX++)
+				{
+					FetchBlock(image, width, height, blockX, (uint32_t)blockY, block);
+					uint8_t* blockOutput{ output + (blockY * blocksWide + blockX) * blockSize };
+					if (metadata.Compression == Assets::TextureCompression::BC1)
+					{
+						EncodeBC1Block(block, blockOutput);
+					}
+					else
+					{
+						EncodeBC7Block(block, blockOutput);
+					}
+				}
+			}
+		});
+	}
+
+	//==============================
+	// Texture Intermediate Layout
+	//==============================
+	uint32_t GetTextureMipCount(uint32_t width, uint32_t height)
+	{
+		uint32_t mipCount{ 1 };
+		for (uint32_t size{ std::max(width, height) }; size > 1; size /= 2)
+		{
+			mipCount++;
+		}
+		return mipCount;
+	}
+
+	uint64_t GetTextureLevelSize(Assets::TextureCompression compression, uint32_t width, uint32_t height, int32_t channels)
+	{
+		if (compression == Assets::TextureCompression::None)
+		{
+			return (uint64_t)width * height * channels;
+		}
+		uint64_t blocksWide{ (width + k_BlockDimension - 1) / k_BlockDimension };
+		uint64_t blocksHigh{ (height + k_BlockDimension - 1) / k_BlockDimension };
+		return blocksWide * blocksHigh * GetBlockSize(compression);
+	}
+
+	std::vector<Rendering::TextureMipLevel> GetTextureMipLayout(const Assets::TextureMetaData& metadata)
+	{
+		std::vector<Rendering::TextureMipLevel> layout(metadata.MipCount);
+		for (uint32_t level{ 0 }; level < metadata.MipCount; level++)
+		{
+			Rendering::TextureMipLevel& mipLevel = layout.at(level);
+			mipLevel.m_Width = std::max((uint32_t)metadata.Width >> level, 1u);
+			mipLevel.m_Height = std::max((uint32_t)metadata.Height >> level, 1u);
+			mipLevel.m_Size = GetTextureLevelSize(metadata.Compression, mipLevel.m_Width, mipLevel.m_Height, metadata.Channels);
+		}
+
+		// The smallest level is stored first
+		uint64_t offset{ 0 };
+		for (uint32_t level{ metadata.MipCount }; level > 0; level--)
+		{
+			layout.at(level - 1).m_Offset = offset;
+			offset += layout.at(level - 1).m_Size;
+		}
+		return layout;
+	}
+
+	//==============================
+	// Create Texture Intermediate
+	//==============================
+	Assets::TextureCompression SelectTextureCompression(uint32_t width, uint32_t height, int32_t channels)
+	{
+		if (width % k_BlockDimension != 0 || height % k_BlockDimension != 0)
+		{
+			return Assets::TextureCompression::None;
+		}
+		return channels == 4 ? Assets::TextureCompression::BC7 : Assets::TextureCompression::BC1;
+	}
+
+	Buffer CreateTextureMipChain(const uint8_t* pixels, const Assets::TextureMetaData& metadata)
+	{
+		KG_ASSERT(metadata.Channels == 3 || metadata.Channels == 4, "Texture intermediates require three or four channels");
+
+		std::vector<Rendering::TextureMipLevel> layout = GetTextureMipLayout(metadata);
+		Buffer output{ layout.at(0).m_Offset + layout.at(0).m_Size };
+
+		// Each level is filtered from the previous one in RGBA8
+		uint32_t width{ (uint32_t)metadata.Width };
+		uint32_t height{ (uint32_t)metadata.Height };
+		std::vector<uint8_t> image((size_t)width * height * 4);
+		for (size_t pixel{ 0 }; pixel < (size_t)width * height; pixel++)
+		{
+			memcpy(image.data() + pixel * 4, pixels + pixel * metadata.Channels, metadata.Channels);
+			if (metadata.Channels == 3)
+			{
+				image[pixel * 4 + 3] = 255;
+			}
+		}
+
+		for (uint32_t level{ 0 }; level < metadata.MipCount; level++)
+		{
+			if (level > 0)
+			{
+				image = DownsampleImage(image, width, height);
+				width = std::max(width / 2, 1u);
+				height = std::max(height / 2, 1u);
+			}
+			EncodeTextureLevel(image.data(), width, height, metadata, output.Data + layout.at(level).m_Offset);
+		}
+		return output;
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Kargono/Core/Buffer.h"
+#include "Kargono/Assets/Asset.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace Kargono::Rendering
+{
+	//==============================
+	// Texture Mip Level Struct
+	//==============================
+	// Location of a single mip level inside a texture intermediate
+	struct TextureMipLevel
+	{
+		uint32_t m_Width{ 0 };
+		uint32_t m_Height{ 0 };
+		uint64_t m_Offset{ 0 };
+		uint64_t m_Size{ 0 };
+	};
+}
+
+namespace Kargono::Utility
+{
+	//==============================
+	// Texture Intermediate Layout
+	//==============================
+	// Returns the number of levels in a full mip chain, down to a 1x1 level
+	uint32_t GetTextureMipCount(uint32_t width, uint32_t height);
+	// Returns the number of bytes a single level occupies in the provided format
+	uint64_t GetTextureLevelSize(Assets::TextureCompression compression, uint32_t width, uint32_t height, int32_t channels);
+	// Returns the location of every level, indexed by mip level. Levels are stored from the
+	//		smallest to the largest, so the returned offsets decrease with the level index.
+	std::vector<Rendering::TextureMipLevel> GetTextureMipLayout(const Assets::TextureMetaData& metadata);
+
+	//==============================
+	// Create Texture Intermediate
+	//==============================
+	// Picks the block compression format for an imported image. Block compressed images require
+	//		dimensions that are a multiple of four.
+	Assets::TextureCompression SelectTextureCompression(uint32_t width, uint32_t height, int32_t channels);
+	// Builds the mip chain of an image and encodes each level in the metadata's compression format.
+	//		The returned buffer follows GetTextureMipLayout() and must be released by the caller.
+	Buffer CreateTextureMipChain(const uint8_t* pixels, const Assets::TextureMetaData& metadata);
+}
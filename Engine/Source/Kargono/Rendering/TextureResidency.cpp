@@ -0,0 +1,183 @@
+#include "kgpch.h"
+
+#include "Kargono/Rendering/TextureResidency.h"
+
+namespace Kargono::Rendering
+{
+	void TextureResidencyService::Init()
+	{
+		// Initialize TextureResidencyContext
+		if (!s_ResidencyContext)
+		{
+			s_ResidencyContext = CreateRef<TextureResidencyContext>();
+		}
+
+		// Verify Init is Complete
+		KG_VERIFY(s_ResidencyContext, "Texture Residency Service Init");
+	}
+
+	void TextureResidencyService::Terminate()
+	{
+		// Clear TextureResidencyContext
+		s_ResidencyContext.reset();
+		s_ResidencyContext = nullptr;
+
+		// Verify Terminate is Complete
+		KG_VERIFY(!s_ResidencyContext, "Texture Residency Service Terminate");
+	}
+
+	bool TextureResidencyService::GetResidency(const Ref<Texture2D>& texture, TextureResidency& residency)
+	{
+		KG_ASSERT(s_ResidencyContext, "Texture residency service is not initialized!");
+		KG_ASSERT(texture, "Invalid texture provided to texture residency service!");
+
+		auto& residentTextures = s_ResidencyContext->m_Textures;
+		auto textureLocation = residentTextures.find(texture.get());
+
+		// The texture that owned this address was destroyed, so release its layer
+		if (textureLocation != residentTextures.end() && textureLocation->second.m_Texture.expired())
+		{
+			ResidentTexture& expiredTexture = textureLocation->second;
+			s_ResidencyContext->m_Arrays.at(expiredTexture.m_ArrayIndex).m_FreeLayers.push_back(expiredTexture.m_Layer);
+			residentTextures.erase(textureLocation);
+			textureLocation = residentTextures.end();
+		}
+
+		if (textureLocation == residentTextures.end())
+		{
+			// Assign the texture a layer inside an array with the same format
+			TextureArrayFormat format = texture->GetArrayFormat();
+			if (format.m_StorageFormat == 0 || format.m_MipCount > k_MaxMipCount)
+			{
+				return false;
+			}
+
+			ResidentTexture newResidentTexture{};
+			if (!AllocateLayer(format, newResidentTexture.m_ArrayIndex, newResidentTexture.m_Layer))
+			{
+				return false;
+			}
+			newResidentTexture.m_Texture = texture;
+			textureLocation = residentTextures.emplace(texture.get(), newResidentTexture).first;
+			RefreshResidentTexture(textureLocation->second, *texture);
+		}
+		else if (textureLocation->second.m_DataVersion != texture->GetDataVersion())
+		{
+			// Copy levels that were uploaded or modified since the last copy
+			RefreshResidentTexture(textureLocation->second, *texture);
+		}
+
+		const ResidentTexture& residentTexture = textureLocation->second;
+		residency.m_ArrayIndex = residentTexture.m_ArrayIndex;
+		residency.m_Layer = residentTexture.m_Layer;
+		residency.m_MinLevel = residentTexture.m_CopiedLevel;
+		return true;
+	}
+
+	Texture2DArray* TextureResidencyService::GetTextureArray(uint32_t arrayIndex)
+	{
+		KG_ASSERT(s_ResidencyContext, "Texture residency service is not initialized!");
+		KG_ASSERT(arrayIndex < s_ResidencyContext->m_Arrays.size(), "Invalid texture array index provided!");
+		return s_ResidencyContext->m_Arrays[arrayIndex].m_Array.get();
+	}
+
+	static bool TakeFreeLayer(ResidentTextureArray& residentArray, uint32_t& layer)
+	{
+		if (!residentArray.m_FreeLayers.empty())
+		{
+			layer = residentArray.m_FreeLayers.back();
+			residentArray.m_FreeLayers.pop_back();
+			return true;
+		}
+		if (residentArray.m_UsedLayerCount < residentArray.m_Array->GetLayerCount())
+		{
+			layer = residentArray.m_UsedLayerCount++;
+			return true;
+		}
+		return false;
+	}
+
+	bool TextureResidencyService::AllocateLayer(const TextureArrayFormat& format, uint32_t& arrayIndex, uint32_t& layer)
+	{
+		std::vector<ResidentTextureArray>& residentArrays = s_ResidencyContext->m_Arrays;
+
+		// Reuse a layer of an existing array, releasing the layers of destroyed textures if none are free
+		for (bool releaseExpired : { false, true })
+		{
+			if (releaseExpired)
+			{
+				ReleaseExpiredTextures();
+			}
+			for (arrayIndex = 0; arrayIndex < residentArrays.size(); arrayIndex++)
+			{
+				ResidentTextureArray& residentArray = residentArrays[arrayIndex];
+				if (residentArray.m_Array->GetFormat() == format && TakeFreeLayer(residentArray, layer))
+				{
+					return true;
+				}
+			}
+		}
+
+		// Grow a full array by moving its layers into a larger array
+		for (arrayIndex = 0; arrayIndex < residentArrays.size(); arrayIndex++)
+		{
+			ResidentTextureArray& residentArray = residentArrays[arrayIndex];
+			uint32_t layerCount = residentArray.m_Array->GetLayerCount();
+			if (!(residentArray.m_Array->GetFormat() == format) || layerCount >= k_MaxLayerCount)
+			{
+				continue;
+			}
+
+			Ref<Texture2DArray> grownArray = Texture2DArray::Create(format, std::min(layerCount * 2, k_MaxLayerCount));
+			if (!grownArray)
+			{
+				KG_ERROR("Failed to grow texture array");
+				return false;
+			}
+			grownArray->CopyLayersFromArray(*residentArray.m_Array, residentArray.m_UsedLayerCount);
+			residentArray.m_Array = grownArray;
+			return TakeFreeLayer(residentArray, layer);
+		}
+
+		// Create a new array for the format
+		ResidentTextureArray newArray{};
+		newArray.m_Array = Texture2DArray::Create(format, k_InitialLayerCount);
+		if (!newArray.m_Array)
+		{
+			KG_ERROR("Failed to create texture array");
+			return false;
+		}
+		residentArrays.push_back(newArray);
+		arrayIndex = static_cast<uint32_t>(residentArrays.size() - 1);
+		return TakeFreeLayer(residentArrays.back(), layer);
+	}
+
+	void TextureResidencyService::ReleaseExpiredTextures()
+	{
+		auto& residentTextures = s_ResidencyContext->m_Textures;
+		for (auto textureLocation = residentTextures.begin(); textureLocation != residentTextures.end();)
+		{
+			if (textureLocation->second.m_Texture.expired())
+			{
+				ResidentTexture& expiredTexture = textureLocation->second;
+				s_ResidencyContext->m_Arrays.at(expiredTexture.m_ArrayIndex).m_FreeLayers.push_back(expiredTexture.m_Layer);
+				textureLocation = residentTextures.erase(textureLocation);
+			}
+			else
+			{
+				textureLocation++;
+			}
+		}
+	}
+
+	void TextureResidencyService::RefreshResidentTexture(ResidentTexture& residentTexture, const Texture2D& texture)
+	{
+		// Levels larger than the texture's base level hold no data yet, so they are left undefined
+		//		and excluded from sampling through the residency's minimum level
+		uint32_t baseLevel = texture.GetBaseMipLevel();
+		Texture2DArray* textureArray = s_ResidencyContext->m_Arrays.at(residentTexture.m_ArrayIndex).m_Array.get();
+		textureArray->CopyLayerFromTexture(texture, residentTexture.m_Layer, baseLevel);
+		residentTexture.m_CopiedLevel = baseLevel;
+		residentTexture.m_DataVersion = texture.GetDataVersion();
+	}
+}
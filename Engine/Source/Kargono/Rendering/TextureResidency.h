@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Kargono/Core/Base.h"
+#include "Kargono/Rendering/Texture.h"
+
+#include <vector>
+#include <unordered_map>
+#include <memory>
+
+namespace Kargono::Rendering
+{
+	//=========================
+	// Texture Residency Struct
+	//=========================
+	// Location of a texture inside the resident texture arrays
+	struct TextureResidency
+	{
+		uint32_t m_ArrayIndex{ 0 };
+		uint32_t m_Layer{ 0 };
+		// Largest mip level of the layer that holds data. Larger levels must not be sampled.
+		uint32_t m_MinLevel{ 0 };
+	};
+
+	// A texture copied into a layer of a resident texture array
+	struct ResidentTexture
+	{
+		std::weak_ptr<Texture2D> m_Texture{};
+		uint32_t m_ArrayIndex{ 0 };
+		uint32_t m_Layer{ 0 };
+		uint32_t m_CopiedLevel{ 0 };
+		uint32_t m_DataVersion{ 0 };
+	};
+
+	// A texture array along with the layers that are not assigned to a texture
+	struct ResidentTextureArray
+	{
+		Ref<Texture2DArray> m_Array{ nullptr };
+		std::vector<uint32_t> m_FreeLayers{};
+		uint32_t m_UsedLayerCount{ 0 };
+	};
+
+	struct TextureResidencyContext
+	{
+		std::unordered_map<Texture2D*, ResidentTexture> m_Textures{};
+		std::vector<ResidentTextureArray> m_Arrays{};
+	};
+
+	//=========================
+	// Texture Residency Service Class
+	//=========================
+	// Packs textures that share a size and format into layers of texture arrays, so a single draw
+	//		call can sample from many textures. Textures are copied into their layer on the GPU when
+	//		they are first drawn and refreshed whenever their data changes.
+	class TextureResidencyService
+	{
+	public:
+		//=========================
+		// Lifecycle Functions
+		//=========================
+		static void Init();
+		static void Terminate();
+
+		//=========================
+		// Query Residency
+		//=========================
+		// Returns the location of the texture inside the texture arrays, assigning it a layer if it
+		//		is not resident yet. Returns false if no texture array can hold the texture.
+		static bool GetResidency(const Ref<Texture2D>& texture, TextureResidency& residency);
+		static Texture2DArray* GetTextureArray(uint32_t arrayIndex);
+
+		// Layers per texture array and mip levels per texture that can be addressed by a draw call
+		static constexpr uint32_t k_MaxLayerCount{ 256 };
+		static constexpr uint32_t k_MaxMipCount{ 16 };
+	private:
+		//=========================
+		// Internal Functionality
+		//=========================
+		static bool AllocateLayer(const TextureArrayFormat& format, uint32_t& arrayIndex, uint32_t& layer);
+		static void ReleaseExpiredTextures();
+		static void RefreshResidentTexture(ResidentTexture& residentTexture, const Texture2D& texture);
+
+		// Number of layers allocated when a texture array is created. Arrays double in size as they fill.
+		static constexpr uint32_t k_InitialLayerCount{ 4 };
+	private:
+		static inline Ref<TextureResidencyContext> s_ResidencyContext{ nullptr };
+	};
+}
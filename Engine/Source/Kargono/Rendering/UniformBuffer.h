@@ -9,7 +9,7 @@ namespace Kargono::Rendering
 
 	enum class UniformDataType
 	{
-		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool, Sampler2D
+		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool, Sampler2D, Sampler2DArray
 	};
 
 	struct UniformElement
@@ -34,6 +34,7 @@ namespace Kargono::Rendering
 			case UniformDataType::Float3:	return 3;
 			case UniformDataType::Float4:	return 4;
 			case UniformDataType::Sampler2D:return 4;
+			case UniformDataType::Sampler2DArray:return 4;
 			case UniformDataType::Int:		return 1;
 			case UniformDataType::Int2:		return 2;
 			case UniformDataType::Int3:		return 3;
@@ -103,6 +104,7 @@ namespace Kargono::Utility
 		case Rendering::UniformDataType::Int4:			return 4 * 4;
 		case Rendering::UniformDataType::Bool:			return 1;
 		case Rendering::UniformDataType::Sampler2D:	return 4 * 4;
+		case Rendering::UniformDataType::Sampler2DArray:	return 4 * 4;
 		}
 		KG_ERROR("Unknown UniformDataType!");
 		return 0;
@@ -118,6 +120,7 @@ namespace Kargono::Utility
 		if (type == "mat3") { return Rendering::UniformDataType::Mat3; }
 		if (type == "mat4") { return Rendering::UniformDataType::Mat4; }
 		if (type == "sampler2D") { return Rendering::UniformDataType::Sampler2D; }
+		if (type == "sampler2DArray") { return Rendering::UniformDataType::Sampler2DArray; }
 		if (type == "bool") { return Rendering::UniformDataType::Bool; }
 
 		KG_ERROR("Unknown String trying to convert to UniformDataType!");
@@ -137,6 +140,7 @@ namespace Kargono::Utility
 		case Rendering::UniformDataType::Int:			return "int";
 		case Rendering::UniformDataType::Bool:			return "bool";
 		case Rendering::UniformDataType::Sampler2D:	return "sampler2D";
+		case Rendering::UniformDataType::Sampler2DArray:	return "sampler2DArray";
 		}
 
 		KG_ERROR("Unknown UniformDataType for conversion to string!");
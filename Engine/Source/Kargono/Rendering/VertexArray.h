@@ -13,6 +13,8 @@ namespace Kargono::Rendering
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) = 0;
+		// Elements inside an instance buffer advance once per instance instead of once per vertex
+		virtual void AddInstanceBuffer(const Ref<VertexBuffer>& instanceBuffer) = 0;
 		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) = 0;
 
 		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const = 0;
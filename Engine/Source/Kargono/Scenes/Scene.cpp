@@ -7,6 +7,7 @@
 #include "Kargono/Physics/Physics2D.h"
 #include "Kargono/Rendering/RenderingService.h"
 #include "Kargono/Core/Engine.h"
+#include "Kargono/Core/JobSystem.h"
 #include "Kargono/Input/InputService.h"
 #include "Kargono/Input/InputMap.h"
 #include "Kargono/Rendering/Shader.h"
@@ -81,10 +82,18 @@ namespace Kargono::Scenes
 		m_SelectedEntity = new ECS::Entity();
 
 		RegisterAllProjectComponents();
-		
+
+		// Remove entities from the spatial index once they can no longer be rendered
+		entt::registry& registry = m_EntityRegistry.m_EnTTRegistry;
+		registry.on_destroy<ECS::TransformComponent>().connect<&SceneSpatialIndex::OnEntityRemoved>(m_SpatialIndex);
+		registry.on_destroy<ECS::ShapeComponent>().connect<&SceneSpatialIndex::OnEntityRemoved>(m_SpatialIndex);
 	}
 	Scene::~Scene()
 	{
+		entt::registry& registry = m_EntityRegistry.m_EnTTRegistry;
+		registry.on_destroy<ECS::TransformComponent>().disconnect(m_SpatialIndex);
+		registry.on_destroy<ECS::ShapeComponent>().disconnect(m_SpatialIndex);
+
 		delete m_HoveredEntity;
 		delete m_SelectedEntity;
 	}
@@ -332,18 +341,28 @@ namespace Kargono::Scenes
 	void Scene::RenderScene(Rendering::Camera& camera, const Math::mat4& transformMatrix)
 	{
 		Rendering::RenderingService::BeginScene(camera, transformMatrix);
+		m_SpatialIndex.BeginCulling(camera.GetProjection() * transformMatrix);
 		// Draw Shapes
 		{
 			auto view = m_EntityRegistry.m_EnTTRegistry.view<ECS::TransformComponent, ECS::ShapeComponent>();
 			for (entt::entity entity : view)
 			{
 				const auto& [transform, shape] = view.get<ECS::TransformComponent, ECS::ShapeComponent>(entity);
+
+				// Skip shapes outside of the camera's view. Entities are visited in registry order,
+				//		so the submission order of visible shapes is unchanged.
+				const Math::mat4* worldTransform = m_SpatialIndex.CullEntity(entity, transform, shape);
+				if (!worldTransform)
+				{
+					continue;
+				}
+
 				s_InputSpec.m_Shader = shape.Shader;
 				s_InputSpec.m_Buffer = shape.ShaderData;
 				s_InputSpec.m_Entity = static_cast<uint32_t>(entity);
 				s_InputSpec.m_EntityRegistry = &m_EntityRegistry.m_EnTTRegistry;
 				s_InputSpec.m_ShapeComponent = &shape;
-				s_InputSpec.m_TransformMatrix = transform.GetTransform();
+				s_InputSpec.m_TransformMatrix = *worldTransform;
 
 				for (const auto& PerObjectSceneFunction : shape.Shader->GetFillDataObjectScene())
 				{
@@ -439,45 +458,35 @@ namespace Kargono::Scenes
 		const b2Vec2& linearVelocity = body->GetLinearVelocity();
 		return Math::vec2(linearVelocity.x, linearVelocity.y);
 	}
-	void SceneService::SetProjectComponentField(UUID entityID, Assets::AssetHandle projectComponentID, uint64_t fieldLocation, void* value)
+	uint64_t SceneService::ResolveProjectComponentField(Assets::AssetHandle projectComponentID, uint64_t fieldLocation)
 	{
-		// Get the indicated entity
-		ECS::Entity currentEntity = s_ActiveScene->GetEntityByUUID(entityID);
-		KG_ASSERT(currentEntity);
-
 		// Get the indicated project component
 		Ref<ECS::ProjectComponent> projectComponent = Assets::AssetService::GetProjectComponent(projectComponentID);
-		KG_ASSERT(projectComponent);
-		KG_ASSERT(fieldLocation < projectComponent->m_DataLocations.size());
-
-		// Set indicated field value
-		uint8_t* componentDataRef = (uint8_t*)currentEntity.GetProjectComponentData(projectComponentID);
-
-		// Get field data pointer
-		uint8_t* fieldDataRef = componentDataRef + projectComponent->m_DataLocations.at(fieldLocation);
+		if (!projectComponent || fieldLocation >= projectComponent->m_DataLocations.size())
+		{
+			KG_WARN("Could not resolve field {} of project component {}", fieldLocation, projectComponentID);
+			return k_InvalidFieldAccessor;
+		}
 
-		// Set the data
-		Utility::TransferDataForWrappedVarBuffer(projectComponent->m_DataTypes.at(fieldLocation), value, fieldDataRef);
+		// Pack the storage slot and field offset into the accessor
+		return ((uint64_t)projectComponent->m_BufferSlot << 32) | (uint64_t)projectComponent->m_DataLocations.at(fieldLocation);
 	}
-	void* SceneService::GetProjectComponentField(UUID entityID, Assets::AssetHandle projectComponentID, uint64_t fieldLocation)
+	void* SceneService::GetProjectComponentField(UUID entityID, uint64_t fieldAccessor)
 	{
-		// Get the indicated entity
-		ECS::Entity currentEntity = s_ActiveScene->GetEntityByUUID(entityID);
-		KG_ASSERT(currentEntity);
+		KG_ASSERT(s_ActiveScene);
+		KG_ASSERT(fieldAccessor != k_InvalidFieldAccessor);
 
-		// Get the indicated project component
-		Ref<ECS::ProjectComponent> projectComponent = Assets::AssetService::GetProjectComponent(projectComponentID);
-		KG_ASSERT(projectComponent);
-		KG_ASSERT(fieldLocation < projectComponent->m_DataLocations.size());
+		// Get the indicated entity
+		ECS::EntityRegistry& registry = s_ActiveScene->m_EntityRegistry;
+		auto entityIterator = registry.m_EntityMap.find(entityID);
+		KG_ASSERT(entityIterator != registry.m_EntityMap.end());
 
-		// Set indicated field value
-		uint8_t* componentDataRef = (uint8_t*)currentEntity.GetProjectComponentData(projectComponentID);
+		// Get the component's storage and look up the entity's data
+		ECS::ProjectComponentStorage& storage = registry.m_ProjectComponentStorage[fieldAccessor >> 32];
+		uint8_t* componentDataRef = (uint8_t*)storage.m_GetProjectComponent(storage.m_EnTTStorageReference, entityIterator->second);
 
 		// Get field data pointer
-		uint8_t* fieldDataRef = componentDataRef + projectComponent->m_DataLocations.at(fieldLocation);
-
-		// Get the data
-		return fieldDataRef;
+		return componentDataRef + (fieldAccessor & 0xFFFFFFFF);
 	}
 
 	Assets::AssetHandle SceneService::FindEntityHandleByName(const std::string& name)
@@ -518,7 +527,11 @@ namespace Kargono::Scenes
 	}
 	void SceneService::TransitionScene(Assets::AssetHandle newSceneHandle)
 	{
-		Ref<Scene> newScene = Assets::AssetService::GetScene(newSceneHandle);
+		Ref<Scene> newScene = TakePreloadedScene(newSceneHandle);
+		if (!newScene)
+		{
+			newScene = Assets::AssetService::GetScene(newSceneHandle);
+		}
 		if (!newScene)
 		{
 			KG_WARN("Could not locate scene by scene handle");
@@ -551,7 +564,11 @@ namespace Kargono::Scenes
 
 	void SceneService::TransitionSceneFromHandle(Assets::AssetHandle sceneID)
 	{
-		Ref<Scenes::Scene> sceneReference = Assets::AssetService::GetScene(sceneID);
+		Ref<Scenes::Scene> sceneReference = TakePreloadedScene(sceneID);
+		if (!sceneReference)
+		{
+			sceneReference = Assets::AssetService::GetScene(sceneID);
+		}
 		if (sceneReference)
 		{
 			Particles::ParticleService::ClearEmitters();
@@ -569,6 +586,108 @@ namespace Kargono::Scenes
 		}
 	}
 
+	void SceneService::PreloadScene(Assets::AssetHandle sceneHandle)
+	{
+		if (s_ScenePreload && s_ScenePreload->m_SceneHandle == sceneHandle)
+		{
+			return;
+		}
+		CancelScenePreload();
+
+		Ref<Assets::ScenePreload> preload = Assets::AssetService::CreateScenePreload(sceneHandle);
+		if (!preload)
+		{
+			return;
+		}
+		s_ScenePreload = preload;
+
+		JobService::SubmitJob([preload]()
+		{
+			Assets::AssetService::LoadScenePreloadEntities(*preload);
+			// Asset caches and GPU resources are only touched from the main thread
+			EngineService::SubmitToMainThread([preload]()
+			{
+				ContinueScenePreload(preload);
+			});
+		}, &preload->m_LoadCounter);
+	}
+
+	void SceneService::CancelScenePreload()
+	{
+		// A running load job keeps its own reference to the preload, so it can be dropped right away
+		s_ScenePreload.reset();
+		s_PreloadedScene.reset();
+	}
+
+	bool SceneService::IsScenePreloaded(Assets::AssetHandle sceneHandle)
+	{
+		return s_PreloadedScene && s_ScenePreload->m_SceneHandle == sceneHandle;
+	}
+
+	float SceneService::GetScenePreloadProgress()
+	{
+		if (!s_ScenePreload)
+		{
+			return 0.0f;
+		}
+		if (s_PreloadedScene)
+		{
+			return 1.0f;
+		}
+		if (!s_ScenePreload->m_LoadCounter.IsDone())
+		{
+			return 0.0f;
+		}
+
+		// Loading the entities counts as the first half of the work, and loading the assets as the second
+		size_t assetCount{ s_ScenePreload->m_Assets.size() };
+		float assetProgress{ assetCount > 0 ? (float)s_ScenePreload->m_AssetsLoaded / (float)assetCount : 1.0f };
+		return 0.5f + 0.5f * assetProgress;
+	}
+
+	void SceneService::ContinueScenePreload(Ref<Assets::ScenePreload> preload)
+	{
+		// Ignore preloads that were cancelled or already consumed by a transition
+		if (preload != s_ScenePreload || s_PreloadedScene)
+		{
+			return;
+		}
+
+		// Spread the asset loading over multiple frames. The load job may also not have released its
+		//		counter yet.
+		if (!preload->m_LoadCounter.IsDone() || 
+			!Assets::AssetService::LoadScenePreloadAssets(*preload, k_PreloadAssetsPerFrame))
+		{
+			EngineService::SubmitToMainThread([preload]()
+			{
+				ContinueScenePreload(preload);
+			});
+			return;
+		}
+
+		s_PreloadedScene = Assets::AssetService::FinishScenePreload(*preload);
+		if (!s_PreloadedScene)
+		{
+			KG_WARN("Failed to preload scene with handle {}", preload->m_SceneHandle);
+			s_ScenePreload.reset();
+		}
+	}
+
+	Ref<Scene> SceneService::TakePreloadedScene(Assets::AssetHandle sceneHandle)
+	{
+		if (!s_ScenePreload || s_ScenePreload->m_SceneHandle != sceneHandle)
+		{
+			return nullptr;
+		}
+
+		// Finish any loading work the preload has not gotten to yet
+		Ref<Scene> preloadedScene = s_PreloadedScene ? s_PreloadedScene : 
+			Assets::AssetService::FinishScenePreload(*s_ScenePreload);
+		s_ScenePreload.reset();
+		s_PreloadedScene.reset();
+		return preloadedScene;
+	}
+
 	void SceneService::SetActiveScene(Ref<Scene> newScene, Assets::AssetHandle newHandle)
 	{
 		s_ActiveScene = newScene;
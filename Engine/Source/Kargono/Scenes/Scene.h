@@ -7,6 +7,7 @@
 #include "Kargono/Math/Math.h"
 #include "Kargono/Assets/Asset.h"
 #include "Kargono/ECS/EntityRegistry.h"
+#include "Kargono/Scenes/SceneSpatialIndex.h"
 
 #include "API/EntityComponentSystem/enttAPI.h"
 
@@ -18,6 +19,7 @@
 class Shader;
 struct Buffer;
 namespace Kargono::ECS { class Entity; }
+namespace Kargono::Assets { struct ScenePreload; }
 
 namespace Kargono::Scenes
 {
@@ -143,6 +145,9 @@ namespace Kargono::Scenes
 		ECS::Entity* m_HoveredEntity = nullptr;
 		ECS::Entity* m_SelectedEntity = nullptr;
 
+	private:
+		// Bounds of rendered entities used to cull them before submission
+		SceneSpatialIndex m_SpatialIndex{};
 	private:
 		// Friend Declarations
 		friend class ECS::Entity;
@@ -168,9 +173,13 @@ namespace Kargono::Scenes
 		static const std::string& TagComponentGetTag(UUID entityID);
 		static void Rigidbody2DComponent_SetLinearVelocity(UUID entityID, Math::vec2 linearVelocity);
 		static Math::vec2 Rigidbody2DComponent_GetLinearVelocity(UUID entityID);
-		static void SetProjectComponentField(UUID entityID, Assets::AssetHandle projectComponentID, uint64_t fieldLocation, void* value);
-		static void* GetProjectComponentField(UUID entityID, Assets::AssetHandle projectComponentID, uint64_t fieldLocation);
-		
+		// Project component fields are read/written through accessors that scripts resolve when their module
+		//		is loaded. An accessor packs the component's storage slot and the field's byte offset, so
+		//		accessing a field only requires the entity lookup and a single storage lookup.
+		static uint64_t ResolveProjectComponentField(Assets::AssetHandle projectComponentID, uint64_t fieldLocation);
+		static void* GetProjectComponentField(UUID entityID, uint64_t fieldAccessor);
+		static constexpr uint64_t k_InvalidFieldAccessor{ UINT64_MAX };
+
 
 		//====================
 		// Manage Active Scene Entities
@@ -186,6 +195,19 @@ namespace Kargono::Scenes
 		static void TransitionSceneFromHandle(Assets::AssetHandle sceneID);
 		static Ref<Scene> CreateSceneCopy(Ref<Scene> other);
 
+		//====================
+		// Preload Scenes
+		//====================
+		// Loads a scene ahead of a transition. Entities are built on a worker thread, then the main thread
+		//		loads the referenced assets a few per frame. Transitioning to the preloaded scene finishes
+		//		any remaining work and swaps it in, instead of loading the scene inline.
+		static void PreloadScene(Assets::AssetHandle sceneHandle);
+		static void CancelScenePreload();
+		// Returns true once the preloaded scene can be swapped in without further loading
+		static bool IsScenePreloaded(Assets::AssetHandle sceneHandle);
+		// Returns the preload progress in the range [0, 1], for use in loading screens
+		static float GetScenePreloadProgress();
+
 	public:
 		//====================
 		// Getters/Setters
@@ -199,11 +221,21 @@ namespace Kargono::Scenes
 			return s_ActiveSceneHandle;
 		}
 		static void SetActiveScene(Ref<Scene> newScene, Assets::AssetHandle newHandle);
+	private:
+		//====================
+		// Internal Functionality
+		//====================
+		static void ContinueScenePreload(Ref<Assets::ScenePreload> preload);
+		static Ref<Scene> TakePreloadedScene(Assets::AssetHandle sceneHandle);
 	private:
 		//====================
 		// Internal Fields
 		//====================
 		static inline Ref<Scene> s_ActiveScene { nullptr };
 		static inline Assets::AssetHandle s_ActiveSceneHandle { Assets::EmptyHandle };
+		// Scene preload state
+		static inline Ref<Assets::ScenePreload> s_ScenePreload { nullptr };
+		static inline Ref<Scene> s_PreloadedScene { nullptr };
+		static constexpr size_t k_PreloadAssetsPerFrame{ 4 };
 	};
 }
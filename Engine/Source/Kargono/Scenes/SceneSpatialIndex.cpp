@@ -0,0 +1,136 @@
+#include "kgpch.h"
+
+#include "Kargono/Scenes/SceneSpatialIndex.h"
+#include "Kargono/ECS/EngineComponents.h"
+
+namespace Kargono::Scenes
+{
+	static uint64_t GetCellKey(const Math::vec3& position)
+	{
+		int32_t cellX = static_cast<int32_t>(std::floor(position.x / SceneSpatialIndex::k_CellSize));
+		int32_t cellY = static_cast<int32_t>(std::floor(position.y / SceneSpatialIndex::k_CellSize));
+		return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+	}
+
+	void SceneSpatialIndex::BeginCulling(const Math::mat4& viewProjection)
+	{
+		m_Frustum = Math::ExtractFrustum(viewProjection);
+		m_CullFrame++;
+	}
+
+	const Math::mat4* SceneSpatialIndex::CullEntity(entt::entity entity, const ECS::TransformComponent& transform,
+		const ECS::ShapeComponent& shape)
+	{
+		const std::vector<Math::vec3>* vertices = shape.Vertices.get();
+		if (!vertices || vertices->empty())
+		{
+			return nullptr;
+		}
+
+		uint32_t entryIndex = static_cast<uint32_t>(entt::to_entity(entity));
+		if (entryIndex >= m_Entries.size())
+		{
+			m_Entries.resize(entryIndex + 1);
+		}
+		SpatialEntry& entry = m_Entries[entryIndex];
+
+		// Recompute the cached transform and bounds only if the entity moved or its shape changed
+		if (!entry.m_Valid || entry.m_Vertices != vertices || entry.m_Translation != transform.Translation ||
+			entry.m_Rotation != transform.Rotation || entry.m_Scale != transform.Scale)
+		{
+			if (entry.m_Valid)
+			{
+				RemoveEntry(entry);
+			}
+			entry.m_Translation = transform.Translation;
+			entry.m_Rotation = transform.Rotation;
+			entry.m_Scale = transform.Scale;
+			entry.m_Vertices = vertices;
+			entry.m_Transform = transform.GetTransform();
+
+			// Transform the local bounds of the shape into world space
+			Math::vec3 localMin{ vertices->front() };
+			Math::vec3 localMax{ vertices->front() };
+			for (const Math::vec3& vertex : *vertices)
+			{
+				localMin = glm::min(localMin, vertex);
+				localMax = glm::max(localMax, vertex);
+			}
+			Math::vec3 localCenter = (localMin + localMax) * 0.5f;
+			Math::vec3 localExtents = (localMax - localMin) * 0.5f;
+			entry.m_Center = Math::vec3(entry.m_Transform * Math::vec4(localCenter, 1.0f));
+			entry.m_Extents = glm::abs(Math::vec3(entry.m_Transform[0])) * localExtents.x +
+				glm::abs(Math::vec3(entry.m_Transform[1])) * localExtents.y +
+				glm::abs(Math::vec3(entry.m_Transform[2])) * localExtents.z;
+
+			// Insert the entity into the cell holding its center and grow the cell's loose bounds
+			Math::vec3 entryMin = entry.m_Center - entry.m_Extents;
+			Math::vec3 entryMax = entry.m_Center + entry.m_Extents;
+			entry.m_CellKey = GetCellKey(entry.m_Center);
+			SpatialCell& cell = m_Cells[entry.m_CellKey];
+			if (cell.m_EntityCount == 0)
+			{
+				cell.m_Min = entryMin;
+				cell.m_Max = entryMax;
+				cell.m_CullFrame = 0;
+			}
+			else if (glm::any(glm::lessThan(entryMin, cell.m_Min)) || glm::any(glm::greaterThan(entryMax, cell.m_Max)))
+			{
+				cell.m_Min = glm::min(cell.m_Min, entryMin);
+				cell.m_Max = glm::max(cell.m_Max, entryMax);
+				cell.m_CullFrame = 0;
+			}
+			cell.m_EntityCount++;
+			entry.m_Valid = true;
+		}
+
+		// Only entities in cells that straddle the frustum are tested individually
+		switch (GetCellIntersection(m_Cells.at(entry.m_CellKey)))
+		{
+		case Math::FrustumIntersection::Outside:
+			return nullptr;
+		case Math::FrustumIntersection::Inside:
+			return &entry.m_Transform;
+		case Math::FrustumIntersection::Intersecting:
+			if (Math::TestFrustumBox(m_Frustum, entry.m_Center, entry.m_Extents) == Math::FrustumIntersection::Outside)
+			{
+				return nullptr;
+			}
+			return &entry.m_Transform;
+		}
+		KG_ERROR("Invalid frustum intersection provided");
+		return nullptr;
+	}
+
+	void SceneSpatialIndex::OnEntityRemoved(entt::registry& registry, entt::entity entity)
+	{
+		UNREFERENCED_PARAMETER(registry);
+		uint32_t entryIndex = static_cast<uint32_t>(entt::to_entity(entity));
+		if (entryIndex < m_Entries.size() && m_Entries[entryIndex].m_Valid)
+		{
+			RemoveEntry(m_Entries[entryIndex]);
+		}
+	}
+
+	void SceneSpatialIndex::RemoveEntry(SpatialEntry& entry)
+	{
+		auto cellLocation = m_Cells.find(entry.m_CellKey);
+		KG_ASSERT(cellLocation != m_Cells.end(), "Spatial entry references a missing cell!");
+		// Bounds of the remaining entities are kept loose until the cell empties
+		if (--cellLocation->second.m_EntityCount == 0)
+		{
+			m_Cells.erase(cellLocation);
+		}
+		entry.m_Valid = false;
+	}
+
+	Math::FrustumIntersection SceneSpatialIndex::GetCellIntersection(SpatialCell& cell)
+	{
+		if (cell.m_CullFrame != m_CullFrame)
+		{
+			cell.m_Intersection = Math::TestFrustumBox(m_Frustum, (cell.m_Min + cell.m_Max) * 0.5f, (cell.m_Max - cell.m_Min) * 0.5f);
+			cell.m_CullFrame = m_CullFrame;
+		}
+		return cell.m_Intersection;
+	}
+}
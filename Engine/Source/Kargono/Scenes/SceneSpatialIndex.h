@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Kargono/Math/Math.h"
+
+#include "API/EntityComponentSystem/enttAPI.h"
+
+#include <vector>
+#include <unordered_map>
+
+namespace Kargono::ECS { struct TransformComponent; struct ShapeComponent; }
+
+namespace Kargono::Scenes
+{
+	//============================================================
+	// Spatial Entry Struct
+	//============================================================
+	// Cached world transform and bounds of a rendered entity. The transform inputs and vertices
+	//		used to compute the cache are kept, so changes can be detected without recomputing it.
+	struct SpatialEntry
+	{
+		Math::vec3 m_Translation{};
+		Math::vec3 m_Rotation{};
+		Math::vec3 m_Scale{};
+		const std::vector<Math::vec3>* m_Vertices{ nullptr };
+		Math::mat4 m_Transform{ 1.0f };
+		Math::vec3 m_Center{};
+		Math::vec3 m_Extents{};
+		uint64_t m_CellKey{ 0 };
+		bool m_Valid{ false };
+	};
+
+	// Loose bounds of every entity whose center falls inside a grid cell
+	struct SpatialCell
+	{
+		Math::vec3 m_Min{};
+		Math::vec3 m_Max{};
+		uint32_t m_EntityCount{ 0 };
+		uint64_t m_CullFrame{ 0 };
+		Math::FrustumIntersection m_Intersection{ Math::FrustumIntersection::Outside };
+	};
+
+	//============================================================
+	// Scene Spatial Index Class
+	//============================================================
+	// Uniform grid over the XY plane that holds the bounds of every rendered entity. Entities are
+	//		refreshed when they are visited during rendering and only recomputed if their transform
+	//		or shape changed. Cells are tested against the camera frustum once per frame, so entities
+	//		inside cells that are fully inside or outside the frustum skip their own test.
+	class SceneSpatialIndex
+	{
+	public:
+		//====================
+		// Culling Functions
+		//====================
+		// Starts a new culling pass against the frustum of the provided view projection matrix
+		void BeginCulling(const Math::mat4& viewProjection);
+		// Refreshes the cached bounds of an entity if it moved or its shape changed. Returns the
+		//		entity's world transform, or nullptr if the entity is outside the frustum.
+		const Math::mat4* CullEntity(entt::entity entity, const ECS::TransformComponent& transform,
+			const ECS::ShapeComponent& shape);
+
+		//====================
+		// Manage Entries
+		//====================
+		// Removes the entity from the index. Connected to the registry's destroy signals.
+		void OnEntityRemoved(entt::registry& registry, entt::entity entity);
+
+		// Width and height of a grid cell in world units
+		static constexpr float k_CellSize{ 32.0f };
+	private:
+		void RemoveEntry(SpatialEntry& entry);
+		Math::FrustumIntersection GetCellIntersection(SpatialCell& cell);
+	private:
+		// Entries are indexed by the entity's index inside the registry
+		std::vector<SpatialEntry> m_Entries{};
+		std::unordered_map<uint64_t, SpatialCell> m_Cells{};
+		Math::Frustum m_Frustum{};
+		uint64_t m_CullFrame{ 0 };
+	};
+}
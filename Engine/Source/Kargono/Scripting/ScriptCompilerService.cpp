@@ -8,6 +8,7 @@
 #include "Kargono/Scripting/ScriptTokenizer.h"
 #include "Kargono/Scripting/ScriptTokenParser.h"
 #include "Kargono/Scripting/ScriptOutputGenerator.h"
+#include "Kargono/Scripting/ScriptModuleBuilder.h"
 #include "Kargono/Assets/AssetService.h"
 #include "Kargono/ECS/ProjectComponent.h"
 #include "Kargono/ProjectData/ProjectEnum.h"
@@ -81,6 +82,51 @@ namespace Kargono::Scripting
 
 	static std::vector<ScriptToken> s_AllEnums;
 
+	// Writes a typed reference to a project component field (Entity.Component.Field) using the
+	//		field accessor that the script module resolves when it is loaded
+	static void GenerateProjectComponentFieldAccess(ScriptOutputGenerator& generator, MemberNode& member)
+	{
+		// Find the indicated project component
+		TokenExpressionNode* projectComponentExpression = std::get_if<TokenExpressionNode>(&member.ChildMemberNode->CurrentNodeExpression->Value);
+		KG_ASSERT(projectComponentExpression);
+		Ref<ECS::ProjectComponent> component = nullptr;
+		Assets::AssetHandle componentHandle{ Assets::EmptyHandle };
+		for (auto& [handle, asset] : Assets::AssetService::GetProjectComponentRegistry())
+		{
+			if (asset.Data.GetSpecificMetaData<Assets::ProjectComponentMetaData>()->Name == projectComponentExpression->Value.Value)
+			{
+				component = Assets::AssetService::GetProjectComponent(handle);
+				componentHandle = handle;
+				break;
+			}
+		}
+		KG_ASSERT(component);
+
+		// Find the indicated field
+		TokenExpressionNode* fieldNameExpression = std::get_if<TokenExpressionNode>(&member.ChildMemberNode->ChildMemberNode->CurrentNodeExpression->Value);
+		KG_ASSERT(fieldNameExpression);
+		size_t fieldIndex{ 0 };
+		for (const std::string& fieldName : component->m_DataNames)
+		{
+			if (fieldName == fieldNameExpression->Value.Value)
+			{
+				break;
+			}
+			fieldIndex++;
+		}
+		KG_ASSERT(fieldIndex < component->m_DataTypes.size());
+
+		// Output the field access
+		generator.m_OutputText << "(*(";
+		generator.m_OutputText << Utility::WrappedVarTypeToCPPString(component->m_DataTypes.at(fieldIndex));
+		generator.m_OutputText << "*)";
+		generator.m_OutputText << "Scenes_GetProjectComponentField(";
+		generator.GenerateExpression(member.CurrentNodeExpression);
+		generator.m_OutputText << ", ";
+		generator.m_OutputText << ScriptModuleBuilder::GetProjectComponentFieldAccessorName(componentHandle, fieldIndex);
+		generator.m_OutputText << "))";
+	}
+
 	void ScriptCompilerService::Terminate()
 	{
 		s_ActiveLanguageDefinition.Clear();
@@ -865,47 +911,7 @@ namespace Kargono::Scripting
 				projectComponentFieldMember.PrimitiveType = Utility::WrappedVarTypeToPrimitiveType(projectComp->m_DataTypes.at(iteration));
 				projectComponentFieldMember.OnGenerateGetter = [](ScriptOutputGenerator& generator, MemberNode& member)
 				{
-					
-					generator.m_OutputText << "*(";
-					generator.m_OutputText << Utility::WrappedVarTypeToCPPString(Utility::KGScriptToWrappedVarType(member.ReturnType.Value));
-					generator.m_OutputText << "*)";
-					generator.m_OutputText << "Scenes_GetProjectComponentField(";
-
-					// Output entity ID
-					generator.GenerateExpression(member.CurrentNodeExpression);
-					generator.m_OutputText << ", ";
-
-					// Output project component ID
-					TokenExpressionNode* projectComponentExpression = std::get_if<TokenExpressionNode>(&member.ChildMemberNode->CurrentNodeExpression->Value);
-					KG_ASSERT(projectComponentExpression);
-					Ref<ECS::ProjectComponent> component = nullptr;
-					for (auto& [handle, asset] : Assets::AssetService::GetProjectComponentRegistry())
-					{
-						if (asset.Data.GetSpecificMetaData<Assets::ProjectComponentMetaData>()->Name == projectComponentExpression->Value.Value)
-						{
-							component = Assets::AssetService::GetProjectComponent(handle);
-							generator.m_OutputText << std::to_string(handle);
-							break;
-						}
-					}
-					KG_ASSERT(component);
-					generator.m_OutputText << ", ";
-
-					// Output component field ID
-					TokenExpressionNode* fieldNameExpression = std::get_if<TokenExpressionNode>(&member.ChildMemberNode->ChildMemberNode->CurrentNodeExpression->Value);
-					KG_ASSERT(fieldNameExpression);
-					size_t iteration{ 0 };
-					for (const std::string& fieldName : component->m_DataNames)
-					{
-						if (fieldName == fieldNameExpression->Value.Value)
-						{
-							generator.m_OutputText << std::to_string(iteration);
-							break;
-						}
-						iteration++;
-					}
-
-					generator.m_OutputText << ")";
+					GenerateProjectComponentFieldAccess(generator, member);
 				};
 
 				projectComponentFieldMember.OnGenerateSetter = [](ScriptOutputGenerator& generator, StatementAssignment& assignmentStatement)
@@ -913,67 +919,10 @@ namespace Kargono::Scripting
 					MemberNode* memberNode = std::get_if<MemberNode>(&assignmentStatement.Name->Value);
 					KG_ASSERT(memberNode);
 
-					generator.m_OutputText << "Scenes_SetProjectComponentField(";
-
-					// Generate entityID
-					generator.GenerateExpression(memberNode->CurrentNodeExpression);
-					generator.m_OutputText << ", ";
-
-					// Output project component ID
-					TokenExpressionNode* projectComponentExpression = std::get_if<TokenExpressionNode>(&memberNode->ChildMemberNode->CurrentNodeExpression->Value);
-					KG_ASSERT(projectComponentExpression);
-					Ref<ECS::ProjectComponent> component = nullptr;
-					for (auto& [handle, asset] : Assets::AssetService::GetProjectComponentRegistry())
-					{
-						if (asset.Data.GetSpecificMetaData<Assets::ProjectComponentMetaData>()->Name == projectComponentExpression->Value.Value)
-						{
-							component = Assets::AssetService::GetProjectComponent(handle);
-							generator.m_OutputText << std::to_string(handle);
-							break;
-						}
-					}
-					KG_ASSERT(component);
-					generator.m_OutputText << ", ";
-
-					// Output component field ID
-					TokenExpressionNode* fieldNameExpression = std::get_if<TokenExpressionNode>(&memberNode->ChildMemberNode->ChildMemberNode->CurrentNodeExpression->Value);
-					KG_ASSERT(fieldNameExpression);
-					size_t iteration{ 0 };
-					for (const std::string& fieldName : component->m_DataNames)
-					{
-						if (fieldName == fieldNameExpression->Value.Value)
-						{
-							generator.m_OutputText << std::to_string(iteration);
-							break;
-						}
-						iteration++;
-					}
-					generator.m_OutputText << ", ";
-
-					// Output expression
-					if (TokenExpressionNode* tokenExpression = std::get_if<TokenExpressionNode>(&assignmentStatement.Value->Value))
-					{
-						if (tokenExpression->Value.Type == ScriptTokenType::Identifier)
-						{
-							generator.m_OutputText << "&" << tokenExpression->Value.Value;
-						}
-						else if (IsLiteral(tokenExpression->Value))
-						{
-							generator.m_OutputText << "(void*)&RValueToLValue(" << tokenExpression->Value.Value << ")";
-						}
-						else
-						{
-							KG_WARN("Invalid argument type provided to GameState::SetField");
-							return;
-						}
-					}
-					else
-					{
-						assignmentStatement.Value->GenerationAffixes = CreateRef<ExpressionGenerationAffixes>("(void*)&RValueToLValue(", ")");
-						generator.GenerateExpression(assignmentStatement.Value);
-					}
-
-					generator.m_OutputText << ")";
+					// Write directly into the field through its typed pointer
+					GenerateProjectComponentFieldAccess(generator, *memberNode);
+					generator.m_OutputText << " = ";
+					generator.GenerateExpression(assignmentStatement.Value);
 				};
 				projectComponentMember.Members.insert_or_assign(projectComponentFieldMember.Name, CreateRef<MemberType>(projectComponentFieldMember));
 			}
@@ -2305,6 +2254,42 @@ namespace Kargono::Scripting
 		newFunctionNode = {};
 		newParameter = {};
 
+		newFunctionNode.Namespace = { ScriptTokenType::Identifier, "SceneService" };
+		newFunctionNode.Name = { ScriptTokenType::Identifier, "PreloadScene" };
+		newFunctionNode.ReturnType = { ScriptTokenType::None, "None" };
+		newParameter.AllTypes.push_back({ ScriptTokenType::PrimitiveType, "scene" });
+		newParameter.Identifier = { ScriptTokenType::Identifier, "sceneName" };
+		newFunctionNode.Parameters.push_back(newParameter);
+		newParameter = {};
+		newFunctionNode.Description = "Start loading the scene specified in the background. A later call to LoadScene with the same scene swaps it in without loading it again. This function takes the name of the scene that should be preloaded as an argument.";
+		newFunctionNode.OnGenerateFunction = [](ScriptOutputGenerator& generator, FunctionCallNode& node)
+		{
+			UNREFERENCED_PARAMETER(generator);
+			node.Namespace = {};
+			node.Identifier.Value = "Scenes_PreloadScene";
+		};
+		s_ActiveLanguageDefinition.FunctionDefinitions.insert_or_assign(newFunctionNode.Name.Value, newFunctionNode);
+		newFunctionNode = {};
+		newParameter = {};
+
+		newFunctionNode.Namespace = { ScriptTokenType::Identifier, "SceneService" };
+		newFunctionNode.Name = { ScriptTokenType::Identifier, "IsScenePreloaded" };
+		newFunctionNode.ReturnType = { ScriptTokenType::PrimitiveType, "bool" };
+		newParameter.AllTypes.push_back({ ScriptTokenType::PrimitiveType, "scene" });
+		newParameter.Identifier = { ScriptTokenType::Identifier, "scene" };
+		newFunctionNode.Parameters.push_back(newParameter);
+		newParameter = {};
+		newFunctionNode.Description = "This function indicates whether the provided scene has finished preloading and can be loaded without a delay. This function takes the scene as an argument and returns a bool.";
+		newFunctionNode.OnGenerateFunction = [](ScriptOutputGenerator& generator, FunctionCallNode& node)
+		{
+			UNREFERENCED_PARAMETER(generator);
+			node.Namespace = {};
+			node.Identifier.Value = "Scenes_IsScenePreloaded";
+		};
+		s_ActiveLanguageDefinition.FunctionDefinitions.insert_or_assign(newFunctionNode.Name.Value, newFunctionNode);
+		newFunctionNode = {};
+		newParameter = {};
+
 		newFunctionNode.Namespace = { ScriptTokenType::Identifier, "SceneService" };
 		newFunctionNode.Name = { ScriptTokenType::Identifier, "GetEntity" };
 		newFunctionNode.ReturnType = { ScriptTokenType::PrimitiveType, "entity" };
@@ -15,15 +15,26 @@ namespace Kargono::Scripting
 		//==============================
 		static void CreateScriptModule();
 
+		//==============================
+		// Generated Code Helpers
+		//==============================
+		// Name of the module variable that caches the resolved accessor for a project component field
+		static std::string GetProjectComponentFieldAccessorName(Assets::AssetHandle projectComponentHandle, size_t fieldIndex);
+
 	private:
 		//==============================
 		// Internal Functionality to Support Creation
 		//==============================
-		static void CreateModuleHeaderFile();
-		static bool CreateModuleCPPFile();
-		static bool CompileModuleCodeMSVC(bool createDebug);
-		static bool CompileModuleCodeGCC(bool createDebug);
+		// The module is split into a bridge translation unit (engine function pointers) and one
+		//		translation unit per script. Both include the module header, which is precompiled.
+		static void CreateModuleHeaderFile(const std::string& bridgeDeclarations);
+		static void CreateModuleBridgeFile(std::stringstream& declarationStream);
+		static bool CreateModuleScriptFiles(std::vector<std::filesystem::path>& sourceFiles);
+		// Only translation units that changed since the previous build are recompiled before linking
+		static bool CompileModuleCodeMSVC(bool createDebug, const std::vector<std::filesystem::path>& sourceFiles);
+		static bool CompileModuleCodeGCC(bool createDebug, const std::vector<std::filesystem::path>& sourceFiles);
 		static void AttachEngineFunctionsToModule();
+		static void ResolveModuleProjectComponentFields();
 	public:
 		friend ScriptService;
 	};
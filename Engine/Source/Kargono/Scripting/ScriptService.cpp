@@ -3,8 +3,10 @@
 #include "Kargono/Scripting/ScriptService.h"
 
 #include "Kargono/Core/Engine.h"
+#include "Kargono/Core/JobSystem.h"
 #include "Kargono/Scripting/ScriptModuleBuilder.h"
 #include "Kargono/Assets/AssetService.h"
+#include "Kargono/ECS/ProjectComponent.h"
 #include "Kargono/Scenes/Scene.h"
 #include "Kargono/Utility/FileSystem.h"
 #include "Kargono/Projects/Project.h"
@@ -41,6 +43,11 @@ namespace Kargono::Scripting
 #elif defined(KG_PLATFORM_LINUX)
 		void* DLLInstance = nullptr;
 #endif
+		// The loaded module is a uniquely named copy of the built module, so the build output is never
+		//		locked and a new build can be opened next to the running one
+		std::filesystem::path LoadedModulePath {};
+		int64_t LoadedModuleWriteTime { 0 };
+		uint32_t ModuleVersion { 0 };
 	};
 
 	static ScriptingData* s_ScriptingData = nullptr;
@@ -201,24 +208,27 @@ namespace Kargono::Scripting
 		KG_VERIFY(!s_ScriptingData, "Close Scripting System")
 	}
 
-	void ScriptService::LoadActiveScriptModule()
+	static std::filesystem::path GetActiveScriptModulePath()
 	{
-		// Get the path to the script dll
 #if defined(KG_PLATFORM_WINDOWS)
 	#if defined(KG_DEBUG) 
-			std::filesystem::path dllLocation { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script\\ExportBodyDebug.dll" };
+		return Projects::ProjectService::GetActiveIntermediateDirectory() / "Script\\ExportBodyDebug.dll";
 	#else
-			std::filesystem::path dllLocation { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script\\ExportBody.dll" };
+		return Projects::ProjectService::GetActiveIntermediateDirectory() / "Script\\ExportBody.dll";
 	#endif
-#endif
-
-#if defined(KG_PLATFORM_LINUX)
+#elif defined(KG_PLATFORM_LINUX)
 	#if defined(KG_DEBUG) 
-			std::filesystem::path dllLocation { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportBodyDebug.so" };
+		return Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportBodyDebug.so";
 	#else
-			std::filesystem::path dllLocation { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportBody.so" };
+		return Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportBody.so";
 	#endif
 #endif
+	}
+
+	void ScriptService::LoadActiveScriptModule()
+	{
+		// Get the path to the script dll
+		std::filesystem::path dllLocation = GetActiveScriptModulePath();
 
 		// Rebuild shared library if no library exists
 		static bool attemptedToRebuild = false;
@@ -242,35 +252,115 @@ namespace Kargono::Scripting
 			return;
 		}
 
-		if (s_ScriptingData->DLLInstance)
+		// Copy the module to a unique location. Opening the same path twice would return the module that
+		//		is already loaded, and a loaded dll cannot be overwritten by the next build on Windows.
+		std::filesystem::path loadedModuleDirectory = dllLocation.parent_path() / "Loaded";
+		Utility::FileSystem::CreateNewDirectory(loadedModuleDirectory);
+		std::error_code ec;
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(loadedModuleDirectory, ec))
 		{
-			KG_INFO("Closing existing script module");
-			CloseActiveScriptModule();
+			// Clear copies left behind by previous sessions. Copies loaded by another process stay locked on Windows.
+			if (entry.path() != s_ScriptingData->LoadedModulePath)
+			{
+				std::filesystem::remove(entry.path(), ec);
+			}
 		}
+		std::filesystem::path loadedModulePath = loadedModuleDirectory / (dllLocation.stem().string() + "_" + std::string(UUID()) + dllLocation.extension().string());
+		uint64_t moduleSize{ 0 };
+		int64_t moduleWriteTime{ 0 };
+		if (!Utility::FileSystem::GetFileStamp(dllLocation, moduleSize, moduleWriteTime) ||
+			!Utility::FileSystem::CopySingleFile(dllLocation, loadedModulePath))
+		{
+			KG_CRITICAL("Failed to copy script module at {} before loading it", dllLocation.string());
+			return;
+		}
+
+		// Keep the current module open until the new module is ready
+		auto previousInstance = s_ScriptingData->DLLInstance;
+		std::filesystem::path previousModulePath = s_ScriptingData->LoadedModulePath;
+		s_ScriptingData->DLLInstance = nullptr;
+
 #if defined(KG_PLATFORM_WINDOWS)
 		s_ScriptingData->DLLInstance = new HINSTANCE();
-		*(s_ScriptingData->DLLInstance) = LoadLibrary(dllLocation.c_str());
+		*(s_ScriptingData->DLLInstance) = LoadLibrary(loadedModulePath.c_str());
 		if (*s_ScriptingData->DLLInstance == NULL)
 		{
 			KG_CRITICAL("Failed to open dll with path {} with an error code of {}", dllLocation.string(), GetLastError());
-			CloseActiveScriptModule();
+			delete s_ScriptingData->DLLInstance;
+			s_ScriptingData->DLLInstance = previousInstance;
+			Utility::FileSystem::DeleteSelectedFile(loadedModulePath);
 			return;
-	}
+		}
 #elif defined(KG_PLATFORM_LINUX)
-		s_ScriptingData->DLLInstance = dlopen(dllLocation.c_str(), RTLD_LAZY);
+		s_ScriptingData->DLLInstance = dlopen(loadedModulePath.c_str(), RTLD_LAZY);
 		if (s_ScriptingData->DLLInstance == NULL)
 		{
 			KG_CRITICAL("Failed to open dll with path {}", dllLocation.string());
-			CloseActiveScriptModule();
+			s_ScriptingData->DLLInstance = previousInstance;
+			Utility::FileSystem::DeleteSelectedFile(loadedModulePath);
 			return;
 		}
 #endif
+		s_ScriptingData->LoadedModulePath = loadedModulePath;
+		s_ScriptingData->LoadedModuleWriteTime = moduleWriteTime;
+		s_ScriptingData->ModuleVersion++;
 
 		ScriptModuleBuilder::AttachEngineFunctionsToModule();
+		ScriptModuleBuilder::ResolveModuleProjectComponentFields();
+
+		// Repoint the loaded scripts to the new module. Scripts are shared through the script cache,
+		//		so scenes and other holders keep their state and pick up the new functions.
+		if (previousInstance)
+		{
+			for (auto& [handle, scriptRef] : Assets::AssetService::GetScriptCache())
+			{
+				LoadScriptFunction(scriptRef, scriptRef->m_FuncType);
+			}
+
+			// Jobs from the current frame may still be running code from the previous module
+			if (JobService::IsActive())
+			{
+				JobService::WaitForFrameJobs();
+			}
+#if defined(KG_PLATFORM_WINDOWS)
+			FreeLibrary(*previousInstance);
+			delete previousInstance;
+#elif defined(KG_PLATFORM_LINUX)
+			dlclose(previousInstance);
+#endif
+			Utility::FileSystem::DeleteSelectedFile(previousModulePath);
+			KG_INFO("Hot reloaded script module (version {})", s_ScriptingData->ModuleVersion);
+		}
 
 		KG_VERIFY(s_ScriptingData->DLLInstance, "Scripting Module Opened");
 
 	}
+
+	bool ScriptService::ReloadScriptModuleIfModified()
+	{
+		if (!s_ScriptingData || !s_ScriptingData->DLLInstance)
+		{
+			return false;
+		}
+
+		// Compare the build output against the module that is currently loaded
+		uint64_t moduleSize{ 0 };
+		int64_t moduleWriteTime{ 0 };
+		if (!Utility::FileSystem::GetFileStamp(GetActiveScriptModulePath(), moduleSize, moduleWriteTime) ||
+			moduleWriteTime == s_ScriptingData->LoadedModuleWriteTime)
+		{
+			return false;
+		}
+
+		LoadActiveScriptModule();
+		return s_ScriptingData->LoadedModuleWriteTime == moduleWriteTime;
+	}
+
+	uint32_t ScriptService::GetScriptModuleVersion()
+	{
+		return s_ScriptingData ? s_ScriptingData->ModuleVersion : 0;
+	}
+
 	void ScriptService::CloseActiveScriptModule()
 	{
 		if (!s_ScriptingData)
@@ -306,6 +396,9 @@ namespace Kargono::Scripting
 #endif
 
 		s_ScriptingData->DLLInstance = nullptr;
+		Utility::FileSystem::DeleteSelectedFile(s_ScriptingData->LoadedModulePath);
+		s_ScriptingData->LoadedModulePath.clear();
+		s_ScriptingData->LoadedModuleWriteTime = 0;
 
 		KG_VERIFY(!s_ScriptingData->DLLInstance, "Close Scripting DLL");
 	}
@@ -491,172 +584,147 @@ namespace Kargono::Scripting
 	}
 }
 
-namespace Kargono::Utility
+//==============================
+// Engine Function Table
+//==============================
+// Every engine function the script module can call, listed as (module name, engine function, signature).
+//		The engine side table and the generated module side table are both expanded from this list,
+//		so their layouts always match.
+#define KG_SCRIPT_ENGINE_FUNCTIONS(Function) \
+Function(Application_Resize, ApplicationResize, void(uint16_t)) \
+	Function(Application_Close, EngineService::SubmitApplicationCloseEvent, void()) \
+	Function(AI_ChangeGlobalState, AI::AIService::ChangeGlobalState, void(uint64_t, uint64_t)) \
+	Function(AI_ChangeCurrentState, AI::AIService::ChangeCurrentState, void(uint64_t, uint64_t)) \
+	Function(AI_RevertPreviousState, AI::AIService::RevertPreviousState, void(uint64_t)) \
+	Function(AI_SendMessage, AI::AIService::SendAIMessage, void(uint32_t, uint64_t, uint64_t, float)) \
+	Function(AI_ClearGlobalState, AI::AIService::ClearGlobalState, void(uint64_t)) \
+	Function(AI_ClearCurrentState, AI::AIService::ClearCurrentState, void(uint64_t)) \
+	Function(AI_ClearPreviousState, AI::AIService::ClearPreviousState, void(uint64_t)) \
+	Function(AI_ClearAllStates, AI::AIService::ClearAllStates, void(uint64_t)) \
+	Function(AI_IsGlobalState, AI::AIService::IsGlobalState, bool(uint64_t, uint64_t)) \
+	Function(AI_IsCurrentState, AI::AIService::IsCurrentState, bool(uint64_t, uint64_t)) \
+	Function(AI_IsPreviousState, AI::AIService::IsPreviousState, bool(uint64_t, uint64_t)) \
+	Function(PlaySoundFromHandle, Audio::AudioService::PlaySoundFromHandle, void(uint64_t)) \
+	Function(PlayStereoSoundFromHandle, Audio::AudioService::PlayStereoSoundFromHandle, void(uint64_t)) \
+	Function(SignalAll, Network::ClientService::SignalAll, void(uint16_t)) \
+	Function(Log, Scripting::Log, void(const std::string&, const std::string&, const std::string&)) \
+	Function(ClearDebugLines, Scripting::ClearDebugLines, void()) \
+	Function(ClearDebugPoints, Scripting::ClearDebugPoints, void()) \
+	Function(AddDebugPoint, Scripting::AddDebugPoint, void(Math::vec3)) \
+	Function(AddDebugLine, Scripting::AddDebugLine, void(Math::vec3, Math::vec3)) \
+	Function(SetGameStateField, Scenes::GameStateService::SetActiveGameStateField, void(const std::string&, void*)) \
+	Function(GetGameStateField, Scenes::GameStateService::GetActiveGameStateField, void*(const std::string&)) \
+	Function(Input_IsKeyPressed, Input::InputService::IsKeyPressed, bool(uint16_t)) \
+	Function(InputMap_LoadInputMapFromHandle, Input::InputMapService::SetActiveInputMapFromHandle, void(uint64_t)) \
+	Function(InputMap_IsPollingSlotPressed, Input::InputMapService::IsPollingSlotPressed, bool(uint16_t)) \
+	Function(LeaveCurrentSession, Network::ClientService::LeaveCurrentSession, void()) \
+	Function(EnableReadyCheck, Network::ClientService::EnableReadyCheck, void()) \
+	Function(RequestJoinSession, Network::ClientService::RequestJoinSession, void()) \
+	Function(SendAllEntityPhysics, Network::ClientService::SendAllEntityPhysics, void(uint64_t, Math::vec3, Math::vec2)) \
+	Function(RequestUserCount, Network::ClientService::RequestUserCount, void()) \
+	Function(GetActiveSessionSlot, Network::ClientService::GetActiveSessionSlot, uint16_t()) \
+	Function(SendAllEntityLocation, Network::ClientService::SendAllEntityLocation, void(uint64_t, Math::vec3)) \
+	Function(Particles_AddEmitterByHandle, Particles::ParticleService::AddEmitterByHandle, void(uint64_t, Math::vec3)) \
+	Function(Physics_Raycast, Physics::Physics2DService::Raycast, Physics::RaycastResult(Math::vec2, Math::vec2)) \
+	Function(GenerateRandomInteger, Utility::RandomService::GenerateRandomInteger, int32_t(int32_t, int32_t)) \
+	Function(GenerateRandomFloat, Utility::RandomService::GenerateRandomFloat, float(float, float)) \
+	Function(RuntimeUI_SetWidgetText, RuntimeUI::RuntimeUIService::SetActiveWidgetTextByIndex, void(RuntimeUI::WidgetID, const std::string&)) \
+	Function(RuntimeUI_IsUserInterfaceActiveFromHandle, RuntimeUI::RuntimeUIService::IsUIActiveFromHandle, bool(uint64_t)) \
+	Function(RuntimeUI_LoadUserInterfaceFromHandle, RuntimeUI::RuntimeUIService::SetActiveUIFromHandle, void(uint64_t)) \
+	Function(RuntimeUI_SetDisplayWindow, RuntimeUI::RuntimeUIService::SetDisplayWindowByIndex, void(RuntimeUI::WindowID, bool)) \
+	Function(RuntimeUI_SetSelectedWidget, RuntimeUI::RuntimeUIService::SetSelectedWidgetByIndex, void(RuntimeUI::WidgetID)) \
+	Function(RuntimeUI_ClearSelectedWidget, RuntimeUI::RuntimeUIService::ClearSelectedWidget, void()) \
+	Function(RuntimeUI_SetWidgetTextColor, RuntimeUI::RuntimeUIService::SetWidgetTextColorByIndex, void(RuntimeUI::WidgetID, Math::vec4)) \
+	Function(RuntimeUI_SetWidgetBackgroundColor, RuntimeUI::RuntimeUIService::SetWidgetBackgroundColorByIndex, void(RuntimeUI::WidgetID, Math::vec4)) \
+	Function(RuntimeUI_SetWidgetSelectable, RuntimeUI::RuntimeUIService::SetWidgetSelectableByIndex, void(RuntimeUI::WidgetID, bool)) \
+	Function(RuntimeUI_IsWidgetSelected, RuntimeUI::RuntimeUIService::IsWidgetSelectedByIndex, bool(RuntimeUI::WidgetID)) \
+	Function(RuntimeUI_SetWidgetImage, RuntimeUI::RuntimeUIService::SetWidgetImageByIndex, void(RuntimeUI::WidgetID, uint64_t)) \
+	Function(RuntimeUI_GetWidgetText, RuntimeUI::RuntimeUIService::GetWidgetTextByIndex, const std::string&(RuntimeUI::WidgetID)) \
+	Function(TransitionSceneFromHandle, Scenes::SceneService::TransitionSceneFromHandle, void(uint64_t)) \
+	Function(CheckHasComponent, Scenes::SceneService::CheckActiveHasComponent, bool(uint64_t, const std::string&)) \
+	Function(FindEntityHandleByName, Scenes::SceneService::FindEntityHandleByName, uint64_t(const std::string&)) \
+	Function(Scenes_IsSceneActive, Scenes::SceneService::IsSceneActive, bool(uint64_t)) \
+	Function(Scenes_PreloadScene, Scenes::SceneService::PreloadScene, void(uint64_t)) \
+	Function(Scenes_IsScenePreloaded, Scenes::SceneService::IsScenePreloaded, bool(uint64_t)) \
+	Function(TransformComponent_GetTranslation, Scenes::SceneService::TransformComponentGetTranslation, Math::vec3(uint64_t)) \
+	Function(TransformComponent_SetTranslation, Scenes::SceneService::TransformComponentSetTranslation, void(uint64_t, Math::vec3)) \
+	Function(Rigidbody2DComponent_SetLinearVelocity, Scenes::SceneService::Rigidbody2DComponent_SetLinearVelocity, void(uint64_t, Math::vec2)) \
+	Function(Rigidbody2DComponent_GetLinearVelocity, Scenes::SceneService::Rigidbody2DComponent_GetLinearVelocity, Math::vec2(uint64_t)) \
+	Function(Scenes_GetProjectComponentField, Scenes::SceneService::GetProjectComponentField, void*(uint64_t, uint64_t)) \
+	Function(Scenes_ResolveProjectComponentField, Scenes::SceneService::ResolveProjectComponentField, uint64_t(uint64_t, uint64_t)) \
+	Function(TagComponent_GetTag, Scenes::SceneService::TagComponentGetTag, const std::string&(uint64_t))
+
+namespace Kargono::Scripting
 {
-#define DefineInsertFunction(name, returnType,...) \
-	typedef void (*Void_String_Func##name)(const std::string&, std::function<returnType(__VA_ARGS__)>); \
-	std::function<void(const std::string&, std::function<returnType(__VA_ARGS__)>)> s_Add##name {};
+	// C-ABI table of engine function pointers passed to the script module when it is loaded
+	struct EngineFunctionTable
+	{
+#define KG_DECLARE_ENGINE_FUNCTION(name, function, signature) std::add_pointer_t<signature> name;
+		KG_SCRIPT_ENGINE_FUNCTIONS(KG_DECLARE_ENGINE_FUNCTION)
+#undef KG_DECLARE_ENGINE_FUNCTION
+	};
 
+	// Provides the plain function pointer stored in the engine function table. Functions that already
+	//		match the table signature are stored directly. Others are called through a thunk.
+	template<auto k_Function, typename Signature>
+	struct EngineFunctionAdapter;
 
-#if defined(KG_PLATFORM_WINDOWS)
-#define ImportInsertFunction(name) \
-	s_Add##name = reinterpret_cast<Void_String_Func##name>(GetProcAddress(*s_ScriptingData->DLLInstance, "Add"#name ));\
-	if (!s_Add##name)\
-	{\
-		KG_CRITICAL("Could not load {} function from scripting dll", "" #name);\
-		return;\
-	}
+	template<auto k_Function, typename ReturnType, typename... Parameters>
+	struct EngineFunctionAdapter<k_Function, ReturnType(Parameters...)>
+	{
+		static ReturnType Call(Parameters... parameters)
+		{
+			if constexpr (std::is_void_v<ReturnType>)
+			{
+				k_Function(std::forward<Parameters>(parameters)...);
+			}
+			else
+			{
+				return k_Function(std::forward<Parameters>(parameters)...);
+			}
+		}
 
-#elif defined(KG_PLATFORM_LINUX)
-#define ImportInsertFunction(name) \
-	s_Add##name = reinterpret_cast<Void_String_Func##name>(dlsym(s_ScriptingData->DLLInstance, "Add"#name ));\
-	if (!s_Add##name)\
-	{\
-		KG_CRITICAL("Could not load {} function from scripting dll", "" #name);\
-		return;\
+		static constexpr ReturnType(*Get())(Parameters...)
+		{
+			if constexpr (std::is_same_v<decltype(k_Function), ReturnType(*)(Parameters...)>)
+			{
+				return k_Function;
+			}
+			else
+			{
+				return &Call;
+			}
+		}
+	};
+
+	// Generated files are only rewritten when their contents change. This keeps their write times
+	//		stable, so unchanged translation units are not recompiled.
+	static void WriteGeneratedFile(const std::filesystem::path& file, std::string contents)
+	{
+		Utility::Operations::RemoveCharacterFromString(contents, '\r');
+		if (Utility::FileSystem::PathExists(file) && Utility::FileSystem::ReadFileString(file) == contents)
+		{
+			return;
+		}
+		Utility::FileSystem::CreateNewDirectory(file.parent_path());
+		Utility::FileSystem::WriteFileString(file, contents);
 	}
-#endif
-#define AddImportFunctionToHeaderFile(name, returnType, ...) \
-	outputStream << "KARGONO_API void Add" << #name << "(const std::string& funcName, std::function<" << #returnType <<"(" << (#__VA_ARGS__ ")> funcPtr);\n");
-
-#define AddImportFunctionToCPPFile(name, returnType, ...) \
-	outputStream << "void Add" << #name << "(const std::string& funcName, std::function<" << #returnType <<"(" << (#__VA_ARGS__ ")> funcPtr)\n");
-
-#define AddEngineFunctionToCPPFileNoParameters(name, returnType) \
-	outputStream << "static std::function<" #returnType "()> " #name "Ptr {};\n"; \
-	outputStream << #returnType " " #name "()\n"; \
-	outputStream << "{\n"; \
-	outputStream << "\t"; \
-	if (!std::is_same<returnType, void>::value) \
-	{\
-	outputStream << "return "; \
-	}\
-	outputStream << #name "Ptr();\n"; \
-	outputStream << "}\n";
-#define AddEngineFunctionToCPPFileOneParameters(name, returnType, parameter1)\
-	outputStream << "static std::function<" #returnType "(" #parameter1 " a)> " #name "Ptr {};\n"; \
-	outputStream << #returnType " " #name "(" #parameter1 " a)\n"; \
-	outputStream << "{\n"; \
-	outputStream << "\t"; \
-	if (!std::is_same<returnType, void>::value) \
-	{\
-	outputStream << "return "; \
-	}\
-	outputStream << #name "Ptr(a);\n"; \
-	outputStream << "}\n";
-#define AddEngineFunctionToCPPFileTwoParameters(name, returnType, parameter1, parameter2)\
-	outputStream << "static std::function<" #returnType "(" #parameter1 " a, " #parameter2 " b)> " #name "Ptr {};\n"; \
-	outputStream << #returnType " " #name "(" #parameter1 " a, " #parameter2 " b)\n"; \
-	outputStream << "{\n"; \
-	outputStream << "\t"; \
-	if (!std::is_same<returnType, void>::value) \
-	{\
-	outputStream << "return "; \
-	}\
-	outputStream << #name "Ptr(a, b);\n"; \
-	outputStream << "}\n";
-
-#define AddEngineFunctionToCPPFileThreeParameters(name, returnType, parameter1, parameter2, parameter3)\
-	outputStream << "static std::function<" #returnType "(" #parameter1 " a, " #parameter2 " b, " #parameter3 " c)> " #name "Ptr {};\n"; \
-	outputStream << #returnType " " #name "(" #parameter1 " a, " #parameter2 " b, " #parameter3 " c)\n"; \
-	outputStream << "{\n"; \
-	outputStream << "\t"; \
-	if (!std::is_same<returnType, void>::value) \
-	{\
-	outputStream << "return "; \
-	}\
-	outputStream << #name "Ptr(a, b, c);\n"; \
-	outputStream << "}\n";
-
-#define AddEngineFunctionToCPPFileFourParameters(name, returnType, parameter1, parameter2, parameter3, parameter4)\
-	outputStream << "static std::function<" #returnType "(" #parameter1 " a, " #parameter2 " b, " #parameter3 " c,  " #parameter4 " d)> " #name "Ptr {};\n"; \
-	outputStream << #returnType " " #name "(" #parameter1 " a, " #parameter2 " b, " #parameter3 " c, " #parameter4 " d)\n"; \
-	outputStream << "{\n"; \
-	outputStream << "\t"; \
-	if (!std::is_same<returnType, void>::value) \
-	{\
-	outputStream << "return "; \
-	}\
-	outputStream << #name "Ptr(a, b, c, d);\n"; \
-	outputStream << "}\n";
-
-#define AddEngineFunctionToCPPFileEnd(name) \
-	outputStream << "if (funcName == \"" #name "\") { " #name "Ptr = funcPtr; return; }\n";
-
-#define AddEngineFunctionPointerToDll(name, funcDef, funcSignatureName) \
-	s_Add##funcSignatureName(#name, funcDef);
-}
 
-namespace Kargono::Scripting
-{
-	// Initial definitions and static members for insertion functions (functions that insert engine pointers into the scripting dll)
-
-	// Void return type
-	DefineInsertFunction(VoidNone, void)
-	DefineInsertFunction(VoidString, void, const std::string&)
-	DefineInsertFunction(VoidUInt16, void, uint16_t)
-	DefineInsertFunction(VoidUInt64, void, uint64_t)
-	DefineInsertFunction(VoidUInt64UInt64, void, uint64_t, uint64_t)
-	DefineInsertFunction(VoidVec3, void, Math::vec3)
-	DefineInsertFunction(VoidUInt32UInt32, void, uint32_t, uint32_t)
-	DefineInsertFunction(VoidVec3Float, void, Math::vec3, float)
-	DefineInsertFunction(VoidVec3Vec3, void, Math::vec3, Math::vec3)
-	DefineInsertFunction(VoidStringBool, void, const std::string&, bool)
-	DefineInsertFunction(VoidUInt16Bool, void, uint16_t, bool)
-	DefineInsertFunction(VoidUInt16UInt16, void, uint16_t, uint16_t)
-	DefineInsertFunction(VoidUIWidgetString, void, RuntimeUI::WidgetID, const std::string&)
-	DefineInsertFunction(VoidUIWindowBool, void, RuntimeUI::WindowID, bool)
-	DefineInsertFunction(VoidUIWidgetBool, void, RuntimeUI::WidgetID, bool)
-	DefineInsertFunction(VoidUIWidget, void, RuntimeUI::WidgetID)
-	DefineInsertFunction(VoidUIWidgetVec4, void, RuntimeUI::WidgetID, Math::vec4)
-	DefineInsertFunction(VoidUIWidgetUInt64, void, RuntimeUI::WidgetID, uint64_t)
-	DefineInsertFunction(VoidUInt16UInt16String, void, uint16_t, uint16_t, const std::string&)
-	DefineInsertFunction(VoidUInt16UInt16Bool, void, uint16_t, uint16_t, bool)
-	DefineInsertFunction(VoidStringVoidPtr, void, const std::string&, void*)
-	DefineInsertFunction(VoidStringString, void, const std::string&, const std::string&)
-	DefineInsertFunction(VoidStringStringBool, void, const std::string&, const std::string&, bool)
-	DefineInsertFunction(VoidStringStringString, void, const std::string&, const std::string&, const std::string&)
-	DefineInsertFunction(VoidPtrUInt64UInt64UInt64, void*, uint64_t, uint64_t, uint64_t)
-	DefineInsertFunction(VoidUInt64UInt64UInt64VoidPtr, void, uint64_t, uint64_t, uint64_t, void*)
-	DefineInsertFunction(VoidUInt32UInt64UInt64Float, void, uint32_t, uint64_t, uint64_t, float)
-	DefineInsertFunction(VoidStringStringVec4, void, const std::string&, const std::string&, Math::vec4)
-	DefineInsertFunction(VoidUInt16UInt16Vec4, void, uint16_t, uint16_t, Math::vec4)
-	DefineInsertFunction(VoidUInt64StringVoidPtr, void, uint64_t, const std::string&, void*)
-	DefineInsertFunction(VoidPtrString, void*, const std::string&)
-	DefineInsertFunction(VoidPtrUInt64String, void*, uint64_t, const std::string&)
-	DefineInsertFunction(VoidUInt64Vec2, void, uint64_t, Math::vec2)
-	DefineInsertFunction(VoidUInt64Vec3, void, uint64_t, Math::vec3)
-	DefineInsertFunction(VoidUInt64Vec3Vec2, void, uint64_t, Math::vec3, Math::vec2)
-	// Bool return type
-	DefineInsertFunction(BoolUIWidget, bool, RuntimeUI::WidgetID)
-	DefineInsertFunction(BoolStringString, bool, const std::string&, const std::string&)
-	DefineInsertFunction(BoolUInt64String, bool, uint64_t, const std::string&)
-	DefineInsertFunction(BoolUInt64UInt64, bool, uint64_t, uint64_t)
-	DefineInsertFunction(BoolUInt16UInt16, bool, uint16_t, uint16_t)
-	DefineInsertFunction(BoolUInt16, bool, uint16_t)
-	DefineInsertFunction(BoolUInt64, bool, uint64_t)
-	DefineInsertFunction(BoolString, bool, const std::string&)
-	// Integer return types
-	DefineInsertFunction(UInt16None, uint16_t)
-	DefineInsertFunction(Int32Int32Int32, int32_t, int32_t, int32_t)
-	DefineInsertFunction(UInt64String, uint64_t, const std::string&)
-	// Float return type
-	DefineInsertFunction(FloatFloatFloat, float, float, float)
-	// Vector return types
-	DefineInsertFunction(Vec2UInt64, Math::vec2, uint64_t)
-	DefineInsertFunction(Vec3UInt64, Math::vec3, uint64_t)
-	// String return type
-	DefineInsertFunction(StringUInt64, const std::string&, uint64_t)
-	DefineInsertFunction(StringUIWidget, const std::string&, RuntimeUI::WidgetID)
-	// Other return types
-	DefineInsertFunction(RaycastResultVec2Vec2, Physics::RaycastResult, Math::vec2, Math::vec2)
+	// A build output is stale if it is missing or older than the file it is built from
+	static bool IsGeneratedFileStale(const std::filesystem::path& outputFile, const std::filesystem::path& inputFile)
+	{
+		uint64_t outputSize{ 0 }, inputSize{ 0 };
+		int64_t outputWriteTime{ 0 }, inputWriteTime{ 0 };
+		if (!Utility::FileSystem::GetFileStamp(outputFile, outputSize, outputWriteTime) ||
+			!Utility::FileSystem::GetFileStamp(inputFile, inputSize, inputWriteTime))
+		{
+			return true;
+		}
+		return outputWriteTime < inputWriteTime;
+	}
 
 	void ScriptModuleBuilder::CreateScriptModule()
 	{
-		// Release active script module so it is available to be written to...
-		KG_INFO("Closing active script module...");
-		ScriptService::CloseActiveScriptModule();
-
 		// Load in ScriptRegistry if not already loaded
 		if (Assets::AssetService::GetScriptRegistry().size() == 0)
 		{
@@ -679,12 +747,14 @@ namespace Kargono::Scripting
 		}
 
 		KG_INFO("Creating Script Module CPP Files...");
-		CreateModuleHeaderFile();
-		bool generateCPPSuccess = CreateModuleCPPFile();
+		std::stringstream bridgeDeclarations {};
+		CreateModuleBridgeFile(bridgeDeclarations);
+		CreateModuleHeaderFile(bridgeDeclarations.str());
+		std::vector<std::filesystem::path> sourceFiles {};
+		bool generateCPPSuccess = CreateModuleScriptFiles(sourceFiles);
 		if (!generateCPPSuccess)
 		{
 			KG_WARN("Failure to generate C++ scripts from kgscripts");
-			ScriptService::LoadActiveScriptModule();
 			Assets::AssetService::DeserializeScriptRegistry();
 			return;
 		}
@@ -693,14 +763,13 @@ namespace Kargono::Scripting
 		Utility::FileSystem::DeleteSelectedFile("Log/BuildScriptLibraryDebug.log");
 		KG_INFO("Compiling debug script module...");
 #if defined(KG_PLATFORM_WINDOWS)
-		bool buildSuccessful = CompileModuleCodeMSVC(true);
+		bool buildSuccessful = CompileModuleCodeMSVC(true, sourceFiles);
 #elif defined(KG_PLATFORM_LINUX)
-		bool buildSuccessful = CompileModuleCodeGCC(true);
+		bool buildSuccessful = CompileModuleCodeGCC(true, sourceFiles);
 #endif
 		if (!buildSuccessful)
 		{
 			KG_WARN("Failure to compile script module");
-			ScriptService::LoadActiveScriptModule();
 			Assets::AssetService::DeserializeScriptRegistry();
 			return;
 		}
@@ -708,30 +777,24 @@ namespace Kargono::Scripting
 		Utility::FileSystem::DeleteSelectedFile("Log/BuildScriptLibrary.log");
 		KG_INFO("Compiling release script module...");
 #if defined(KG_PLATFORM_WINDOWS)
-		buildSuccessful = CompileModuleCodeMSVC(false);
+		buildSuccessful = CompileModuleCodeMSVC(false, sourceFiles);
 #elif defined(KG_PLATFORM_LINUX)
-		buildSuccessful = CompileModuleCodeGCC(false);
+		buildSuccessful = CompileModuleCodeGCC(false, sourceFiles);
 #endif
 		if (!buildSuccessful)
 		{
 			KG_WARN("Failed to compile release script module");
-			ScriptService::LoadActiveScriptModule();
 			Assets::AssetService::DeserializeScriptRegistry();
 			return;
 		}
 
+		// The running module stays loaded until the new one is opened next to it
 		KG_INFO("Opening New Scripting Module...");
-		ScriptService::LoadActiveScriptModule();
-
-		// Revalidate in-memory script cache
 		Assets::AssetService::DeserializeScriptRegistry();
-		for (auto& [handle, scriptRef] : Assets::AssetService::GetScriptCache())
-		{
-			ScriptService::LoadScriptFunction(scriptRef, scriptRef->m_FuncType);
-		}
+		ScriptService::LoadActiveScriptModule();
 		KG_INFO("Successfully build and loaded new script module");
 	}
-	void ScriptModuleBuilder::CreateModuleHeaderFile()
+	void ScriptModuleBuilder::CreateModuleHeaderFile(const std::string& bridgeDeclarations)
 	{
 
 		// Write out return value and function name
@@ -751,7 +814,7 @@ namespace Kargono::Scripting
 		outputStream << "#endif\n";
 #endif
 
-		outputStream << "#include <functional>\n";
+		outputStream << "#include <type_traits>\n";
 		outputStream << "#include <string>\n";
 		outputStream << "#include <sstream>\n";
 		outputStream << "#include <limits>\n";
@@ -768,69 +831,21 @@ namespace Kargono::Scripting
 
 		outputStream << "namespace Kargono\n";
 		outputStream << "{" << "\n";
+
+		// Engine function table layout, which must match the engine side EngineFunctionTable
+		outputStream << "struct EngineFunctionTable\n";
+		outputStream << "{\n";
+#define KG_WRITE_ENGINE_FUNCTION_FIELD(name, function, signature) \
+		outputStream << "\tstd::add_pointer_t<" #signature "> " #name ";\n";
+		KG_SCRIPT_ENGINE_FUNCTIONS(KG_WRITE_ENGINE_FUNCTION_FIELD)
+#undef KG_WRITE_ENGINE_FUNCTION_FIELD
+		outputStream << "};\n";
+
 		outputStream << "extern \"C\"" << "\n";
 		outputStream << "\t{" << "\n";
 
-		// Void return type
-		AddImportFunctionToHeaderFile(VoidNone, void)
-		AddImportFunctionToHeaderFile(VoidString, void, const std::string&)
-		AddImportFunctionToHeaderFile(VoidUInt16, void, uint16_t)
-		AddImportFunctionToHeaderFile(VoidUInt64, void, uint64_t)
-		AddImportFunctionToHeaderFile(VoidUInt64UInt64, void, uint64_t, uint64_t)
-		AddImportFunctionToHeaderFile(VoidVec3, void, Math::vec3)
-		AddImportFunctionToHeaderFile(VoidUInt32UInt32, void, uint32_t, uint32_t)
-		AddImportFunctionToHeaderFile(VoidVec3Float, void, Math::vec3, float)
-		AddImportFunctionToHeaderFile(VoidVec3Vec3, void, Math::vec3, Math::vec3)
-		AddImportFunctionToHeaderFile(VoidStringBool, void, const std::string&, bool)
-		AddImportFunctionToHeaderFile(VoidUInt16Bool, void, uint16_t, bool)
-		AddImportFunctionToHeaderFile(VoidStringVoidPtr, void, const std::string&, void*)
-		AddImportFunctionToHeaderFile(VoidStringString, void, const std::string&, const std::string&)
-		AddImportFunctionToHeaderFile(VoidStringStringBool, void, const std::string&, const std::string&, bool)
-		AddImportFunctionToHeaderFile(VoidStringStringString, void, const std::string&, const std::string&, const std::string&)
-		AddImportFunctionToHeaderFile(VoidStringStringVec4, void, const std::string&, const std::string&, Math::vec4)
-		AddImportFunctionToHeaderFile(VoidUInt16UInt16Vec4, void, uint16_t, uint16_t, Math::vec4)
-		AddImportFunctionToHeaderFile(VoidUInt16UInt16Bool, void, uint16_t, uint16_t, bool)
-		AddImportFunctionToHeaderFile(VoidUIWidgetString, void, RuntimeUI::WidgetID, const std::string&)
-		AddImportFunctionToHeaderFile(VoidUInt64StringVoidPtr, void, uint64_t, const std::string&, void*)
-		AddImportFunctionToHeaderFile(VoidPtrUInt64UInt64UInt64, void*, uint64_t, uint64_t, uint64_t)
-		AddImportFunctionToHeaderFile(VoidUInt64UInt64UInt64VoidPtr, void, uint64_t, uint64_t, uint64_t, void*)
-		AddImportFunctionToHeaderFile(VoidUInt32UInt64UInt64Float, void, uint32_t, uint64_t, uint64_t, float)
-		AddImportFunctionToHeaderFile(VoidUInt16UInt16, void, uint16_t, uint16_t)
-		AddImportFunctionToHeaderFile(VoidUInt16UInt16String, void, uint16_t, uint16_t, const std::string&)
-		AddImportFunctionToHeaderFile(VoidPtrString, void*, const std::string&)
-		AddImportFunctionToHeaderFile(VoidPtrUInt64String, void*, uint64_t, const std::string&)
-		AddImportFunctionToHeaderFile(VoidUInt64Vec3, void, uint64_t, Math::vec3)
-		AddImportFunctionToHeaderFile(VoidUInt64Vec2, void, uint64_t, Math::vec2)
-		AddImportFunctionToHeaderFile(VoidUInt64Vec3Vec2, void, uint64_t, Math::vec3, Math::vec2)
-		AddImportFunctionToHeaderFile(VoidUIWidgetString, void, RuntimeUI::WidgetID, const std::string&)
-		AddImportFunctionToHeaderFile(VoidUIWindowBool, void, RuntimeUI::WindowID, bool)
-		AddImportFunctionToHeaderFile(VoidUIWidgetBool, void, RuntimeUI::WidgetID, bool)
-		AddImportFunctionToHeaderFile(VoidUIWidget, void, RuntimeUI::WidgetID)
-		AddImportFunctionToHeaderFile(VoidUIWidgetVec4, void, RuntimeUI::WidgetID, Math::vec4)
-		AddImportFunctionToHeaderFile(VoidUIWidgetUInt64, void, RuntimeUI::WidgetID, uint64_t)
-		// Bool return type
-		AddImportFunctionToHeaderFile(BoolUIWidget, bool, RuntimeUI::WidgetID)
-		AddImportFunctionToHeaderFile(BoolStringString, bool, const std::string&, const std::string&)
-		AddImportFunctionToHeaderFile(BoolUInt64String, bool, uint64_t, const std::string&)
-		AddImportFunctionToHeaderFile(BoolUInt64UInt64, bool, uint64_t, uint64_t)
-		AddImportFunctionToHeaderFile(BoolUInt16, bool, uint16_t)
-		AddImportFunctionToHeaderFile(BoolUInt16UInt16, bool, uint16_t, uint16_t)
-		AddImportFunctionToHeaderFile(BoolUInt64, bool, uint64_t)
-		AddImportFunctionToHeaderFile(BoolString, bool, const std::string&)
-		// Integer return types
-		AddImportFunctionToHeaderFile(UInt16None, uint16_t)
-		AddImportFunctionToHeaderFile(UInt64String, uint64_t, const std::string&)
-		AddImportFunctionToHeaderFile(Int32Int32Int32, int32_t, int32_t, int32_t)
-		// Float return type
-		AddImportFunctionToHeaderFile(FloatFloatFloat, float, float, float)
-		// Vector return types
-		AddImportFunctionToHeaderFile(Vec2UInt64, Math::vec2, uint64_t)
-		AddImportFunctionToHeaderFile(Vec3UInt64, Math::vec3, uint64_t)
-		// String return type
-		AddImportFunctionToHeaderFile(StringUInt64, const std::string&, uint64_t)
-		AddImportFunctionToHeaderFile(StringUIWidget, const std::string&, RuntimeUI::WidgetID)
-		// Other return types
-		AddImportFunctionToHeaderFile(RaycastResultVec2Vec2, Physics::RaycastResult, Math::vec2, Math::vec2)
+		// Receives the engine function table when the module is loaded
+		outputStream << "\t\tKARGONO_API bool AttachEngineFunctions(const EngineFunctionTable* table, size_t tableSize);\n";
 
 		// Add Script Function Declarations
 		for (auto& [handle, asset] : Assets::AssetService::GetScriptRegistry())
@@ -877,320 +892,77 @@ namespace Kargono::Scripting
 			outputStream << ");" << "\n";
 		}
 
+		// Resolves the project component field accessors used by the module's scripts
+		outputStream << "\t\tKARGONO_API void ResolveProjectComponentFields();\n";
+
 		outputStream << "\t}" << "\n";
+
+		// Engine functions and project component field accessors defined in the bridge file
+		outputStream << bridgeDeclarations;
 		outputStream << "}" << "\n";
 
 		std::filesystem::path headerFile = { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportHeader.h" };
-
-		std::string outputString = outputStream.str();
-		Utility::Operations::RemoveCharacterFromString(outputString, '\r');
-
-		Utility::FileSystem::WriteFileString(headerFile, outputString);
+		WriteGeneratedFile(headerFile, outputStream.str());
 	}
 
-	bool ScriptModuleBuilder::CreateModuleCPPFile()
+	void ScriptModuleBuilder::CreateModuleBridgeFile(std::stringstream& declarationStream)
 	{
 		std::stringstream outputStream {};
 		outputStream << "#include \"ExportHeader.h\"\n";
 		outputStream << "namespace Kargono\n";
 		outputStream << "{\n";
 
-		// Insert Callable Function Definitions into CPP file
-
-		// Application
-		AddEngineFunctionToCPPFileNoParameters(Application_Close, void)
-		AddEngineFunctionToCPPFileOneParameters(Application_Resize, void, uint16_t)
-		// Artificial Intelligence
-		AddEngineFunctionToCPPFileOneParameters(AI_RevertPreviousState, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(AI_ClearGlobalState, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(AI_ClearCurrentState, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(AI_ClearPreviousState, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(AI_ClearAllStates, void, uint64_t)
-		AddEngineFunctionToCPPFileTwoParameters(AI_ChangeGlobalState, void, uint64_t, uint64_t)
-		AddEngineFunctionToCPPFileTwoParameters(AI_ChangeCurrentState, void, uint64_t, uint64_t)
-		AddEngineFunctionToCPPFileTwoParameters(AI_IsGlobalState, bool, uint64_t, uint64_t)
-		AddEngineFunctionToCPPFileTwoParameters(AI_IsCurrentState, bool, uint64_t, uint64_t)
-		AddEngineFunctionToCPPFileTwoParameters(AI_IsPreviousState, bool, uint64_t, uint64_t)
-		AddEngineFunctionToCPPFileFourParameters(AI_SendMessage, void, uint32_t, uint64_t, uint64_t, float)
-		// Audio
-		AddEngineFunctionToCPPFileOneParameters(PlaySoundFromHandle, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(PlayStereoSoundFromHandle, void, uint64_t)
-		// Debug
-		AddEngineFunctionToCPPFileNoParameters(ClearDebugLines, void)
-		AddEngineFunctionToCPPFileNoParameters(ClearDebugPoints, void)
-		AddEngineFunctionToCPPFileOneParameters(AddDebugPoint, void, Math::vec3)
-		AddEngineFunctionToCPPFileTwoParameters(AddDebugLine, void, Math::vec3, Math::vec3)
-		AddEngineFunctionToCPPFileThreeParameters(Log, void, const std::string&, const std::string&, const std::string&)
-		// Game State
-		AddEngineFunctionToCPPFileOneParameters(GetGameStateField, void*, const std::string&)
-		AddEngineFunctionToCPPFileTwoParameters(SetGameStateField, void, const std::string&, void*)
-		// Input
-		AddEngineFunctionToCPPFileOneParameters(Input_IsKeyPressed, bool, uint16_t)
-		AddEngineFunctionToCPPFileOneParameters(InputMap_LoadInputMapFromHandle, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(InputMap_IsPollingSlotPressed, bool, uint16_t)
-		// Network
-		AddEngineFunctionToCPPFileNoParameters(EnableReadyCheck, void)
-		AddEngineFunctionToCPPFileNoParameters(RequestUserCount, void)
-		AddEngineFunctionToCPPFileNoParameters(RequestJoinSession, void)
-		AddEngineFunctionToCPPFileNoParameters(LeaveCurrentSession, void)
-		AddEngineFunctionToCPPFileNoParameters(GetActiveSessionSlot, uint16_t)
-		AddEngineFunctionToCPPFileOneParameters(SignalAll, void, uint16_t)
-		AddEngineFunctionToCPPFileThreeParameters(SendAllEntityPhysics, void, uint64_t, Math::vec3, Math::vec2)
-		// Particles
-		AddEngineFunctionToCPPFileTwoParameters(Particles_AddEmitterByHandle, void, uint64_t, Math::vec3)
-		// Physics
-		AddEngineFunctionToCPPFileTwoParameters(Physics_Raycast, Physics::RaycastResult, Math::vec2, Math::vec2)
-		// Random
-		AddEngineFunctionToCPPFileTwoParameters(GenerateRandomInteger, int32_t, int32_t, int32_t)
-		AddEngineFunctionToCPPFileTwoParameters(GenerateRandomFloat, float, float, float)
-		// Scenes
-		AddEngineFunctionToCPPFileOneParameters(Scenes_IsSceneActive, bool, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(TransitionSceneFromHandle, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(TagComponent_GetTag, const std::string&, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(TransformComponent_GetTranslation, Math::vec3, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(Rigidbody2DComponent_GetLinearVelocity, Math::vec2, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(FindEntityHandleByName, uint64_t, const std::string&)
-		AddEngineFunctionToCPPFileTwoParameters(CheckHasComponent, bool, uint64_t, const std::string&)
-		AddEngineFunctionToCPPFileTwoParameters(SendAllEntityLocation, void, uint64_t, Math::vec3)
-		AddEngineFunctionToCPPFileTwoParameters(Rigidbody2DComponent_SetLinearVelocity, void, uint64_t, Math::vec2)
-		AddEngineFunctionToCPPFileTwoParameters(TransformComponent_SetTranslation, void, uint64_t, Math::vec3)
-		AddEngineFunctionToCPPFileThreeParameters(Scenes_GetProjectComponentField, void*, uint64_t, uint64_t, uint64_t)
-		AddEngineFunctionToCPPFileFourParameters(Scenes_SetProjectComponentField, void, uint64_t, uint64_t, uint64_t, void*)
-		// User Interface
-		AddEngineFunctionToCPPFileNoParameters(RuntimeUI_ClearSelectedWidget, void)
-		AddEngineFunctionToCPPFileOneParameters(RuntimeUI_IsUserInterfaceActiveFromHandle, bool, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(RuntimeUI_LoadUserInterfaceFromHandle, void, uint64_t)
-		AddEngineFunctionToCPPFileOneParameters(RuntimeUI_GetWidgetText, const std::string&, RuntimeUI::WidgetID
-		)
-		AddEngineFunctionToCPPFileOneParameters(RuntimeUI_SetSelectedWidget, void, RuntimeUI::WidgetID)
-		AddEngineFunctionToCPPFileOneParameters(RuntimeUI_IsWidgetSelected, bool, RuntimeUI::WidgetID)
-		AddEngineFunctionToCPPFileTwoParameters(RuntimeUI_SetDisplayWindow, void, RuntimeUI::WindowID, bool)
-		AddEngineFunctionToCPPFileTwoParameters(RuntimeUI_SetWidgetSelectable, void, RuntimeUI::WidgetID, bool)
-		AddEngineFunctionToCPPFileTwoParameters(RuntimeUI_SetWidgetText, void, RuntimeUI::WidgetID, const std::string&)
-		AddEngineFunctionToCPPFileTwoParameters(RuntimeUI_SetWidgetBackgroundColor, void, RuntimeUI::WidgetID, Math::vec4)
-		AddEngineFunctionToCPPFileTwoParameters(RuntimeUI_SetWidgetTextColor, void, RuntimeUI::WidgetID, Math::vec4)
-		AddEngineFunctionToCPPFileTwoParameters(RuntimeUI_SetWidgetImage, void, RuntimeUI::WidgetID, uint64_t)
-
-
-		// Insert FuncPointer Importing for DLL processing
-		AddImportFunctionToCPPFile(VoidNone, void)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(EnableReadyCheck)
-		AddEngineFunctionToCPPFileEnd(RequestUserCount)
-		AddEngineFunctionToCPPFileEnd(RequestJoinSession)
-		AddEngineFunctionToCPPFileEnd(LeaveCurrentSession)
-		AddEngineFunctionToCPPFileEnd(ClearDebugLines)
-		AddEngineFunctionToCPPFileEnd(ClearDebugPoints)
-		AddEngineFunctionToCPPFileEnd(Application_Close)
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_ClearSelectedWidget)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt16, void, uint16_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(SignalAll)
-		AddEngineFunctionToCPPFileEnd(Application_Resize)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidVec3, void, Math::vec3)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(AddDebugPoint)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidVec3Float, void, Math::vec3, float)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidVec3Vec3, void, Math::vec3, Math::vec3)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(AddDebugLine)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidString, void, const std::string&)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt64, void, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(AI_RevertPreviousState)
-		AddEngineFunctionToCPPFileEnd(AI_ClearGlobalState)
-		AddEngineFunctionToCPPFileEnd(AI_ClearCurrentState)
-		AddEngineFunctionToCPPFileEnd(AI_ClearPreviousState)
-		AddEngineFunctionToCPPFileEnd(AI_ClearAllStates)
-		AddEngineFunctionToCPPFileEnd(TransitionSceneFromHandle)
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_LoadUserInterfaceFromHandle)
-		AddEngineFunctionToCPPFileEnd(PlaySoundFromHandle)
-		AddEngineFunctionToCPPFileEnd(PlayStereoSoundFromHandle)
-		AddEngineFunctionToCPPFileEnd(InputMap_LoadInputMapFromHandle)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt64UInt64, void, uint64_t, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(AI_ChangeGlobalState)
-		AddEngineFunctionToCPPFileEnd(AI_ChangeCurrentState)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidStringBool, void, const std::string&, bool)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt16Bool, void, uint16_t, bool)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUIWindowBool, void, RuntimeUI::WindowID, bool)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_SetDisplayWindow)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt16UInt16, void, uint16_t, uint16_t)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUIWidget, void, RuntimeUI::WidgetID)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_SetSelectedWidget)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt16UInt16Bool, void, uint16_t, uint16_t, bool)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUIWidgetBool, void, RuntimeUI::WidgetID, bool)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_SetWidgetSelectable)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidStringVoidPtr, void, const std::string&, void*)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(SetGameStateField)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidStringString, void, const std::string&, const std::string&)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidStringStringBool, void, const std::string&, const std::string&, bool)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidStringStringString, void, const std::string&, const std::string&, const std::string&)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Log)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt16UInt16String, void, uint16_t, uint16_t, const std::string&)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUIWidgetString, void, RuntimeUI::WidgetID, const std::string&)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_SetWidgetText)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUIWidgetUInt64, void, RuntimeUI::WidgetID, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_SetWidgetImage)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidStringStringVec4, void, const std::string&, const std::string&, Math::vec4)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt64Vec3, void, uint64_t, Math::vec3)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(SendAllEntityLocation)
-		AddEngineFunctionToCPPFileEnd(TransformComponent_SetTranslation)
-		AddEngineFunctionToCPPFileEnd(Particles_AddEmitterByHandle)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt64Vec2, void, uint64_t, Math::vec2)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Rigidbody2DComponent_SetLinearVelocity)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolUInt64String, bool, uint64_t, const std::string&)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(CheckHasComponent)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolStringString, bool, const std::string&, const std::string&)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(UInt16None, uint16_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(GetActiveSessionSlot)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(Vec3UInt64, Math::vec3, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(TransformComponent_GetTranslation)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(Vec2UInt64, Math::vec2, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Rigidbody2DComponent_GetLinearVelocity)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(UInt64String, uint64_t, const std::string&)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(FindEntityHandleByName)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt64StringVoidPtr, void, uint64_t, const std::string&, void*)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt64Vec3Vec2, void, uint64_t, Math::vec3, Math::vec2)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(SendAllEntityPhysics)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt16UInt16Vec4, void, uint16_t, uint16_t, Math::vec4)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUIWidgetVec4, void, RuntimeUI::WidgetID, Math::vec4)
+		// Engine functions are plain function pointers filled in from the engine function table. Scripts
+		//		call them like regular functions without any wrapper or type erasure in between.
+#define KG_WRITE_ENGINE_FUNCTION_POINTER(name, function, signature) \
+		outputStream << "std::add_pointer_t<" #signature "> " #name " {nullptr};\n"; \
+		declarationStream << "extern std::add_pointer_t<" #signature "> " #name ";\n";
+		KG_SCRIPT_ENGINE_FUNCTIONS(KG_WRITE_ENGINE_FUNCTION_POINTER)
+#undef KG_WRITE_ENGINE_FUNCTION_POINTER
+
+		// Copy the table provided by the engine. A size mismatch means the module was generated by a
+		//		different engine version.
+		outputStream << "bool AttachEngineFunctions(const EngineFunctionTable* table, size_t tableSize)\n";
 		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_SetWidgetTextColor);
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_SetWidgetBackgroundColor);
+		outputStream << "\tif (!table || tableSize != sizeof(EngineFunctionTable)) { return false; }\n";
+#define KG_WRITE_ENGINE_FUNCTION_ASSIGNMENT(name, function, signature) \
+		outputStream << "\t" #name " = table->" #name ";\n";
+		KG_SCRIPT_ENGINE_FUNCTIONS(KG_WRITE_ENGINE_FUNCTION_ASSIGNMENT)
+#undef KG_WRITE_ENGINE_FUNCTION_ASSIGNMENT
+		outputStream << "\treturn true;\n";
 		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidPtrUInt64String, void*, uint64_t, const std::string&)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt32UInt32, void, uint32_t, uint32_t)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidPtrString, void*, const std::string&)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(GetGameStateField)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolUInt64UInt64, bool, uint64_t, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(AI_IsGlobalState)
-		AddEngineFunctionToCPPFileEnd(AI_IsCurrentState)
-		AddEngineFunctionToCPPFileEnd(AI_IsPreviousState)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(Int32Int32Int32, int32_t, int32_t, int32_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(GenerateRandomInteger)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(FloatFloatFloat, float, float, float)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(GenerateRandomFloat)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolUInt16, bool, uint16_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Input_IsKeyPressed)
-		AddEngineFunctionToCPPFileEnd(InputMap_IsPollingSlotPressed)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolString, bool, const std::string&)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolUInt64, bool, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Scenes_IsSceneActive)
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_IsUserInterfaceActiveFromHandle)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolUInt16UInt16, bool, uint16_t, uint16_t)
-		outputStream << "{\n";
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(BoolUIWidget, bool, RuntimeUI::WidgetID)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_IsWidgetSelected)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidPtrUInt64UInt64UInt64, void*, uint64_t, uint64_t, uint64_t)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Scenes_GetProjectComponentField)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt64UInt64UInt64VoidPtr, void, uint64_t, uint64_t, uint64_t, void*)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Scenes_SetProjectComponentField)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(VoidUInt32UInt64UInt64Float, void, uint32_t, uint64_t, uint64_t, float)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(AI_SendMessage)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(RaycastResultVec2Vec2, Physics::RaycastResult, Math::vec2, Math::vec2)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(Physics_Raycast)
-		outputStream << "}\n";
-		AddImportFunctionToCPPFile(StringUInt64, const std::string&, uint64_t)
+
+		// Insert cached accessors for every project component field. These are resolved once when
+		//		the module is loaded, so scripts can access fields without looking up the component asset.
+		std::stringstream resolveStream {};
+		for (auto& [handle, asset] : Assets::AssetService::GetProjectComponentRegistry())
+		{
+			Ref<ECS::ProjectComponent> projectComponent = Assets::AssetService::GetProjectComponent(handle);
+			KG_ASSERT(projectComponent);
+			for (size_t iteration{ 0 }; iteration < projectComponent->m_DataNames.size(); iteration++)
+			{
+				std::string accessorName = GetProjectComponentFieldAccessorName(handle, iteration);
+				outputStream << "uint64_t " << accessorName << " {std::numeric_limits<uint64_t>::max()};\n";
+				declarationStream << "extern uint64_t " << accessorName << ";\n";
+				resolveStream << accessorName << " = Scenes_ResolveProjectComponentField(" << std::to_string(handle) << ", " << std::to_string(iteration) << ");\n";
+			}
+		}
+		outputStream << "void ResolveProjectComponentFields()\n";
 		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(TagComponent_GetTag)
+		outputStream << resolveStream.str();
 		outputStream << "}\n";
-		AddImportFunctionToCPPFile(StringUIWidget, const std::string&, RuntimeUI::WidgetID)
-		outputStream << "{\n";
-		AddEngineFunctionToCPPFileEnd(RuntimeUI_GetWidgetText)
 		outputStream << "}\n";
 
-		// Write scripts into a single cpp file
+		std::filesystem::path file = { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/Sources/ExportBridge.cpp" };
+		WriteGeneratedFile(file, outputStream.str());
+	}
+
+	bool ScriptModuleBuilder::CreateModuleScriptFiles(std::vector<std::filesystem::path>& sourceFiles)
+	{
+		const std::filesystem::path sourceDirectory = Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/Sources/";
+		sourceFiles.push_back(sourceDirectory / "ExportBridge.cpp");
+
+		// Write each script into its own translation unit, so unchanged scripts are not recompiled
 		bool compilationSuccess{ true };
 		for (auto& [handle, asset] : Assets::AssetService::GetScriptRegistry())
 		{
@@ -1203,86 +975,130 @@ namespace Kargono::Scripting
 			{
 				KG_WARN("Failed to compile the script at: {}", asset.Data.FileLocation.string());
 				compilationSuccess = false;
+				continue;
 			}
+
+			std::stringstream outputStream {};
+			outputStream << "#include \"ExportHeader.h\"\n";
+			outputStream << "namespace Kargono\n";
+			outputStream << "{\n";
 			outputStream << compiledScript;
 			outputStream << '\n';
+			outputStream << "}\n";
+
+			std::filesystem::path file = { sourceDirectory / ("Script_" + std::to_string(handle) + ".cpp") };
+			WriteGeneratedFile(file, outputStream.str());
+			sourceFiles.push_back(file);
 		}
-		outputStream << "}\n";
 
 		if (!compilationSuccess)
 		{
 			return false;
 		}
 
-		std::filesystem::path file = { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportBody.cpp" };
-
-		std::string outputString = outputStream.str();
-		Utility::Operations::RemoveCharacterFromString(outputString, '\r');
-
-		Utility::FileSystem::WriteFileString(file, outputString);
+		// Remove translation units of deleted scripts
+		std::error_code ec;
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(sourceDirectory, ec))
+		{
+			if (std::find(sourceFiles.begin(), sourceFiles.end(), entry.path()) == sourceFiles.end())
+			{
+				Utility::FileSystem::DeleteSelectedFile(entry.path());
+			}
+		}
 		return true;
 	}
 
-	bool ScriptModuleBuilder::CompileModuleCodeMSVC(bool createDebug)
+	bool ScriptModuleBuilder::CompileModuleCodeMSVC(bool createDebug, const std::vector<std::filesystem::path>& sourceFiles)
 	{
-		Utility::FileSystem::CreateNewDirectory(Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/");
+		// Debug and release objects are kept apart, so both configurations build incrementally
 		std::filesystem::path binaryPath { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/" };
-		std::filesystem::path binaryFile;
-		std::filesystem::path objectPath;
+		std::filesystem::path objectPath { binaryPath / (createDebug ? "Debug/" : "Release/") };
+		Utility::FileSystem::CreateNewDirectory(objectPath);
+		std::filesystem::path binaryFile { binaryPath / (createDebug ? "ExportBodyDebug.dll" : "ExportBody.dll") };
+
+		UUID pdbID = UUID();
+		std::string pdbFileName = std::string(pdbID) + ".pdb";
+		std::filesystem::path debugSymbolsPath { binaryPath / pdbFileName };
+		std::filesystem::path headerPath { binaryPath / "ExportHeader.h" };
+		std::filesystem::path precompiledSourcePath { binaryPath / "ExportHeader.cpp" };
+		std::filesystem::path precompiledHeaderPath { objectPath / "ExportHeader.pch" };
+		std::filesystem::path precompiledObjectPath { objectPath / "ExportHeader.obj" };
+		WriteGeneratedFile(precompiledSourcePath, "#include \"ExportHeader.h\"\n");
+
+		// Options shared by the precompiled header and every translation unit
+		std::stringstream optionStream {};
 		if (createDebug)
 		{
-			binaryFile = { binaryPath / "ExportBodyDebug.dll" };
-			objectPath = { binaryPath / "ExportBody.obj" };
+			optionStream << "/MDd "; // Specify Debug Multi-threaded DLL Runtime Library
 		}
 		else
 		{
-			binaryFile = { binaryPath / "ExportBody.dll" };
-			objectPath = { binaryPath / "ExportBody.obj" };
+			optionStream << "/MD "; // Specify Multi-threaded DLL Runtime Library
 		}
-
-		UUID pdbID = UUID();
-		std::string pdbFileName = std::string(pdbID) + ".pdb";
-		std::filesystem::path debugSymbolsPath { binaryPath / pdbFileName };
-		std::filesystem::path sourcePath { Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportBody.cpp" };
+		optionStream << "/std:c++20 "; // Specify Language Version
+		optionStream << "/I../Dependencies/glm "; // Include GLM
+		optionStream << "/I../Engine/Source "; // Include Kargono as Include Directory
+		optionStream << "/I\"" << binaryPath.string() << "\" "; // Include the generated module header
+		optionStream << "/EHsc "; // Specifies the handling of exceptions and call stack unwinding. Uses the commands /EH, /EHs, and /EHc together
+		optionStream << "/DKARGONO_EXPORTS "; // Define Macros for Exporting DLL Functions
+		if (createDebug)
+		{
+			optionStream << "/Z7 "; // Add debug info to executable
+		}
+		optionStream << "/Fp\"" << precompiledHeaderPath.string() << "\" "; // Precompiled header location
+		const std::string compileOptions = optionStream.str();
+
+		// Find the translation units that changed since the last build
+		bool rebuildPrecompiledHeader = IsGeneratedFileStale(precompiledHeaderPath, headerPath);
+		std::vector<std::filesystem::path> staleSourceFiles {};
+		std::vector<std::filesystem::path> objectFiles { precompiledObjectPath };
+		for (const std::filesystem::path& sourceFile : sourceFiles)
+		{
+			std::filesystem::path objectFile { objectPath / sourceFile.stem() };
+			objectFile.replace_extension(".obj");
+			if (rebuildPrecompiledHeader || IsGeneratedFileStale(objectFile, sourceFile) || IsGeneratedFileStale(objectFile, precompiledHeaderPath))
+			{
+				staleSourceFiles.push_back(sourceFile);
+			}
+			objectFiles.push_back(objectFile);
+		}
+		KG_INFO("Compiling {} of {} script module translation units", staleSourceFiles.size(), sourceFiles.size());
 
 		std::stringstream outputStream {};
 		outputStream << "("; // Parentheses to group all function calls together
 		// Access visual studio toolset console
 		outputStream << "\"C:\\Program Files\\Microsoft Visual Studio\\2022\\Community\\VC\\Auxiliary\\Build\\vcvars64.bat\"";
 
-		// Start Next Command
-		//outputStream << " > Log\\ScriptCompilation.log 2>&1 "; // Sends error/info to log file
-		outputStream << " && "; // Combine commands
-
-		// Cl command for compiling binary code
-		outputStream << "cl "; // Add Command
-		outputStream << "/c "; // Tell cl command to only compile code
-		if (createDebug)
-		{
-			outputStream << "/MDd "; // Specify Debug Multi-threaded DLL Runtime Library
-		}
-		else
+		// Create the precompiled header for the engine bridge declarations
+		if (rebuildPrecompiledHeader)
 		{
-			outputStream << "/MD "; // Specify Multi-threaded DLL Runtime Library
+			outputStream << " && "; // Combine commands
+			outputStream << "cl "; // Add Command
+			outputStream << "/c "; // Tell cl command to only compile code
+			outputStream << compileOptions;
+			outputStream << "/Yc\"ExportHeader.h\" "; // Create the precompiled header
+			outputStream << "/Fo\"" << precompiledObjectPath.string() << "\" ";
+			outputStream << "\"" << precompiledSourcePath.string() << "\"";
 		}
-		outputStream << "/std:c++20 "; // Specify Language Version
-		outputStream << "/I../Dependencies/glm "; // Include GLM
-		outputStream << "/I../Engine/Source "; // Include Kargono as Include Directory
-		outputStream << "/EHsc "; // Specifies the handling of exceptions and call stack unwinding. Uses the commands /EH, /EHs, and /EHc together
-		outputStream << "/DKARGONO_EXPORTS "; // Define Macros for Exporting DLL Functions
 
-		if (createDebug)
+		// Cl command for compiling the changed translation units
+		if (!staleSourceFiles.empty())
 		{
-			outputStream << "/Z7 "; // Add debug info to executable
+			outputStream << " && "; // Combine commands
+			outputStream << "cl "; // Add Command
+			outputStream << "/c "; // Tell cl command to only compile code
+			outputStream << "/MP "; // Compile the translation units in parallel
+			outputStream << compileOptions;
+			outputStream << "/Yu\"ExportHeader.h\" "; // Use the precompiled header
+			outputStream << "/Fo" << "\"" << objectPath.string() << "\"" << ' '; // Define Intermediate Location
+			for (const std::filesystem::path& sourceFile : staleSourceFiles)
+			{
+				outputStream << "\"" << sourceFile.string() << "\"" << " ";
+			}
 		}
-		outputStream << "/Fo" << "\"" << binaryPath.string() << "\"" << ' '; // Define Intermediate Location
-		outputStream << "\"" << sourcePath.string() << "\"" << " "; // Compile scripting source file (ExportBody.cpp)
-
-		// Start Next Command
-		//outputStream << " > Log\\ScriptCompilation.log 2>&1 "; // Sends error/info to log file
-		outputStream << " && "; // Combine commands
 
 		// Start Linking Stage
+		outputStream << " && "; // Combine commands
 		outputStream << "link "; // Start link command
 		outputStream << "/DLL "; // Specify output as a shared library
 		outputStream << "/ignore:4099 "; // Ignores warning about missing pbd files for .obj files (I generate the symbols inside of the .obj file with /Z7 flag) 
@@ -1292,11 +1108,14 @@ namespace Kargono::Scripting
 			outputStream << "/PDB:" << "\"" << debugSymbolsPath.string() << "\"" << " "; // Specify .pdb file location/name
 		}
 		outputStream << "/OUT:" << "\"" << binaryFile.string() << "\"" << " "; // Specify output directory
-		outputStream << "\"" << objectPath.string() << "\""; // Object File to Link
+		for (const std::filesystem::path& objectFile : objectFiles)
+		{
+			outputStream << "\"" << objectFile.string() << "\"" << " "; // Object Files to Link
+		}
 
 		outputStream << ")"; // Parentheses to group all function calls together
 
-		// Sends all three calls (open dev console, compiler, and linker) error/info to log file
+		// Sends all calls (open dev console, compiler, and linker) error/info to log file
 		if (createDebug)
 		{
 			outputStream << " >> Log\\BuildScriptLibraryDebug.log 2>&1 ";
@@ -1310,53 +1129,91 @@ namespace Kargono::Scripting
 		return system(outputStream.str().c_str()) == 0;
 	}
 
-	bool ScriptModuleBuilder::CompileModuleCodeGCC(bool createDebug)
+	bool ScriptModuleBuilder::CompileModuleCodeGCC(bool createDebug, const std::vector<std::filesystem::path>& sourceFiles)
 	{
-		// Set up paths and files
-		Utility::FileSystem::CreateNewDirectory(Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/");
+		// Set up paths and files. Debug and release objects are kept apart, so both configurations build incrementally.
 		std::filesystem::path binaryPath = Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/";
-		std::filesystem::path binaryFile;
-		std::filesystem::path objectPath;
-		
+		std::filesystem::path objectPath = binaryPath / (createDebug ? "Debug/" : "Release/");
+		Utility::FileSystem::CreateNewDirectory(objectPath);
+		std::filesystem::path binaryFile = binaryPath / (createDebug ? "ExportBodyDebug.so" : "ExportBody.so"); // Using .so for shared libraries on Linux
+		std::filesystem::path headerPath = binaryPath / "ExportHeader.h";
+		std::filesystem::path precompiledHeaderPath = objectPath / "ExportHeader.h.gch";
+		const char* logFile = createDebug ? "Log/BuildScriptLibraryDebug.log" : "Log/BuildScriptLibrary.log";
+
+		// Options shared by the precompiled header and every translation unit
+		std::stringstream optionStream;
+		optionStream << "-fPIC "; // Ensure position independent code for 64bit arch
 		if (createDebug) 
 		{
-			binaryFile = binaryPath / "ExportBodyDebug.so";  // Using .so for shared libraries on Linux
-			objectPath = binaryPath / "ExportBody.o";       // Object file with .o extension
-		} 
-		else 
+			optionStream << "-g ";  // Enable debug symbols in the object file
+		}
+		optionStream << "-std=c++20 "; // Specify language version (C++20)
+		optionStream << "-I../Dependencies/glm "; // Include GLM headers
+		optionStream << "-I../Engine/Source ";  // Include Kargono headers
+		optionStream << "-fexceptions ";  // Handle exceptions
+		optionStream << "-D KARGONO_EXPORTS ";  // Define macros for exporting DLL functions
+		const std::string compileOptions = optionStream.str();
+
+		// Precompile the module header, which holds the engine bridge declarations
+		bool rebuildPrecompiledHeader = IsGeneratedFileStale(precompiledHeaderPath, headerPath);
+		if (rebuildPrecompiledHeader)
 		{
-			binaryFile = binaryPath / "ExportBody.so";
-			objectPath = binaryPath / "ExportBody.o";
+			std::stringstream outputStream;
+			outputStream << "(g++ -x c++-header " << compileOptions;
+			outputStream << "-o \"" << precompiledHeaderPath.string() << "\" ";
+			outputStream << "\"" << headerPath.string() << "\")";
+			outputStream << " >> " << logFile << " 2>&1 ";
+			if (system(outputStream.str().c_str()) != 0)
+			{
+				return false;
+			}
 		}
 
-		std::filesystem::path sourcePath = Projects::ProjectService::GetActiveIntermediateDirectory() / "Script/ExportBody.cpp";
-
-		// Set up the output stream for the commands
-		std::stringstream outputStream;
-		outputStream << "("; // Parentheses to group all function calls together
-
-		// Start GCC Command
-		outputStream << "g++ ";  // GCC compiler command
-		outputStream << "-c ";   // Tell GCC to only compile the code (not link)
-		outputStream << "-fPIC "; // Ensure position independent code for 64bit arch
-		if (createDebug) 
+		// Find the translation units that changed since the last build
+		std::vector<std::filesystem::path> objectFiles {};
+		std::vector<size_t> staleSourceIndices {};
+		for (size_t iteration{ 0 }; iteration < sourceFiles.size(); iteration++)
 		{
-			outputStream << "-g ";  // Enable debug symbols in the object file
+			std::filesystem::path objectFile { objectPath / sourceFiles.at(iteration).stem() };
+			objectFile.replace_extension(".o"); // Object file with .o extension
+			if (IsGeneratedFileStale(objectFile, sourceFiles.at(iteration)) || IsGeneratedFileStale(objectFile, precompiledHeaderPath))
+			{
+				staleSourceIndices.push_back(iteration);
+			}
+			objectFiles.push_back(objectFile);
 		}
-		outputStream << "-std=c++20 "; // Specify language version (C++20)
-		outputStream << "-I../Dependencies/glm "; // Include GLM headers
-		outputStream << "-I../Engine/Source ";  // Include Kargono headers
-		outputStream << "-fexceptions ";  // Handle exceptions
-		outputStream << "-D KARGONO_EXPORTS ";  // Define macros for exporting DLL functions
+		KG_INFO("Compiling {} of {} script module translation units", staleSourceIndices.size(), sourceFiles.size());
 
-		// Output the object file path
-		outputStream << "-o \"" << objectPath.string() << "\" ";  // Object file path
-		outputStream << "\"" << sourcePath.string() << "\" "; // Compile the source file
+		// Compile the changed translation units in parallel. GCC finds the precompiled header in the
+		//		object directory before it finds the header itself.
+		std::atomic<bool> compileSuccessful{ true };
+		JobService::ParallelFor(staleSourceIndices.size(), 1, [&](size_t begin, size_t end)
+		{
+			for (size_t iteration{ begin }; iteration < end; iteration++)
+			{
+				size_t sourceIndex = staleSourceIndices.at(iteration);
+				std::stringstream outputStream;
+				outputStream << "(g++ -c " << compileOptions;
+				outputStream << "-Winvalid-pch "; // Report an unusable precompiled header
+				outputStream << "-I\"" << objectPath.string() << "\" ";
+				outputStream << "-I\"" << binaryPath.string() << "\" ";
+				outputStream << "-o \"" << objectFiles.at(sourceIndex).string() << "\" ";  // Object file path
+				outputStream << "\"" << sourceFiles.at(sourceIndex).string() << "\")"; // Compile the source file
+				outputStream << " >> " << logFile << " 2>&1 ";
+				if (system(outputStream.str().c_str()) != 0)
+				{
+					compileSuccessful = false;
+				}
+			}
+		});
+		if (!compileSuccessful)
+		{
+			return false;
+		}
 
 		// Start Linking Stage
-		outputStream << "&& ";  // Combine commands
-
-		outputStream << "g++ ";  // GCC linker command
+		std::stringstream outputStream;
+		outputStream << "(g++ ";  // GCC linker command
 		outputStream << "-shared ";  // Create a shared library (.so)
 		outputStream << "-fPIC "; // Ensure position independent code for 64bit arch
 		if (createDebug) 
@@ -1365,159 +1222,64 @@ namespace Kargono::Scripting
 			outputStream << "-Wl,-Map=" << binaryPath / "ExportBody.map" << " "; // Map file for debugging
 		}
 		outputStream << "-o \"" << binaryFile.string() << "\" "; // Output shared library file path
-		outputStream << "\"" << objectPath.string() << "\" "; // Object file to link
-
-		outputStream << ")";  // Parentheses to group the commands
-
-		// Redirect logs if debugging
-		if (createDebug) 
+		for (const std::filesystem::path& objectFile : objectFiles)
 		{
-			outputStream << " >> Log/BuildScriptLibraryDebug.log 2>&1 ";
-		} 
-		else 
-		{
-			outputStream << " >> Log/BuildScriptLibrary.log 2>&1 ";
+			outputStream << "\"" << objectFile.string() << "\" "; // Object files to link
 		}
+		outputStream << ")";  // Parentheses to group the commands
+		outputStream << " >> " << logFile << " 2>&1 ";
 
 		// Call system command
 		return system(outputStream.str().c_str()) == 0;
 	}
 
 
+	std::string ScriptModuleBuilder::GetProjectComponentFieldAccessorName(Assets::AssetHandle projectComponentHandle, size_t fieldIndex)
+	{
+		return "ProjectComponentField_" + std::to_string(projectComponentHandle) + "_" + std::to_string(fieldIndex);
+	}
+
+	void ScriptModuleBuilder::ResolveModuleProjectComponentFields()
+	{
+		typedef void (*ResolveFieldsFunction)();
+#if defined(KG_PLATFORM_WINDOWS)
+		ResolveFieldsFunction resolveFields = reinterpret_cast<ResolveFieldsFunction>(GetProcAddress(*s_ScriptingData->DLLInstance, "ResolveProjectComponentFields"));
+#elif defined(KG_PLATFORM_LINUX)
+		ResolveFieldsFunction resolveFields = reinterpret_cast<ResolveFieldsFunction>(dlsym(s_ScriptingData->DLLInstance, "ResolveProjectComponentFields"));
+#endif
+		if (!resolveFields)
+		{
+			KG_WARN("Script module does not export ResolveProjectComponentFields. Project component fields will not be accessible.");
+			return;
+		}
+		resolveFields();
+	}
+
 	void ScriptModuleBuilder::AttachEngineFunctionsToModule()
 	{
-		// Void return type
-		ImportInsertFunction(VoidNone)
-		ImportInsertFunction(VoidUInt16)
-		ImportInsertFunction(VoidUInt64)
-		ImportInsertFunction(VoidString)
-		ImportInsertFunction(VoidVec3)
-		ImportInsertFunction(VoidUInt32UInt32)
-		ImportInsertFunction(VoidVec3Float)
-		ImportInsertFunction(VoidVec3Vec3)
-		ImportInsertFunction(VoidPtrString)
-		ImportInsertFunction(VoidStringBool)
-		ImportInsertFunction(VoidUInt16Bool)
-		ImportInsertFunction(VoidUInt16UInt16)
-		ImportInsertFunction(VoidUInt16UInt16String)
-		ImportInsertFunction(VoidUInt16UInt16Bool)
-		ImportInsertFunction(VoidStringVoidPtr)
-		ImportInsertFunction(VoidStringString)
-		ImportInsertFunction(VoidStringStringBool)
-		ImportInsertFunction(VoidStringStringString)
-		ImportInsertFunction(VoidStringStringVec4)
-		ImportInsertFunction(VoidUInt64StringVoidPtr)
-		ImportInsertFunction(VoidPtrUInt64UInt64UInt64)
-		ImportInsertFunction(VoidUInt64UInt64UInt64VoidPtr)
-		ImportInsertFunction(VoidUInt32UInt64UInt64Float)
-		ImportInsertFunction(VoidUInt16UInt16Vec4)
-		ImportInsertFunction(VoidPtrUInt64String)
-		ImportInsertFunction(VoidUInt64Vec3)
-		ImportInsertFunction(VoidUInt64Vec2)
-		ImportInsertFunction(VoidUInt64UInt64)
-		ImportInsertFunction(VoidUInt64Vec3Vec2)
-		ImportInsertFunction(VoidUIWidgetString)
-		ImportInsertFunction(VoidUIWindowBool)
-		ImportInsertFunction(VoidUIWidgetBool)
-		ImportInsertFunction(VoidUIWidget)
-		ImportInsertFunction(VoidUIWidgetVec4)
-		ImportInsertFunction(VoidUIWidgetUInt64)
-		// Bool return type
-		ImportInsertFunction(BoolUIWidget)
-		ImportInsertFunction(BoolStringString)
-		ImportInsertFunction(BoolUInt64String)
-		ImportInsertFunction(BoolUInt64UInt64)
-		ImportInsertFunction(BoolUInt16)
-		ImportInsertFunction(BoolUInt16UInt16)
-		ImportInsertFunction(BoolUInt64)
-		ImportInsertFunction(BoolString)
-		// Integer return types
-		ImportInsertFunction(UInt16None)
-		ImportInsertFunction(UInt64String)
-		ImportInsertFunction(Int32Int32Int32)
-		// Float return type
-		ImportInsertFunction(FloatFloatFloat)
-		// Vector return types
-		ImportInsertFunction(Vec2UInt64)
-		ImportInsertFunction(Vec3UInt64)
-		// String return types
-		ImportInsertFunction(StringUInt64)
-		ImportInsertFunction(StringUIWidget)
-		// Other return types
-		ImportInsertFunction(RaycastResultVec2Vec2)
-
-		// Application
-		AddEngineFunctionPointerToDll(Application_Resize, ApplicationResize, VoidUInt16)
-		AddEngineFunctionPointerToDll(Application_Close, EngineService::SubmitApplicationCloseEvent, VoidNone)
-		// Artificial Intelligence
-		AddEngineFunctionPointerToDll(AI_ChangeGlobalState, AI::AIService::ChangeGlobalState, VoidUInt64UInt64)
-		AddEngineFunctionPointerToDll(AI_ChangeCurrentState, AI::AIService::ChangeCurrentState, VoidUInt64UInt64)
-		AddEngineFunctionPointerToDll(AI_RevertPreviousState, AI::AIService::RevertPreviousState, VoidUInt64)
-		AddEngineFunctionPointerToDll(AI_SendMessage, AI::AIService::SendAIMessage, VoidUInt32UInt64UInt64Float)
-		AddEngineFunctionPointerToDll(AI_ClearGlobalState, AI::AIService::ClearGlobalState, VoidUInt64)
-		AddEngineFunctionPointerToDll(AI_ClearCurrentState, AI::AIService::ClearCurrentState, VoidUInt64)
-		AddEngineFunctionPointerToDll(AI_ClearPreviousState, AI::AIService::ClearPreviousState, VoidUInt64)
-		AddEngineFunctionPointerToDll(AI_ClearAllStates, AI::AIService::ClearAllStates, VoidUInt64)
-		AddEngineFunctionPointerToDll(AI_IsGlobalState, AI::AIService::IsGlobalState, BoolUInt64UInt64)
-		AddEngineFunctionPointerToDll(AI_IsCurrentState, AI::AIService::IsCurrentState, BoolUInt64UInt64)
-		AddEngineFunctionPointerToDll(AI_IsPreviousState, AI::AIService::IsPreviousState, BoolUInt64UInt64)
-		// Audio
-		AddEngineFunctionPointerToDll(PlaySoundFromHandle, Audio::AudioService::PlaySoundFromHandle, VoidUInt64)
-		AddEngineFunctionPointerToDll(PlayStereoSoundFromHandle, Audio::AudioService::PlayStereoSoundFromHandle, VoidUInt64)
-		AddEngineFunctionPointerToDll(SignalAll, Network::ClientService::SignalAll, VoidUInt16)
-		// Debug
-		AddEngineFunctionPointerToDll(Log, Scripting::Log, VoidStringStringString)
-		AddEngineFunctionPointerToDll(ClearDebugLines, Scripting::ClearDebugLines, VoidNone)
-		AddEngineFunctionPointerToDll(ClearDebugPoints, Scripting::ClearDebugPoints, VoidNone)
-		AddEngineFunctionPointerToDll(AddDebugPoint, Scripting::AddDebugPoint, VoidVec3)
-		AddEngineFunctionPointerToDll(AddDebugLine, Scripting::AddDebugLine, VoidVec3Vec3)
-		// Game State
-		AddEngineFunctionPointerToDll(SetGameStateField, Scenes::GameStateService::SetActiveGameStateField, VoidStringVoidPtr)
-		AddEngineFunctionPointerToDll(GetGameStateField, Scenes::GameStateService::GetActiveGameStateField, VoidPtrString)
-		// Input
-		AddEngineFunctionPointerToDll(Input_IsKeyPressed, Input::InputService::IsKeyPressed, BoolUInt16)
-		AddEngineFunctionPointerToDll(InputMap_LoadInputMapFromHandle, Input::InputMapService::SetActiveInputMapFromHandle, VoidUInt64)
-		AddEngineFunctionPointerToDll(InputMap_IsPollingSlotPressed, Input::InputMapService::IsPollingSlotPressed, BoolUInt16)
-		// Networking
-		AddEngineFunctionPointerToDll(LeaveCurrentSession, Network::ClientService::LeaveCurrentSession, VoidNone)
-		AddEngineFunctionPointerToDll(EnableReadyCheck, Network::ClientService::EnableReadyCheck, VoidNone)
-		AddEngineFunctionPointerToDll(RequestJoinSession, Network::ClientService::RequestJoinSession, VoidNone)
-		AddEngineFunctionPointerToDll(SendAllEntityPhysics, Network::ClientService::SendAllEntityPhysics, VoidUInt64Vec3Vec2)
-		AddEngineFunctionPointerToDll(RequestUserCount, Network::ClientService::RequestUserCount, VoidNone)
-		AddEngineFunctionPointerToDll(GetActiveSessionSlot, Network::ClientService::GetActiveSessionSlot, UInt16None)
-		AddEngineFunctionPointerToDll(SendAllEntityLocation, Network::ClientService::SendAllEntityLocation, VoidUInt64Vec3)
-		// Particles
-		AddEngineFunctionPointerToDll(Particles_AddEmitterByHandle, Particles::ParticleService::AddEmitterByHandle, VoidUInt64Vec3)
-		// Physics 2D
-		AddEngineFunctionPointerToDll(Physics_Raycast, Physics::Physics2DService::Raycast, RaycastResultVec2Vec2)
-		// Random
-		AddEngineFunctionPointerToDll(GenerateRandomInteger, Utility::RandomService::GenerateRandomInteger, Int32Int32Int32)
-		AddEngineFunctionPointerToDll(GenerateRandomFloat, Utility::RandomService::GenerateRandomFloat, FloatFloatFloat)
-		// Runtime User Interface
-		AddEngineFunctionPointerToDll(RuntimeUI_SetWidgetText, RuntimeUI::RuntimeUIService::SetActiveWidgetTextByIndex, VoidUIWidgetString)
-		AddEngineFunctionPointerToDll(RuntimeUI_IsUserInterfaceActiveFromHandle, RuntimeUI::RuntimeUIService::IsUIActiveFromHandle, BoolUInt64)
-		AddEngineFunctionPointerToDll(RuntimeUI_LoadUserInterfaceFromHandle, RuntimeUI::RuntimeUIService::SetActiveUIFromHandle, VoidUInt64)
-		AddEngineFunctionPointerToDll(RuntimeUI_SetDisplayWindow, RuntimeUI::RuntimeUIService::SetDisplayWindowByIndex, VoidUIWindowBool)
-		AddEngineFunctionPointerToDll(RuntimeUI_SetSelectedWidget, RuntimeUI::RuntimeUIService::SetSelectedWidgetByIndex, VoidUIWidget)
-		AddEngineFunctionPointerToDll(RuntimeUI_ClearSelectedWidget, RuntimeUI::RuntimeUIService::ClearSelectedWidget, VoidNone)
-		AddEngineFunctionPointerToDll(RuntimeUI_SetWidgetTextColor, RuntimeUI::RuntimeUIService::SetWidgetTextColorByIndex, VoidUIWidgetVec4)
-		AddEngineFunctionPointerToDll(RuntimeUI_SetWidgetBackgroundColor, RuntimeUI::RuntimeUIService::SetWidgetBackgroundColorByIndex, VoidUIWidgetVec4)
-		AddEngineFunctionPointerToDll(RuntimeUI_SetWidgetSelectable, RuntimeUI::RuntimeUIService::SetWidgetSelectableByIndex, VoidUIWidgetBool)
-		AddEngineFunctionPointerToDll(RuntimeUI_IsWidgetSelected, RuntimeUI::RuntimeUIService::IsWidgetSelectedByIndex, BoolUIWidget)
-		AddEngineFunctionPointerToDll(RuntimeUI_SetWidgetImage, RuntimeUI::RuntimeUIService::SetWidgetImageByIndex, VoidUIWidgetUInt64)
-		AddEngineFunctionPointerToDll(RuntimeUI_GetWidgetText, RuntimeUI::RuntimeUIService::GetWidgetTextByIndex, StringUIWidget)
-		// Scenes
-		AddEngineFunctionPointerToDll(TransitionSceneFromHandle, Scenes::SceneService::TransitionSceneFromHandle, VoidUInt64)
-		AddEngineFunctionPointerToDll(CheckHasComponent, Scenes::SceneService::CheckActiveHasComponent, BoolUInt64String)
-		AddEngineFunctionPointerToDll(FindEntityHandleByName, Scenes::SceneService::FindEntityHandleByName, UInt64String)
-		AddEngineFunctionPointerToDll(Scenes_IsSceneActive, Scenes::SceneService::IsSceneActive, BoolUInt64)
-		AddEngineFunctionPointerToDll(TransformComponent_GetTranslation, Scenes::SceneService::TransformComponentGetTranslation, Vec3UInt64)
-		AddEngineFunctionPointerToDll(TransformComponent_SetTranslation, Scenes::SceneService::TransformComponentSetTranslation, VoidUInt64Vec3)
-		AddEngineFunctionPointerToDll(Rigidbody2DComponent_SetLinearVelocity, Scenes::SceneService::Rigidbody2DComponent_SetLinearVelocity, VoidUInt64Vec2)
-		AddEngineFunctionPointerToDll(Rigidbody2DComponent_GetLinearVelocity, Scenes::SceneService::Rigidbody2DComponent_GetLinearVelocity, Vec2UInt64)
-		AddEngineFunctionPointerToDll(Scenes_GetProjectComponentField, Scenes::SceneService::GetProjectComponentField, VoidPtrUInt64UInt64UInt64)
-		AddEngineFunctionPointerToDll(Scenes_SetProjectComponentField, Scenes::SceneService::SetProjectComponentField, VoidUInt64UInt64UInt64VoidPtr)
-		AddEngineFunctionPointerToDll(TagComponent_GetTag, Scenes::SceneService::TagComponentGetTag, StringUInt64)
-		
+		// Fill the engine function table
+		EngineFunctionTable engineFunctions{};
+#define KG_FILL_ENGINE_FUNCTION(name, function, signature) \
+		engineFunctions.name = EngineFunctionAdapter<function, signature>::Get();
+		KG_SCRIPT_ENGINE_FUNCTIONS(KG_FILL_ENGINE_FUNCTION)
+#undef KG_FILL_ENGINE_FUNCTION
+
+		// Pass the table to the module
+		typedef bool (*AttachEngineFunctionsFunction)(const EngineFunctionTable*, size_t);
+#if defined(KG_PLATFORM_WINDOWS)
+		AttachEngineFunctionsFunction attachFunctions = reinterpret_cast<AttachEngineFunctionsFunction>(GetProcAddress(*s_ScriptingData->DLLInstance, "AttachEngineFunctions"));
+#elif defined(KG_PLATFORM_LINUX)
+		AttachEngineFunctionsFunction attachFunctions = reinterpret_cast<AttachEngineFunctionsFunction>(dlsym(s_ScriptingData->DLLInstance, "AttachEngineFunctions"));
+#endif
+		if (!attachFunctions)
+		{
+			KG_CRITICAL("Could not load AttachEngineFunctions function from scripting dll. The script module should be rebuilt.");
+			return;
+		}
+		if (!attachFunctions(&engineFunctions, sizeof(EngineFunctionTable)))
+		{
+			KG_CRITICAL("Script module engine function table does not match the engine. The script module should be rebuilt.");
+			return;
+		}
 	}
 }
@@ -31,8 +31,16 @@ namespace Kargono::Scripting
 		//==============================
 		// Manage Active Script Module
 		//==============================
+		// Opens the active project's script module. If a module is already open, the new module is
+		//		loaded next to it, every cached script is repointed to it, and the old module is
+		//		closed afterwards, so the running scene is left untouched.
 		static void LoadActiveScriptModule();
+		// Hot reloads the script module if it was rebuilt since it was loaded. Returns true if a
+		//		new module was loaded.
+		static bool ReloadScriptModuleIfModified();
 		static void CloseActiveScriptModule();
+		// Incremented every time a script module is loaded
+		static uint32_t GetScriptModuleVersion();
 
 		//==============================
 		// Manage Individual Scripts
@@ -1,6 +1,7 @@
 #include "kgpch.h"
 
 #include "Kargono/Utility/FileSystem.h"
+#include "Kargono/Core/MappedFile.h"
 #include "Kargono/Rendering/Texture.h"
 
 #include "API/ImageProcessing/stbAPI.h"
@@ -358,6 +359,23 @@ namespace Kargono::Utility
 		return !(full.root_path() != base.root_path()) && std::equal(base.begin(), base.end(), full.begin());
 	}
 
+	bool FileSystem::GetFileStamp(const std::filesystem::path& filepath, uint64_t& fileSize, int64_t& writeTime) noexcept
+	{
+		std::error_code ec;
+		fileSize = std::filesystem::file_size(filepath, ec);
+		if (ec)
+		{
+			return false;
+		}
+		std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(filepath, ec);
+		if (ec)
+		{
+			return false;
+		}
+		writeTime = (int64_t)lastWriteTime.time_since_epoch().count();
+		return true;
+	}
+
 	std::filesystem::path FileSystem::GetRelativePath(const std::filesystem::path& base,
 	                                                  const std::filesystem::path& full) noexcept
 	{
@@ -427,6 +445,128 @@ namespace Kargono::Utility
 		CRC32 crc;
 		return crc.CalculateHash(bufferPointer, bufferSize);
 	}
+
+	// XXH64 primes
+	static constexpr uint64_t k_HashPrime1{ 0x9E3779B185EBCA87ull };
+	static constexpr uint64_t k_HashPrime2{ 0xC2B2AE3D27D4EB4Full };
+	static constexpr uint64_t k_HashPrime3{ 0x165667B19E3779F9ull };
+	static constexpr uint64_t k_HashPrime4{ 0x85EBCA77C2B2AE63ull };
+	static constexpr uint64_t k_HashPrime5{ 0x27D4EB2F165667C5ull };
+
+	static inline uint64_t RotateLeft(uint64_t value, uint32_t count)
+	{
+		return (value << count) | (value >> (64 - count));
+	}
+
+	static inline uint64_t ReadUnaligned64(const uint8_t* data)
+	{
+		uint64_t value;
+		std::memcpy(&value, data, sizeof(uint64_t));
+		return value;
+	}
+
+	static inline uint32_t ReadUnaligned32(const uint8_t* data)
+	{
+		uint32_t value;
+		std::memcpy(&value, data, sizeof(uint32_t));
+		return value;
+	}
+
+	static inline uint64_t HashRound(uint64_t accumulator, uint64_t input)
+	{
+		accumulator += input * k_HashPrime2;
+		accumulator = RotateLeft(accumulator, 31);
+		return accumulator * k_HashPrime1;
+	}
+
+	static inline uint64_t HashMergeRound(uint64_t accumulator, uint64_t value)
+	{
+		accumulator ^= HashRound(0, value);
+		return accumulator * k_HashPrime1 + k_HashPrime4;
+	}
+
+	uint64_t FileSystem::FastHashFromBuffer(const void* bufferPointer, uint64_t bufferSize, uint64_t seed)
+	{
+		const uint8_t* data = static_cast<const uint8_t*>(bufferPointer);
+		const uint8_t* end = data + bufferSize;
+		uint64_t hash;
+
+		if (bufferSize >= 32)
+		{
+			// The four lanes are independent, so the CPU processes them in parallel
+			uint64_t lane1{ seed + k_HashPrime1 + k_HashPrime2 };
+			uint64_t lane2{ seed + k_HashPrime2 };
+			uint64_t lane3{ seed };
+			uint64_t lane4{ seed - k_HashPrime1 };
+			const uint8_t* stripeEnd = end - 32;
+			do
+			{
+				lane1 = HashRound(lane1, ReadUnaligned64(data));
+				lane2 = HashRound(lane2, ReadUnaligned64(data + 8));
+				lane3 = HashRound(lane3, ReadUnaligned64(data + 16));
+				lane4 = HashRound(lane4, ReadUnaligned64(data + 24));
+				data += 32;
+			} while (data <= stripeEnd);
+
+			hash = RotateLeft(lane1, 1) + RotateLeft(lane2, 7) + RotateLeft(lane3, 12) + RotateLeft(lane4, 18);
+			hash = HashMergeRound(hash, lane1);
+			hash = HashMergeRound(hash, lane2);
+			hash = HashMergeRound(hash, lane3);
+			hash = HashMergeRound(hash, lane4);
+		}
+		else
+		{
+			hash = seed + k_HashPrime5;
+		}
+		hash += bufferSize;
+
+		// Process the remaining bytes
+		while (data + 8 <= end)
+		{
+			hash ^= HashRound(0, ReadUnaligned64(data));
+			hash = RotateLeft(hash, 27) * k_HashPrime1 + k_HashPrime4;
+			data += 8;
+		}
+		if (data + 4 <= end)
+		{
+			hash ^= (uint64_t)ReadUnaligned32(data) * k_HashPrime1;
+			hash = RotateLeft(hash, 23) * k_HashPrime2 + k_HashPrime3;
+			data += 4;
+		}
+		while (data < end)
+		{
+			hash ^= (*data) * k_HashPrime5;
+			hash = RotateLeft(hash, 11) * k_HashPrime1;
+			data++;
+		}
+
+		// Final avalanche
+		hash ^= hash >> 33;
+		hash *= k_HashPrime2;
+		hash ^= hash >> 29;
+		hash *= k_HashPrime3;
+		hash ^= hash >> 32;
+		return hash;
+	}
+
+	uint64_t FileSystem::FastHashFromFile(const std::filesystem::path& filepath)
+	{
+		// Hash straight from the page cache instead of copying the file into memory
+		MappedFile file;
+		if (!file.Open(filepath))
+		{
+			// Empty files cannot be mapped
+			uint64_t fileSize{ 0 };
+			int64_t writeTime{ 0 };
+			if (GetFileStamp(filepath, fileSize, writeTime) && fileSize == 0)
+			{
+				return FastHashFromBuffer(nullptr, 0);
+			}
+			KG_ERROR("Failed to generate hash from file {}", filepath.string());
+			return 0;
+		}
+		return FastHashFromBuffer(file.GetData(), file.GetSize());
+	}
 	
 
 	bool FileSystem::CreateNewDirectory(const std::filesystem::path& filepath) noexcept
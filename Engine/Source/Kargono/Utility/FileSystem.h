@@ -47,6 +47,8 @@ namespace Kargono::Utility
 		static bool IsDirectory(const std::filesystem::path& path) noexcept; 
 		static std::filesystem::path GetAbsolutePath(const std::filesystem::path& path) noexcept;
 		static bool DoesPathContainSubPath(const std::filesystem::path& base, const std::filesystem::path& full) noexcept;
+		// Retrieves a file's size and last write time. The write time is only comparable on the same machine.
+		static bool GetFileStamp(const std::filesystem::path& filepath, uint64_t& fileSize, int64_t& writeTime) noexcept;
 
 		//==============================
 		// Manage Files/Directories
@@ -69,6 +71,10 @@ namespace Kargono::Utility
 		static std::string ChecksumFromString(const char* inputString);
 		static std::string ChecksumFromBuffer(Buffer buffer);
 		static uint32_t CRCFromBuffer(void* bufferPointer, uint64_t bufferSize);
+		// Non-cryptographic 64-bit content hash (XXH64). Much faster than the SHA256 checksums, so it
+		//		is used to detect changed files rather than to identify assets.
+		static uint64_t FastHashFromBuffer(const void* bufferPointer, uint64_t bufferSize, uint64_t seed = 0);
+		static uint64_t FastHashFromFile(const std::filesystem::path& filepath);
 		constexpr static uint32_t CRCFromString(const char* inputString)
 		{
 			return Hashing::CalculateHash(inputString, std::strlen(inputString));
@@ -124,6 +124,16 @@ namespace Kargono
 
 	void RuntimeApp::OnUpdate(Timestep ts)
 	{
+#if !defined(KG_EXPORT_RUNTIME) && !defined(KG_EXPORT_SERVER)
+		// Pick up script modules rebuilt by the editor without restarting the runtime
+		m_ScriptModuleCheckTimer += ts.GetSeconds();
+		if (m_ScriptModuleCheckTimer >= 1.0f)
+		{
+			m_ScriptModuleCheckTimer = 0.0f;
+			Scripting::ScriptService::ReloadScriptModuleIfModified();
+		}
+#endif
+
 		// Render
 		Ref<Scenes::Scene> activeScene{ Scenes::SceneService::GetActiveScene() };
 		Rendering::RenderingService::ResetStats();
@@ -121,6 +121,8 @@ namespace Kargono
 		int32_t m_HoveredWidgetID{ Kargono::RuntimeUI::k_InvalidWidgetID };
 		bool m_Headless{ false };
 		std::filesystem::path m_ProjectPath;
+		// Time since the script module was last checked for a newer build
+		float m_ScriptModuleCheckTimer{ 0.0f };
 	};
 
 }